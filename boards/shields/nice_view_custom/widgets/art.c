@@ -1,2831 +0,0 @@
-/*
- *
- * Copyright (c) 2023 Collin Hodge
- * Copyright (c) 2023 The ZMK Contributors
- * SPDX-License-Identifier: MIT
- *
- */
-
-#include <lvgl.h>
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM1
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM1
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM1 uint8_t hammerbeam1_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe3, 0xfe, 0x0f, 0x38, 0x72, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7e, 0x9c, 0xff, 0xfe, 0x70,
-  0xdf, 0xc0, 0x01, 0xf0, 0x66, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf8, 0x36, 0x7e, 0xff, 0xb0,
-  0xbe, 0x00, 0x00, 0x70, 0xe6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xf0, 0x00, 0x66, 0x7f, 0xff, 0xd0,
-  0xbc, 0x00, 0x00, 0x18, 0xcc, 0x3f, 0xff, 0xf3, 0xef, 0xff, 0xe3, 0xff, 0xe6, 0x03, 0xef, 0x3e, 0xe0, 0xd0,
-  0x78, 0x07, 0xe0, 0x0d, 0x98, 0x3f, 0xef, 0xf3, 0xff, 0xbf, 0xf7, 0xff, 0xe7, 0xcf, 0xcd, 0x3e, 0xfb, 0xe0,
-  0x60, 0xff, 0xfc, 0x07, 0x70, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x7c, 0x49, 0x3e, 0xe0, 0xe0,
-  0x41, 0xdf, 0xfe, 0x03, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x19, 0x4c, 0x3a, 0xff, 0xe0,
-  0x03, 0x78, 0x0f, 0x01, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x10, 0x47, 0x3e, 0xe0, 0xe0,
-  0x03, 0xc0, 0x01, 0xc0, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xe7, 0xf1, 0xc7, 0x3e, 0xfa, 0xe0,
-  0x07, 0x80, 0x00, 0xf0, 0x01, 0x9f, 0xff, 0xdf, 0xff, 0xe0, 0x00, 0x03, 0xfe, 0x63, 0xeb, 0x3e, 0xe0, 0xe0,
-  0x0f, 0x07, 0xc0, 0x38, 0x01, 0x9f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xc0, 0x7c, 0x26, 0xe0, 0x7e, 0xff, 0xe0,
-  0x0e, 0x1f, 0xf0, 0x38, 0x03, 0x9f, 0xff, 0xff, 0xfc, 0x1f, 0xb0, 0x3c, 0x1e, 0x34, 0x30, 0x7e, 0xe0, 0xe0,
-  0x1e, 0x3c, 0x7c, 0x1e, 0x0f, 0x9f, 0xff, 0xff, 0xf0, 0x7f, 0xe0, 0x1c, 0x07, 0x27, 0x1c, 0xf6, 0xfc, 0xe0,
-  0x1c, 0x70, 0x1e, 0x0b, 0xfb, 0x1f, 0xff, 0xff, 0xe3, 0xdc, 0x47, 0x0c, 0x23, 0xf3, 0xf9, 0xe2, 0xe0, 0xe0,
-  0x3c, 0x61, 0xeb, 0x0f, 0xde, 0x1f, 0xef, 0xff, 0xc7, 0xf0, 0xcf, 0x8c, 0x71, 0xe8, 0xf3, 0xf6, 0xff, 0xe0,
-  0x2c, 0xe3, 0xf9, 0x04, 0x78, 0x1f, 0xff, 0xff, 0x05, 0x80, 0x8e, 0x8c, 0xe0, 0x7f, 0xc7, 0xfe, 0xe0, 0xe0,
-  0x38, 0xe7, 0x8d, 0x85, 0x60, 0x1f, 0xff, 0xfe, 0x0f, 0x01, 0x99, 0xdc, 0xe2, 0x38, 0x0f, 0xfe, 0xfc, 0xe0,
-  0x38, 0xa6, 0xac, 0x84, 0xc0, 0x1f, 0xff, 0xfc, 0x0c, 0x07, 0x99, 0xd9, 0xc3, 0x1c, 0x3f, 0xfe, 0xe0, 0xe0,
-  0x28, 0xe6, 0x8c, 0x87, 0x87, 0x3f, 0xff, 0xf8, 0x18, 0x7e, 0x9b, 0xb9, 0xc7, 0x0f, 0xff, 0xfe, 0xff, 0xe0,
-  0x38, 0xa3, 0x8d, 0x85, 0x8f, 0x3f, 0xfb, 0xf1, 0x30, 0xf8, 0x9f, 0xf3, 0x86, 0x07, 0xff, 0xfe, 0xe0, 0xe0,
-  0x18, 0xe3, 0xcd, 0x0f, 0x0f, 0x3f, 0xfb, 0xf2, 0x31, 0xe0, 0x9e, 0xc6, 0x8c, 0x07, 0xff, 0xfe, 0xea, 0xe0,
-  0x18, 0x71, 0xfb, 0x0e, 0x3b, 0x3f, 0xfe, 0xe6, 0x63, 0xf1, 0x8f, 0x0f, 0x9c, 0x33, 0xff, 0xfe, 0xee, 0xe0,
-  0x0c, 0x30, 0x7a, 0x1c, 0x3e, 0x37, 0xff, 0xcc, 0x6e, 0x1f, 0xcf, 0xfb, 0x38, 0x79, 0xff, 0xfe, 0xff, 0xe0,
-  0x0e, 0x38, 0x06, 0x1c, 0x7e, 0x7f, 0xff, 0x8c, 0x78, 0x07, 0x43, 0x36, 0x38, 0xf8, 0xfc, 0xfe, 0xe0, 0xe0,
-  0x06, 0x1e, 0x04, 0x18, 0x70, 0x7f, 0xff, 0x98, 0x60, 0x41, 0xe1, 0xfc, 0x70, 0xd8, 0xfc, 0xfe, 0xfa, 0xe0,
-  0x43, 0x07, 0xfc, 0x38, 0xe0, 0xff, 0xff, 0x38, 0xc3, 0xf0, 0xf0, 0xf0, 0xf1, 0xf2, 0x7f, 0xfe, 0xe4, 0xe0,
-  0x63, 0xc1, 0xcc, 0x39, 0xcc, 0xff, 0xff, 0x39, 0x8e, 0x78, 0x58, 0x01, 0xe3, 0x62, 0x7f, 0xfe, 0xff, 0xe0,
-  0x61, 0xff, 0xa8, 0x73, 0xdc, 0xff, 0xfe, 0x31, 0x1c, 0x0e, 0x7e, 0x07, 0x67, 0xc6, 0x3f, 0xfe, 0xe0, 0xe0,
-  0x70, 0xfa, 0x88, 0x63, 0xb9, 0xff, 0xfe, 0x73, 0x18, 0x07, 0x3b, 0xff, 0xcf, 0x8e, 0x3f, 0xfe, 0xea, 0xe0,
-  0x78, 0x1f, 0xf8, 0x67, 0x31, 0xff, 0xfe, 0x73, 0x33, 0x83, 0x1f, 0x4d, 0x8d, 0x0e, 0x3f, 0xee, 0xe4, 0xe0,
-  0x1e, 0x03, 0x10, 0xee, 0x73, 0xff, 0xfc, 0xe6, 0x36, 0xe1, 0xbf, 0xc7, 0x1f, 0x3c, 0x1f, 0xfe, 0xff, 0xe0,
-  0x0f, 0x80, 0x70, 0xce, 0xe7, 0xef, 0xfc, 0xc6, 0x37, 0xf3, 0xe0, 0xfe, 0x1e, 0x3c, 0x1f, 0xfe, 0xe0, 0xe0,
-  0x05, 0xe1, 0xf0, 0xdc, 0xc7, 0xff, 0xfc, 0x8e, 0x3b, 0x36, 0x00, 0x38, 0x3e, 0x3c, 0x9f, 0xfe, 0xea, 0xe0,
-  0x07, 0x3f, 0xb0, 0xb9, 0xcf, 0xff, 0xdc, 0x9e, 0x3e, 0xbc, 0x00, 0x03, 0x34, 0x79, 0x9f, 0x7e, 0xee, 0xe0,
-  0x07, 0x0c, 0x10, 0xfb, 0x9f, 0xff, 0xf9, 0x1a, 0x1a, 0x70, 0x3c, 0x06, 0x7c, 0x79, 0xcf, 0xfe, 0xff, 0xe0,
-  0x03, 0x0c, 0x18, 0xf3, 0x3f, 0xff, 0xf8, 0x13, 0x1f, 0xe0, 0xff, 0xc0, 0xcc, 0xf9, 0x8f, 0xfe, 0xe0, 0xe0,
-  0x03, 0x0e, 0x18, 0xb6, 0x7f, 0xff, 0xf8, 0x37, 0x0f, 0xc1, 0xfb, 0xf7, 0xc8, 0xd9, 0x8f, 0xee, 0xfa, 0xe0,
-  0x43, 0x0e, 0x18, 0xe4, 0xe7, 0xff, 0xf8, 0x3d, 0x83, 0x07, 0xff, 0xbf, 0x78, 0xd9, 0x0f, 0xc6, 0xe0, 0xe0,
-  0x43, 0x87, 0x18, 0x69, 0xe7, 0xfb, 0xf8, 0x6c, 0xc2, 0x0f, 0x01, 0xe6, 0x38, 0xd9, 0x4f, 0xee, 0xff, 0xe0,
-  0x42, 0x87, 0x1c, 0x63, 0xff, 0xff, 0xf8, 0x78, 0x76, 0x1c, 0x00, 0x74, 0x98, 0xd9, 0x4f, 0xfe, 0xe0, 0xe0,
-  0x43, 0xc7, 0x8c, 0x07, 0xff, 0xff, 0xf8, 0xe8, 0x3c, 0x38, 0xfc, 0x3e, 0x19, 0x99, 0x4e, 0xfe, 0xfc, 0xe0,
-  0x61, 0x43, 0x8c, 0x0f, 0xff, 0xff, 0xf8, 0xd8, 0x7c, 0x71, 0xdf, 0x0f, 0x31, 0x99, 0x4f, 0xff, 0x60, 0xe0,
-  0x61, 0x42, 0x8e, 0x3f, 0xff, 0xff, 0xf8, 0xd0, 0xcc, 0x73, 0xff, 0x87, 0x31, 0x9d, 0x0f, 0xff, 0x7f, 0xe0,
-  0x61, 0xc3, 0xc0, 0x7f, 0xff, 0xbf, 0xb9, 0x90, 0xd8, 0xe7, 0x8f, 0xe3, 0xf1, 0x9d, 0x8f, 0xfd, 0xbf, 0xe0,
-  0x60, 0xe1, 0xc1, 0xff, 0x7f, 0xff, 0xf9, 0x30, 0xf8, 0xc7, 0x03, 0xb1, 0xb5, 0xcd, 0x8f, 0xff, 0xcf, 0xe0,
-  0x30, 0x60, 0x0f, 0xfe, 0x3f, 0xff, 0xfc, 0x30, 0xb1, 0xce, 0x10, 0xf8, 0xf4, 0xcd, 0x9f, 0xff, 0xf0, 0xa0,
-  0x00, 0x00, 0x3f, 0xdf, 0x7f, 0xff, 0xfc, 0x20, 0xf1, 0xde, 0x38, 0x78, 0xd6, 0xcf, 0x9f, 0xff, 0xff, 0xe0,
-  0x40, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x21, 0xe1, 0xd6, 0x7e, 0x3c, 0x72, 0xef, 0x9f, 0xef, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61, 0xa3, 0x5e, 0x7f, 0x1e, 0x78, 0x67, 0x9f, 0xff, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0x71, 0xe3, 0xdf, 0x31, 0x8e, 0x38, 0x67, 0x3c, 0xff, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0x70, 0xf1, 0xdb, 0x3a, 0xcf, 0x1c, 0x63, 0x3c, 0xff, 0xf3, 0xe0,
-  0x7f, 0xf7, 0xff, 0x80, 0xff, 0xff, 0xbe, 0x38, 0xf1, 0xcd, 0xbc, 0xcd, 0x8e, 0x70, 0x3f, 0xff, 0x73, 0xe0,
-  0x7f, 0xe3, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0x38, 0x71, 0xc4, 0xfd, 0xe7, 0xc7, 0x78, 0x7f, 0xff, 0xff, 0xe0,
-  0x5f, 0xf7, 0xf0, 0x7f, 0x07, 0xff, 0xff, 0x38, 0x78, 0xc6, 0x37, 0xe6, 0xe7, 0x3c, 0x7f, 0xff, 0xff, 0x60,
-  0x7f, 0xff, 0xe3, 0xff, 0xe3, 0xff, 0xff, 0x9c, 0x3c, 0xe3, 0xf6, 0xf6, 0x73, 0xbc, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xff, 0xc7, 0xc0, 0xf1, 0xfd, 0xff, 0x8e, 0x1e, 0x70, 0xe6, 0xe6, 0x31, 0xd8, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xff, 0x8f, 0x00, 0x3c, 0xf8, 0xff, 0xce, 0x0f, 0xb8, 0x0e, 0x67, 0x78, 0xf9, 0xff, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0x0e, 0x7e, 0x0e, 0x7d, 0xfe, 0xe7, 0x0e, 0xfc, 0x19, 0x67, 0xdc, 0x73, 0xdf, 0xff, 0xff, 0xe0,
-  0x7f, 0xfe, 0x1c, 0xf3, 0x86, 0x3f, 0xff, 0xf3, 0x86, 0x6f, 0xf2, 0xe7, 0xfe, 0x07, 0xff, 0x7f, 0xff, 0xe0,
-  0x7f, 0xfe, 0x19, 0xc0, 0x4f, 0x3f, 0xff, 0xf0, 0xc3, 0xe3, 0xff, 0xce, 0x3b, 0x07, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xfc, 0x19, 0x9f, 0x3b, 0x9f, 0xff, 0xf8, 0x70, 0xf8, 0x1f, 0x98, 0x0f, 0x8f, 0xff, 0xff, 0xff, 0xe0,
-  0x7d, 0xfc, 0x19, 0xbb, 0xb7, 0x1f, 0xfb, 0xfc, 0x3e, 0x3e, 0x7e, 0x10, 0x07, 0x1f, 0xff, 0xff, 0xf7, 0xe0,
-  0xbf, 0xfc, 0x39, 0xb4, 0xa6, 0x1f, 0xff, 0xfe, 0x0f, 0xdb, 0xf8, 0x71, 0xe2, 0x3f, 0xf7, 0xff, 0xe3, 0xd0,
-  0xbf, 0xf9, 0x19, 0xba, 0xec, 0x0f, 0xff, 0xef, 0x01, 0xfe, 0x00, 0xe3, 0xf0, 0x7b, 0xe3, 0xfd, 0xf7, 0xd0,
-  0xdf, 0xf9, 0x19, 0x9f, 0xcc, 0xcd, 0xff, 0xff, 0xc0, 0x00, 0x01, 0xc7, 0x31, 0xff, 0xf7, 0xff, 0xff, 0xb0,
-  0xe7, 0xf9, 0x88, 0xc3, 0x8d, 0xcf, 0xff, 0xff, 0xe0, 0x80, 0xff, 0x8e, 0xa3, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam1 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam1_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM2
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM2
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM2 uint8_t hammerbeam2_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x5a, 0xba, 0xbe, 0x08, 0x08, 0x63, 0xa2, 0x49, 0xbf, 0x87, 0xdb, 0xfe, 0x82, 0x8f, 0xdb, 0xfe, 0x70,
-  0xda, 0xbd, 0x6d, 0x7e, 0x08, 0x44, 0x45, 0x51, 0x25, 0x5f, 0xc7, 0x9b, 0xfd, 0x45, 0x7f, 0xb2, 0xff, 0xb0,
-  0x9d, 0x7a, 0xee, 0xe7, 0x10, 0x2c, 0xc1, 0xa0, 0x09, 0xbf, 0xe6, 0x19, 0xfe, 0x82, 0xff, 0x73, 0xff, 0xd0,
-  0x8a, 0xed, 0xc7, 0xc7, 0x00, 0x44, 0x65, 0xf1, 0x0d, 0x1f, 0xc7, 0x19, 0xfd, 0x01, 0x7f, 0xd2, 0xe0, 0xd0,
-  0x0d, 0x6b, 0xc6, 0x83, 0x80, 0x2c, 0xa3, 0xf8, 0x89, 0xbf, 0x83, 0x0b, 0xf8, 0x00, 0xbf, 0xb4, 0xfb, 0xe0,
-  0x06, 0xef, 0x83, 0x81, 0xc1, 0x04, 0x47, 0xfc, 0x2d, 0xbf, 0xc2, 0x1f, 0xd1, 0x00, 0x5f, 0xec, 0xe0, 0xe0,
-  0x07, 0xc7, 0x81, 0xc0, 0xe0, 0xce, 0x23, 0xfc, 0x49, 0xbf, 0xe2, 0x0f, 0xea, 0x82, 0xbf, 0xac, 0xff, 0xe0,
-  0x03, 0xc7, 0xc4, 0x40, 0xe0, 0x24, 0x47, 0xfc, 0x49, 0x3f, 0xf2, 0x1f, 0xfd, 0x41, 0x5f, 0xfc, 0xe0, 0xe0,
-  0x01, 0x85, 0xe8, 0x20, 0xf0, 0x42, 0x63, 0xfc, 0x49, 0xff, 0xf2, 0x3d, 0xfe, 0xa0, 0xa3, 0xbe, 0xfa, 0xe0,
-  0x00, 0x80, 0xf1, 0x45, 0xf8, 0x41, 0x6d, 0xfc, 0x71, 0x7f, 0xf1, 0x3b, 0xfd, 0x41, 0x45, 0x7e, 0xe0, 0xe0,
-  0x54, 0xc4, 0x6a, 0x0a, 0xf8, 0x88, 0x6b, 0xfa, 0x79, 0xff, 0xf0, 0x3b, 0xfe, 0xa0, 0x8a, 0xfe, 0xff, 0xe0,
-  0x2a, 0xc6, 0x75, 0x15, 0x9c, 0x09, 0x49, 0xe4, 0x79, 0x7f, 0xf4, 0x39, 0xff, 0x40, 0x55, 0x7e, 0xe0, 0xe0,
-  0x55, 0x82, 0x3a, 0xab, 0x0c, 0x08, 0xca, 0xc0, 0x79, 0xbf, 0xe1, 0x3b, 0xfe, 0xa0, 0x8a, 0xee, 0xfc, 0xe0,
-  0x2b, 0xff, 0xff, 0x57, 0x06, 0x0d, 0x4d, 0xc4, 0x79, 0x3f, 0xc6, 0x3b, 0xfd, 0x40, 0x15, 0xfe, 0xe0, 0xe0,
-  0x57, 0x00, 0x01, 0xff, 0xff, 0xec, 0xcc, 0x42, 0xf0, 0xbf, 0x82, 0x3b, 0xfe, 0x88, 0x2a, 0xee, 0xff, 0xe0,
-  0x6a, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1d, 0x06, 0x5b, 0xfd, 0x00, 0x15, 0xf6, 0xe0, 0xe0,
-  0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x2f, 0xea, 0x08, 0xaa, 0xea, 0xfc, 0xe0,
-  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x94, 0x14, 0x15, 0xf6, 0xe0, 0xe0,
-  0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x08, 0x8a, 0xee, 0xff, 0xe0,
-  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x10, 0x57, 0xd6, 0xe0, 0xe0,
-  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x08, 0xa6, 0xee, 0xea, 0xe0,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x81, 0x4f, 0xde, 0xee, 0xe0,
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4a, 0x8f, 0xee, 0xff, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x31, 0x4f, 0xfe, 0xe0, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0e, 0xbf, 0xee, 0xfa, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x7d, 0xfe, 0xe4, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0xfb, 0xfe, 0xff, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x3f, 0xfe, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x1b, 0xfe, 0xea, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x07, 0xfe, 0xe4, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0xfe, 0xff, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x7e, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x1e, 0xea, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0e, 0xee, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x3e, 0xff, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x54, 0xfc, 0xe0, 0xe0,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x2a, 0xaa, 0xa3, 0xfe, 0xfa, 0xe0,
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4d, 0xfe, 0xe0, 0xe0,
-  0x3f, 0xf2, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x2a, 0xaa, 0x3e, 0xfe, 0xff, 0xe0,
-  0x3d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xfd, 0xf8, 0xe0, 0xe0,
-  0x3a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x2a, 0xa3, 0xff, 0xfe, 0xfc, 0xe0,
-  0x3d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x4d, 0xfd, 0xff, 0x60, 0xe0,
-  0x1e, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x2a, 0x33, 0xfe, 0xff, 0x7f, 0xe0,
-  0x1d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0xf9, 0xff, 0xff, 0xbf, 0xe0,
-  0x0e, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x23, 0xfb, 0xff, 0xff, 0xcf, 0xe0,
-  0x0d, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4f, 0xff, 0xff, 0xff, 0xf0, 0xa0,
-  0x06, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x81, 0x3b, 0xfb, 0xff, 0xff, 0xff, 0xe0,
-  0x07, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x17, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x07, 0xff, 0xdc, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0xe0,
-  0x2f, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0xff, 0xfd, 0x04, 0x5c, 0xfd, 0xff, 0xff, 0xf7, 0xff, 0xe0,
-  0x55, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0x1f, 0xff, 0x02, 0xfb, 0x2c, 0x1d, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xe0,
-  0x2d, 0x95, 0x55, 0x00, 0x07, 0xff, 0xf4, 0x14, 0x47, 0xfd, 0x26, 0x5d, 0xfd, 0x5f, 0xff, 0xfb, 0xff, 0xe0,
-  0x58, 0xd0, 0x00, 0xff, 0xf8, 0x03, 0x28, 0x20, 0x2e, 0x7f, 0xbc, 0xde, 0xfa, 0x3f, 0xff, 0xfb, 0xff, 0xe0,
-  0x38, 0xff, 0xff, 0xf3, 0xc4, 0x03, 0xf0, 0x04, 0x87, 0x7d, 0x32, 0xcf, 0xfc, 0x5f, 0xff, 0xfb, 0xff, 0xe0,
-  0x70, 0x70, 0x60, 0xe3, 0x82, 0x03, 0xfc, 0xe9, 0x0e, 0xff, 0xa8, 0xaf, 0xf8, 0x3f, 0xff, 0xfd, 0xff, 0xe0,
-  0x20, 0x38, 0x70, 0xe1, 0x81, 0x83, 0xfe, 0x45, 0x87, 0xdd, 0xa4, 0xce, 0xd5, 0x5f, 0xff, 0xfd, 0xff, 0xe0,
-  0x60, 0x30, 0x38, 0x60, 0xc0, 0x47, 0xee, 0xc9, 0x87, 0xea, 0x28, 0xaf, 0x09, 0x2f, 0xbf, 0xfd, 0xff, 0xe0,
-  0x60, 0xa8, 0x35, 0x30, 0x60, 0x87, 0xff, 0x65, 0x47, 0xbc, 0x21, 0xcf, 0x83, 0x17, 0x7f, 0xfd, 0xff, 0xe0,
-  0x45, 0x70, 0x3a, 0xb0, 0x20, 0x97, 0x6f, 0xeb, 0xa3, 0x7f, 0x19, 0xef, 0x82, 0xab, 0xff, 0xfe, 0xfb, 0xe0,
-  0x4a, 0xf8, 0x1d, 0x30, 0x31, 0x26, 0xff, 0x55, 0x73, 0x7f, 0x80, 0xdf, 0x47, 0x55, 0x7f, 0xfe, 0xfb, 0xe0,
-  0x55, 0xf0, 0x1b, 0x10, 0x12, 0x36, 0xff, 0xca, 0xe3, 0x7f, 0xc0, 0xee, 0x86, 0xaa, 0x7f, 0xf0, 0x3b, 0xe0,
-  0x6b, 0xbc, 0x0e, 0x18, 0x18, 0x22, 0xfe, 0x75, 0x43, 0x7f, 0xe3, 0xdd, 0x47, 0xf4, 0xff, 0xff, 0xcd, 0xe0,
-  0x95, 0xba, 0xac, 0x08, 0x18, 0x22, 0xec, 0x8e, 0xe1, 0x3f, 0xe4, 0xae, 0xaf, 0xf8, 0xff, 0xfd, 0xf1, 0xd0,
-  0xab, 0x1d, 0x5c, 0x04, 0x0c, 0x22, 0x70, 0x17, 0x71, 0x27, 0xf5, 0xc5, 0x4f, 0xf0, 0xff, 0xf3, 0xfc, 0xd0,
-  0xd7, 0x1a, 0xbc, 0x00, 0x06, 0x22, 0x7a, 0xce, 0xe9, 0xa7, 0xe4, 0xe6, 0xaf, 0xf8, 0xff, 0xef, 0xfe, 0xb0,
-  0xe7, 0x1d, 0x74, 0x00, 0x06, 0x16, 0xfc, 0x8d, 0x55, 0x4f, 0xfc, 0x42, 0xcf, 0xf9, 0x77, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam2 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam2_map,
-};
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM3
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM3
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM3 uint8_t hammerbeam3_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x2b, 0xaa, 0xb6, 0xb2, 0x0a, 0x00, 0x31, 0xbc, 0x00, 0x00, 0x80, 0x00, 0x01, 0x55, 0x40, 0x00, 0x70,
-  0xc0, 0x5b, 0xd5, 0x55, 0x54, 0x05, 0x00, 0x33, 0x36, 0x03, 0x01, 0xc0, 0x00, 0x00, 0xaa, 0xa1, 0x00, 0x30,
-  0xa0, 0xea, 0xea, 0xaa, 0xb4, 0x02, 0x00, 0x63, 0x67, 0x01, 0x80, 0x80, 0x00, 0x00, 0x55, 0x40, 0x00, 0x10,
-  0xa1, 0xf5, 0x75, 0x57, 0x54, 0x04, 0x00, 0xc6, 0x67, 0xfb, 0xc0, 0x00, 0x00, 0x00, 0xaa, 0x81, 0x1f, 0x10,
-  0x56, 0xfb, 0xba, 0xaa, 0xaa, 0x02, 0x00, 0xc6, 0xcd, 0x81, 0x80, 0x00, 0x00, 0x00, 0x54, 0x11, 0x04, 0x00,
-  0x5d, 0x7f, 0x5d, 0x55, 0x56, 0x08, 0x01, 0x8c, 0xcd, 0x83, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x1f, 0x00,
-  0x0e, 0xbf, 0xfa, 0xa2, 0xa0, 0x16, 0x03, 0x8d, 0x99, 0xc0, 0x00, 0x04, 0x10, 0x40, 0x40, 0x11, 0x00, 0x00,
-  0x0f, 0xff, 0xf5, 0x45, 0x50, 0x0b, 0x93, 0x19, 0x1b, 0xc0, 0x00, 0x08, 0x00, 0x20, 0x00, 0x21, 0x1f, 0x00,
-  0x0f, 0xff, 0xea, 0xaa, 0xa8, 0x3f, 0x26, 0x3a, 0x33, 0xe0, 0x00, 0x10, 0x00, 0x40, 0x40, 0x11, 0x05, 0x00,
-  0x0f, 0xff, 0xd5, 0x45, 0x50, 0x7b, 0x86, 0x68, 0x36, 0xe0, 0x80, 0x28, 0x00, 0x20, 0x00, 0x2b, 0x1f, 0x00,
-  0x0f, 0xff, 0xaa, 0x8a, 0xa9, 0x77, 0x4c, 0x88, 0x66, 0x60, 0x00, 0x52, 0x00, 0x40, 0x40, 0x55, 0x00, 0x00,
-  0x1f, 0xff, 0x55, 0x05, 0x50, 0xae, 0xec, 0x8c, 0x6c, 0xe0, 0x02, 0xa1, 0xc0, 0x00, 0x20, 0x2b, 0x1f, 0x00,
-  0x3f, 0xff, 0xaa, 0x8a, 0xa8, 0x7f, 0xd9, 0xf4, 0xcc, 0xf0, 0x55, 0x40, 0x60, 0x00, 0x00, 0x55, 0x03, 0x00,
-  0x7f, 0xff, 0x57, 0x05, 0x50, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x29, 0x1f, 0x00,
-  0x7f, 0xfe, 0xab, 0x8a, 0xa8, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf8, 0x00, 0x00, 0x51, 0x00, 0x00,
-  0x7f, 0xff, 0x55, 0xc5, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x21, 0x1f, 0x00,
-  0x7f, 0xff, 0xaa, 0x22, 0xa0, 0x5f, 0x77, 0x79, 0x36, 0xff, 0x7d, 0x00, 0x60, 0x00, 0x00, 0x51, 0x03, 0x00,
-  0x7f, 0xf7, 0x55, 0x45, 0x40, 0x2b, 0xab, 0xb2, 0x66, 0xff, 0xfe, 0x81, 0xc0, 0x00, 0x00, 0x29, 0x1f, 0x00,
-  0x7f, 0xeb, 0xaa, 0x42, 0x80, 0x17, 0x77, 0x70, 0x6c, 0xff, 0xfd, 0x02, 0x02, 0x00, 0x00, 0x11, 0x00, 0x00,
-  0x7f, 0xd7, 0xd4, 0x85, 0x00, 0x2e, 0xeb, 0xe8, 0xcd, 0xfb, 0xfa, 0x90, 0x00, 0x00, 0x00, 0x21, 0x1f, 0x00,
-  0x7f, 0xab, 0xeb, 0x02, 0x00, 0x17, 0xd7, 0x55, 0x99, 0xf1, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x7d, 0xd5, 0xf4, 0x04, 0x00, 0x0a, 0xee, 0xbb, 0xb3, 0xfb, 0xfa, 0x80, 0x00, 0x00, 0x00, 0x21, 0x11, 0x00,
-  0x6a, 0xea, 0xe0, 0x02, 0x00, 0x17, 0xdd, 0x77, 0x77, 0x7f, 0xfd, 0x02, 0xff, 0xe8, 0x00, 0x11, 0x00, 0x00,
-  0x55, 0x75, 0x70, 0x00, 0x00, 0x0b, 0xae, 0xee, 0xef, 0xff, 0xfe, 0x80, 0x00, 0x07, 0x80, 0x01, 0x1f, 0x00,
-  0x2a, 0xba, 0xb8, 0x02, 0x00, 0x05, 0xdd, 0xdd, 0xdf, 0xff, 0xfd, 0x10, 0x00, 0x03, 0xf0, 0x01, 0x05, 0x00,
-  0x55, 0x55, 0x58, 0x00, 0x00, 0x0a, 0xbb, 0xbb, 0xbf, 0xfe, 0xbe, 0xb8, 0x00, 0x01, 0xfc, 0x01, 0x1b, 0x00,
-  0x2a, 0xaa, 0xbc, 0x00, 0x00, 0x05, 0xf7, 0x77, 0xff, 0xfd, 0x9f, 0x50, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00,
-  0x55, 0x55, 0x5e, 0x00, 0x00, 0x02, 0xff, 0xef, 0xfc, 0xff, 0xde, 0x80, 0x08, 0x00, 0xff, 0x01, 0x1f, 0x00,
-  0x2a, 0xaa, 0xaf, 0x00, 0x00, 0x01, 0x7f, 0xff, 0xfc, 0xff, 0x7f, 0x40, 0x00, 0x00, 0x3e, 0x01, 0x15, 0x00,
-  0x55, 0x75, 0x57, 0x80, 0x00, 0x02, 0xf7, 0xff, 0xdf, 0xee, 0xbb, 0xa0, 0x00, 0x00, 0x1f, 0x81, 0x1b, 0x00,
-  0x6f, 0xff, 0xab, 0x80, 0x00, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x3b, 0xe1, 0x00, 0x00,
-  0x7f, 0xff, 0xf5, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xf9, 0x1f, 0x00,
-  0x7f, 0xff, 0xfa, 0xe0, 0x00, 0x01, 0x5f, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x15, 0x00,
-  0x7f, 0xfd, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfd, 0xf9, 0x11, 0x00,
-  0x7f, 0xeb, 0xff, 0x80, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xfb, 0xd0, 0x00, 0x00, 0x3b, 0xe1, 0x00, 0x00,
-  0x7f, 0x57, 0xff, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x07, 0x81, 0x1f, 0x00,
-  0x7a, 0xaf, 0xfe, 0x00, 0x00, 0x00, 0x5f, 0x87, 0xdf, 0x7f, 0xff, 0xd4, 0x30, 0x00, 0x3e, 0x01, 0x05, 0x00,
-  0x7d, 0x5f, 0xfc, 0x00, 0x00, 0x00, 0x2e, 0x0f, 0x8f, 0xf4, 0x00, 0x00, 0x18, 0x40, 0xff, 0x01, 0x1f, 0x00,
-  0x3e, 0xbf, 0xfc, 0x00, 0x00, 0x00, 0x5e, 0x0b, 0xdf, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x7e, 0x01, 0x00, 0x00,
-  0x5f, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x2f, 0xd9, 0xff, 0xff, 0xa0, 0x00, 0x18, 0x01, 0xfc, 0x01, 0x1f, 0x00,
-  0x2f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x57, 0x31, 0xff, 0xdf, 0xff, 0xf4, 0x30, 0x03, 0xf0, 0x01, 0x03, 0x00,
-  0x57, 0xfd, 0xe0, 0x00, 0x00, 0x00, 0x2e, 0x81, 0xff, 0xd7, 0xff, 0xfa, 0x00, 0x07, 0x80, 0x02, 0x9f, 0x00,
-  0x2a, 0xfb, 0xc0, 0x00, 0x00, 0x00, 0x57, 0x71, 0xf7, 0x57, 0xfe, 0xfd, 0x5f, 0xe8, 0x00, 0x00, 0x80, 0x00,
-  0x55, 0x77, 0xc0, 0x00, 0x00, 0x00, 0x2b, 0xef, 0xfe, 0xd3, 0xdf, 0xfa, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00,
-  0x36, 0xaf, 0x88, 0x00, 0x00, 0x00, 0x57, 0xd7, 0xff, 0xd7, 0x8f, 0xfd, 0x00, 0x00, 0x00, 0x04, 0x30, 0x00,
-  0x55, 0x77, 0xd6, 0x00, 0x40, 0x00, 0x2f, 0xff, 0xff, 0xaf, 0xdf, 0xfe, 0x88, 0x00, 0x00, 0x02, 0x8f, 0x40,
-  0x36, 0xbf, 0xa9, 0x00, 0x80, 0x00, 0x57, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0x5c, 0x00, 0x40, 0x05, 0x50, 0x00,
-  0x53, 0x5f, 0xd6, 0x00, 0x00, 0x00, 0xae, 0xff, 0xe7, 0xff, 0xfe, 0x7f, 0x88, 0x00, 0x80, 0x0a, 0xa8, 0x00,
-  0x72, 0xaf, 0xae, 0x00, 0x80, 0x01, 0x5d, 0x5f, 0xe7, 0xff, 0xf4, 0xf8, 0xc0, 0x00, 0x00, 0x05, 0x54, 0x00,
-  0x55, 0x57, 0x55, 0x00, 0x40, 0x00, 0xba, 0xab, 0xff, 0xfe, 0xf9, 0xc0, 0x60, 0x80, 0x80, 0x0a, 0xa8, 0x00,
-  0x76, 0xae, 0xaa, 0x80, 0xa0, 0x01, 0x55, 0x55, 0x7f, 0xff, 0xff, 0x83, 0xf0, 0x70, 0x40, 0x05, 0x54, 0x00,
-  0x35, 0x57, 0x55, 0x00, 0x40, 0x02, 0xaa, 0xaa, 0xaf, 0xff, 0xfb, 0x8f, 0xf0, 0x18, 0x80, 0x02, 0xaa, 0x00,
-  0x3a, 0xab, 0xaa, 0x80, 0x80, 0x01, 0x55, 0x41, 0x54, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x01, 0x54, 0x00,
-  0x75, 0x57, 0xd5, 0x01, 0x00, 0x02, 0xa8, 0x00, 0x2a, 0xbf, 0xff, 0xff, 0xfd, 0xfe, 0x82, 0x08, 0xa8, 0x00,
-  0x1a, 0xab, 0xaa, 0x00, 0x80, 0x05, 0x40, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x10, 0x50, 0x00,
-  0x0f, 0x55, 0xd4, 0x01, 0x10, 0x02, 0x80, 0x00, 0x02, 0xab, 0xfb, 0xb8, 0x98, 0x18, 0x00, 0x02, 0xa0, 0x00,
-  0x07, 0xaa, 0xfa, 0x00, 0xa8, 0x05, 0x20, 0x00, 0x00, 0x55, 0x7f, 0xb8, 0x98, 0x70, 0x04, 0x15, 0x50, 0x00,
-  0x05, 0xf5, 0x7d, 0x01, 0x54, 0x0a, 0x40, 0x00, 0x00, 0x0a, 0xbb, 0x9d, 0x98, 0x80, 0x02, 0x22, 0xa8, 0x00,
-  0x02, 0xff, 0xaf, 0x82, 0xa8, 0x04, 0x00, 0x00, 0x00, 0x01, 0x57, 0x9f, 0x1c, 0x00, 0x05, 0x05, 0x54, 0x00,
-  0x03, 0x7f, 0xff, 0x01, 0x54, 0x08, 0x40, 0x00, 0x00, 0x00, 0x2a, 0xce, 0x3a, 0x02, 0x02, 0x2a, 0xaa, 0x00,
-  0x02, 0xff, 0xfa, 0x82, 0xaa, 0x10, 0x80, 0x00, 0x00, 0x00, 0x15, 0x70, 0x3c, 0x00, 0x04, 0x15, 0x55, 0x00,
-  0x43, 0x5f, 0xf5, 0x45, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaf, 0xea, 0x60, 0x00, 0x2a, 0xaa, 0x00,
-  0x82, 0xbf, 0xea, 0x8a, 0xaa, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x57, 0xc5, 0x60, 0x04, 0x55, 0x55, 0x10,
-  0x87, 0xbf, 0xd5, 0x45, 0x54, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe6, 0x00, 0x00, 0x2a, 0xaa, 0x10,
-  0xcf, 0xbf, 0xaa, 0xae, 0xa8, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x04, 0x01, 0x5b, 0x00, 0x00, 0x55, 0x55, 0x30,
-  0xe7, 0xbf, 0x55, 0x4b, 0x55, 0x50, 0x50, 0x00, 0x00, 0x00, 0x08, 0x00, 0xae, 0x88, 0x00, 0x2a, 0xaa, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam3 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam3_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM4
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM4
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM4 uint8_t hammerbeam4_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xe7, 0xf9, 0xce, 0xe3, 0xff, 0xff, 0xf3, 0xff, 0xb9, 0xff, 0xfe, 0x70,
-  0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x88, 0xfd, 0xee, 0x73, 0xff, 0xff, 0xf0, 0xff, 0x99, 0xee, 0xff, 0xb0,
-  0xbb, 0xdf, 0xff, 0xfe, 0x3f, 0xe7, 0x3e, 0x3d, 0xee, 0x73, 0xff, 0xff, 0xf2, 0x03, 0xd9, 0xff, 0xff, 0xd0,
-  0xb1, 0xff, 0xfe, 0xfe, 0x3f, 0xe6, 0x73, 0xbc, 0xef, 0x73, 0xf7, 0xfd, 0xf3, 0xf3, 0xd9, 0xfe, 0xe0, 0xd0,
-  0x7b, 0xff, 0xff, 0xfe, 0x3f, 0xe4, 0xc8, 0xbe, 0xe7, 0x73, 0xff, 0xff, 0xf3, 0xbb, 0x91, 0xfe, 0xfb, 0xe0,
-  0x7f, 0xc0, 0x7f, 0xff, 0xff, 0x61, 0xde, 0xbe, 0xf7, 0x63, 0xff, 0xff, 0xf8, 0x33, 0xb3, 0xfe, 0xe0, 0xe0,
-  0x7f, 0x00, 0x1f, 0xff, 0xff, 0xf1, 0x9a, 0x3c, 0xf7, 0x67, 0xff, 0xff, 0xf9, 0x67, 0x33, 0xfe, 0xff, 0xe0,
-  0x00, 0x32, 0x00, 0x00, 0xbf, 0xf3, 0xbc, 0x7d, 0xf7, 0x67, 0xff, 0xff, 0xfc, 0xce, 0x67, 0xfe, 0xe0, 0xe0,
-  0x7c, 0x0b, 0x87, 0xff, 0xff, 0xf9, 0x9f, 0xf9, 0xe7, 0x4f, 0xff, 0xff, 0xfc, 0x5e, 0xc7, 0xfe, 0xfa, 0xe0,
-  0x78, 0x41, 0xc3, 0xff, 0xff, 0xf9, 0xdf, 0xf3, 0xce, 0x4f, 0xfe, 0x7f, 0xfe, 0x1c, 0x0f, 0xee, 0xe0, 0xe0,
-  0x73, 0x4c, 0xe1, 0xff, 0xff, 0xfc, 0xcf, 0xe7, 0xde, 0x9f, 0xfc, 0x7f, 0xff, 0x80, 0x3f, 0xfe, 0xff, 0xe0,
-  0x61, 0xe6, 0x30, 0xff, 0xff, 0xfc, 0x66, 0x0f, 0x9e, 0x1f, 0xfc, 0x7f, 0xff, 0xe0, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0x78, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xfc, 0xf0, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x4b, 0x89, 0x9c, 0x7f, 0xe0, 0xff, 0xc3, 0xfb, 0xc1, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x4c, 0xc6, 0xce, 0x7f, 0xc6, 0x7f, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x4e, 0x72, 0x66, 0x7f, 0xdf, 0x7f, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x47, 0x3b, 0x32, 0x7f, 0xcc, 0x7f, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfe, 0xff, 0xe0,
-  0x4b, 0x88, 0x18, 0x7f, 0xe0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7e, 0xe0, 0xe0,
-  0x64, 0xd3, 0xcc, 0xf9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x3e, 0xea, 0xe0,
-  0x66, 0x43, 0x60, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x80, 0x3e, 0xee, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x3f, 0x1e, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x81, 0xff, 0x03, 0x9e, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0x38, 0x1e, 0xfa, 0xe0,
-  0x7e, 0x3e, 0x0f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x3e, 0xe4, 0xe0,
-  0x7f, 0x00, 0x1f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x3e, 0xff, 0xe0,
-  0x7f, 0xc0, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7e, 0xe0, 0xe0,
-  0x00, 0x00, 0x02, 0xff, 0xff, 0xfd, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xfe, 0xea, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x18, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0f, 0x7f, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x03, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x68, 0x01, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x03, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x50, 0x00, 0x03, 0x50, 0x1f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0xaa, 0x00, 0x01, 0xa0, 0x03, 0xf7, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x01, 0x5d, 0x00, 0x00, 0xf5, 0x00, 0xff, 0xca, 0x7f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x60, 0xe0,
-  0x00, 0xfe, 0x80, 0x00, 0x3f, 0xa0, 0x7f, 0x9b, 0x3f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x7f, 0xe0,
-  0x01, 0xfd, 0x40, 0x00, 0x0f, 0xf0, 0x7f, 0x99, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xbf, 0xe0,
-  0x03, 0xfa, 0x80, 0x00, 0x07, 0xf0, 0x3f, 0x94, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xe0,
-  0x0f, 0xfd, 0x40, 0x00, 0x03, 0xf8, 0x1f, 0xce, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa0,
-  0x3f, 0xfa, 0xa0, 0x00, 0x01, 0xf8, 0x2f, 0xe0, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xfd, 0x50, 0x00, 0x00, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x7a, 0xfe, 0xa8, 0xa0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x7c, 0x7f, 0x55, 0x50, 0x00, 0x3e, 0x17, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xe0,
-  0x78, 0x3f, 0xaa, 0xa8, 0x00, 0x3e, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xe0,
-  0x7c, 0x7f, 0xd5, 0x54, 0x00, 0x1e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x13, 0xe0,
-  0x7e, 0xff, 0xea, 0xaa, 0x00, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3d, 0xe0,
-  0x7f, 0xff, 0xd5, 0x5d, 0x00, 0x0e, 0x07, 0xff, 0x9f, 0xfe, 0x3f, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0x3c, 0xe0,
-  0x7f, 0xff, 0xea, 0xbe, 0x00, 0x06, 0x0f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xfc, 0xde, 0x60,
-  0x5f, 0xff, 0xd5, 0x7f, 0x00, 0x04, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0x20,
-  0x3f, 0xbf, 0xaa, 0xff, 0x80, 0x8c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xf9, 0x9f, 0xa0,
-  0x5f, 0x5f, 0x57, 0xff, 0x01, 0x48, 0x1f, 0xff, 0xff, 0xfb, 0xff, 0xff, 0x7f, 0x07, 0xf7, 0xf9, 0xff, 0x80,
-  0x2f, 0xbe, 0xaf, 0xfe, 0x82, 0xb8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73, 0xff, 0xd9, 0xff, 0xc0,
-  0x57, 0xff, 0x7f, 0xff, 0x01, 0x50, 0x11, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf9, 0x3f, 0xc0,
-  0x2f, 0xff, 0xff, 0xfe, 0x80, 0xb0, 0x2f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfc, 0xb9, 0xff, 0xf8, 0x0f, 0xc0,
-  0x5f, 0xf5, 0xff, 0xfd, 0x00, 0x60, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xf9, 0xe7, 0x80,
-  0xbf, 0xfb, 0xfb, 0xfa, 0x80, 0xc0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73, 0xef, 0xf9, 0xf0, 0x10,
-  0xbf, 0xfd, 0xf5, 0xf5, 0x00, 0x80, 0x7f, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0x07, 0xff, 0xbc, 0xff, 0xd0,
-  0xdf, 0xff, 0xfb, 0xfa, 0x01, 0x80, 0xff, 0xff, 0xfd, 0xf8, 0x00, 0xff, 0xff, 0x8f, 0xff, 0xfc, 0xff, 0xb0,
-  0xe7, 0xff, 0xff, 0xf5, 0x07, 0x01, 0xfe, 0x3f, 0xff, 0xf1, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x7e, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam4 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam4_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM5
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM5
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM5 uint8_t hammerbeam5_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0x7f, 0xd5, 0x00, 0x33, 0xbf, 0xf9, 0x05, 0x55, 0x40, 0x07, 0x9f, 0xd1, 0x00, 0x00, 0x01, 0xfe, 0x70,
-  0xcb, 0xfa, 0xaa, 0x80, 0x2b, 0xbf, 0xf9, 0x0a, 0xaa, 0x80, 0x07, 0xbf, 0xea, 0x00, 0x00, 0x00, 0xff, 0xb0,
-  0x87, 0xfd, 0x55, 0x01, 0x21, 0xbf, 0xf1, 0x15, 0x55, 0x00, 0x07, 0xbf, 0xd0, 0x00, 0x00, 0x01, 0xff, 0xd0,
-  0x8f, 0xfe, 0xaa, 0x00, 0x29, 0xdf, 0xf3, 0xaa, 0xaa, 0x80, 0x07, 0xdf, 0xc8, 0x00, 0x00, 0x00, 0xe0, 0xd0,
-  0x57, 0xfd, 0x54, 0x01, 0x14, 0xff, 0xf1, 0xd5, 0x55, 0x00, 0x07, 0xff, 0xd0, 0x00, 0x00, 0x00, 0xfb, 0xe0,
-  0x0f, 0xfa, 0xa0, 0x00, 0x84, 0xff, 0xe3, 0xaa, 0xaa, 0x00, 0x03, 0xff, 0x88, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x47, 0x71, 0x00, 0x01, 0x04, 0xdf, 0x95, 0x55, 0x54, 0x00, 0x03, 0xff, 0x90, 0x00, 0x00, 0x00, 0xff, 0xe0,
-  0x2f, 0xaa, 0x00, 0x00, 0x84, 0xc1, 0x43, 0xa8, 0xa0, 0x00, 0x01, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x57, 0x50, 0x00, 0x00, 0x04, 0xc5, 0x75, 0xd1, 0x00, 0x00, 0x01, 0x9c, 0x10, 0x00, 0x00, 0x00, 0xfa, 0xe0,
-  0x2f, 0xa2, 0x00, 0x40, 0x04, 0xe9, 0xfa, 0xa0, 0x00, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x53, 0x40, 0x00, 0x70, 0x04, 0x67, 0xfd, 0x10, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
-  0x7f, 0xff, 0xfe, 0xf8, 0x06, 0x6b, 0xfe, 0x80, 0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x02, 0xe0, 0xe0,
-  0x57, 0x00, 0x00, 0x70, 0x04, 0x67, 0xfd, 0x41, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xfe, 0xfc, 0xe0,
-  0x2b, 0x80, 0x00, 0x40, 0x02, 0x6b, 0xfa, 0xa0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3e, 0xe0, 0xe0,
-  0x55, 0x00, 0x00, 0x00, 0x00, 0x65, 0xb5, 0x51, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xe0,
-  0x2b, 0x80, 0x00, 0x00, 0x00, 0x69, 0xa8, 0xa0, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xe0, 0xe0,
-  0x55, 0x80, 0x00, 0x00, 0x00, 0x21, 0x84, 0x41, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xfc, 0xe0,
-  0x2a, 0x80, 0x00, 0x00, 0x00, 0x28, 0xca, 0x80, 0x80, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x03, 0xfe, 0xe0, 0xe0,
-  0x55, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe4, 0x01, 0x00, 0x01, 0x05, 0x57, 0x00, 0x00, 0x0f, 0xfe, 0xff, 0xe0,
-  0x2a, 0x00, 0x00, 0x00, 0x00, 0x18, 0xea, 0x00, 0x00, 0x00, 0x8a, 0xab, 0x80, 0x00, 0x3f, 0xfe, 0xe0, 0xe0,
-  0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x55, 0x57, 0xe0, 0x00, 0xff, 0xfe, 0xea, 0xe0,
-  0x28, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x2a, 0xaf, 0xfc, 0x07, 0xff, 0xfe, 0xee, 0xe0,
-  0x50, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x5d, 0x5f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x82, 0x80, 0x00, 0x00, 0x2e, 0xbf, 0xff, 0xff, 0xf7, 0xfa, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x82, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x57, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3e, 0x08, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3f, 0x85, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe2, 0xaf, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xf9, 0x57, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x3e, 0xaf, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x77, 0xf9, 0x56, 0x3f, 0xbf, 0xff, 0xff, 0x7e, 0xff, 0xe0,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0xaf, 0x7f, 0xff, 0xff, 0xfe, 0x3e, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xfa, 0xe0,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xe0,
-  0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7f, 0xe0,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe0,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xe0,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa0,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x2a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0xff, 0xfe, 0x3f, 0xe0,
-  0x54, 0x00, 0x01, 0x80, 0x00, 0x02, 0x1d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0xff, 0xfc, 0x1f, 0xe0,
-  0x2a, 0x20, 0x00, 0xe0, 0x00, 0x03, 0x1d, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xdf, 0xf8, 0x0f, 0xe0,
-  0x7f, 0xff, 0xfd, 0xf0, 0x00, 0x07, 0x1e, 0xf4, 0x04, 0x00, 0x00, 0x00, 0x5f, 0x7f, 0xff, 0xf8, 0x08, 0x60,
-  0x2a, 0x28, 0x00, 0xe0, 0x00, 0x06, 0x3f, 0xf8, 0x02, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x55, 0x54, 0x01, 0x80, 0x00, 0x06, 0x3f, 0xfc, 0x04, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0xff, 0xf1, 0x00, 0x00,
-  0x2a, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xaf, 0xff, 0xc0, 0x00, 0x00,
-  0x55, 0x15, 0x00, 0x00, 0x00, 0x02, 0x3f, 0xfc, 0x04, 0x00, 0x00, 0x00, 0x17, 0x75, 0xff, 0x00, 0x00, 0x00,
-  0x2a, 0xba, 0x80, 0x00, 0x00, 0x02, 0x3f, 0xf8, 0xa2, 0x00, 0x00, 0x00, 0x0e, 0xaa, 0xfe, 0x00, 0x00, 0x00,
-  0x55, 0x75, 0x40, 0x00, 0x02, 0x02, 0x1f, 0xf5, 0x54, 0x00, 0x00, 0x00, 0x07, 0x75, 0xfe, 0x00, 0x00, 0x00,
-  0x2a, 0xaa, 0xa0, 0x00, 0x03, 0x81, 0x1f, 0xde, 0xae, 0x00, 0x00, 0x00, 0xa6, 0xaa, 0xfc, 0x00, 0x00, 0x00,
-  0x5f, 0xff, 0xff, 0xff, 0xf7, 0xc0, 0x1f, 0xff, 0xd6, 0x00, 0x00, 0x05, 0x41, 0x75, 0x7c, 0x00, 0x00, 0x00,
-  0x2a, 0xaa, 0xa0, 0x00, 0x03, 0x80, 0x0f, 0xff, 0xee, 0x80, 0x00, 0x01, 0x02, 0xaa, 0xf8, 0x00, 0x00, 0x00,
-  0x51, 0x75, 0x50, 0x00, 0x02, 0x00, 0x0f, 0xff, 0xf5, 0x50, 0x00, 0x07, 0x41, 0x55, 0x78, 0x00, 0x00, 0x00,
-  0x28, 0xee, 0xa0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xee, 0x88, 0x00, 0x03, 0x23, 0xaa, 0xa8, 0x00, 0x00, 0x00,
-  0x91, 0x7d, 0x50, 0x00, 0x40, 0x00, 0x06, 0xff, 0xf5, 0x14, 0x00, 0x07, 0x43, 0x55, 0x50, 0x00, 0x00, 0x10,
-  0xaa, 0xea, 0xa8, 0x08, 0x80, 0x00, 0x06, 0xfb, 0xfa, 0xaa, 0x00, 0x03, 0xe3, 0xaa, 0xa8, 0x00, 0x00, 0x10,
-  0xd1, 0xfd, 0x50, 0x10, 0x40, 0x00, 0x46, 0xf7, 0xf5, 0x15, 0x00, 0x07, 0x62, 0x55, 0x50, 0x00, 0x00, 0x30,
-  0xe2, 0xee, 0xa8, 0x00, 0x80, 0x00, 0x86, 0xff, 0xf2, 0xaa, 0x00, 0x06, 0xf2, 0xaa, 0x28, 0x00, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam5 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam5_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM6
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM6
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM6 uint8_t hammerbeam6_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe6, 0x00, 0xff, 0xa8, 0x3f, 0xf0, 0xff, 0xf8, 0x00, 0x7e, 0xaa, 0xbf, 0xbb, 0xff, 0xea, 0x80, 0x00, 0x70,
-  0xdf, 0x00, 0x7f, 0xd5, 0xff, 0xf8, 0x7f, 0xf8, 0x00, 0xff, 0x51, 0x5f, 0x9d, 0xff, 0xe5, 0x01, 0x00, 0x30,
-  0xbf, 0x00, 0x7f, 0xab, 0xff, 0xfc, 0x7f, 0xf8, 0x00, 0xfe, 0xaa, 0xbf, 0xfb, 0xff, 0xea, 0x00, 0x00, 0x10,
-  0xbf, 0x00, 0x7f, 0xdf, 0xff, 0xfe, 0x3f, 0xf0, 0x00, 0xff, 0x55, 0x5f, 0xdd, 0xff, 0xc0, 0x01, 0x1f, 0x10,
-  0x7f, 0x80, 0x3f, 0xff, 0xff, 0xfe, 0x1f, 0xf0, 0x00, 0x7e, 0xaa, 0xbf, 0xff, 0xff, 0xa8, 0x01, 0x04, 0x00,
-  0x7f, 0x80, 0x3f, 0xff, 0xff, 0xff, 0x9f, 0xf0, 0x00, 0x39, 0x15, 0x5f, 0xff, 0xff, 0x44, 0x01, 0x1f, 0x00,
-  0x3f, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xef, 0xf1, 0x00, 0x00, 0xaa, 0xaf, 0xff, 0xae, 0x20, 0x01, 0x00, 0x00,
-  0x5f, 0xc0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x80, 0x00, 0x05, 0x07, 0xff, 0x54, 0x40, 0x01, 0x1f, 0x00,
-  0x3f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x40, 0x00, 0x80, 0x03, 0xfe, 0xaa, 0x00, 0x01, 0x05, 0x00,
-  0x5f, 0xe0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x40, 0x00, 0x40, 0x07, 0xfd, 0x54, 0x40, 0x01, 0x1f, 0x00,
-  0x2f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x80, 0x00, 0x80, 0x0f, 0xfe, 0xa8, 0x00, 0x01, 0x00, 0x00,
-  0x5f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x50, 0x00, 0x05, 0x1f, 0x00,
-  0x2f, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x80, 0x0f, 0xfe, 0xa0, 0x00, 0x09, 0x03, 0x00,
-  0x57, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x40, 0x0f, 0xff, 0x40, 0x00, 0x01, 0x1f, 0x00,
-  0x2f, 0xf8, 0x0f, 0xaf, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x80, 0x00, 0x09, 0x00, 0x00,
-  0x57, 0xf8, 0x0f, 0xd0, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0xfd, 0x40, 0x00, 0x01, 0x1f, 0x00,
-  0x2b, 0xfc, 0x07, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x06, 0xfa, 0xa0, 0x00, 0x09, 0x03, 0x00,
-  0x77, 0xfc, 0x07, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x06, 0x75, 0x50, 0x00, 0x15, 0x1f, 0x00,
-  0x6b, 0xfc, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x06, 0x02, 0xa0, 0x00, 0x09, 0x00, 0x00,
-  0x55, 0xfe, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x16, 0x00, 0x40, 0x00, 0x11, 0x1f, 0x00,
-  0x2a, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x22, 0x02, 0x80, 0x00, 0x09, 0x15, 0x00,
-  0x55, 0xff, 0x81, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00,
-  0x2a, 0xff, 0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x00, 0x00,
-  0x55, 0x7f, 0xe0, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0x1f, 0x00,
-  0x2a, 0xbf, 0xf0, 0x78, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x01, 0x05, 0x00,
-  0x55, 0x5f, 0xf0, 0x37, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00,
-  0x6a, 0xbf, 0xf8, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xf7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x55, 0x5f, 0xfe, 0x1d, 0x50, 0x00, 0x00, 0x7f, 0xf7, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x6a, 0xaf, 0xff, 0xfa, 0xaa, 0x00, 0x01, 0xff, 0xf7, 0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x75, 0x57, 0xff, 0xfd, 0x55, 0x40, 0x02, 0x1f, 0xef, 0xf0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x00,
-  0x7a, 0xab, 0xff, 0xfe, 0xaa, 0x80, 0x0c, 0x01, 0xef, 0xf8, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x7d, 0x55, 0xff, 0xff, 0x55, 0x00, 0x10, 0x00, 0x1f, 0xfe, 0x01, 0x00, 0x02, 0x04, 0x00, 0x01, 0x1f, 0x00,
-  0x7e, 0xaa, 0xff, 0xff, 0xa8, 0x00, 0x60, 0x00, 0x09, 0xff, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x7f, 0x55, 0x7f, 0xff, 0xf0, 0x00, 0x80, 0x00, 0x04, 0x1f, 0x80, 0x00, 0x02, 0x44, 0x00, 0x01, 0x11, 0x00,
-  0x7f, 0xaa, 0xbf, 0xff, 0xfe, 0x03, 0x00, 0x00, 0x04, 0x01, 0xc0, 0x00, 0x02, 0x8a, 0x00, 0x01, 0x00, 0x00,
-  0x7f, 0xf5, 0x5f, 0xff, 0xff, 0x84, 0x00, 0x00, 0x04, 0x00, 0x80, 0x00, 0x06, 0x04, 0x00, 0x01, 0x1f, 0x00,
-  0x7f, 0xfe, 0xbf, 0xff, 0xf1, 0x18, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x02, 0x88, 0x80, 0x01, 0x05, 0x00,
-  0x7f, 0xff, 0x5f, 0xf0, 0x06, 0x20, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x06, 0x44, 0x50, 0x01, 0x1f, 0x00,
-  0x7f, 0xff, 0xaf, 0x00, 0x08, 0xc0, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x06, 0xea, 0xa8, 0x01, 0x00, 0x00,
-  0x63, 0xff, 0xff, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x07, 0xfd, 0x50, 0x01, 0x1f, 0x00,
-  0x00, 0x7f, 0xff, 0x80, 0x27, 0x00, 0x00, 0x00, 0x02, 0x60, 0x00, 0x00, 0x0f, 0xfe, 0xa8, 0x01, 0x03, 0x00,
-  0x79, 0xff, 0xff, 0xc0, 0xcf, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x07, 0xfd, 0x54, 0x00, 0x9f, 0x00,
-  0x3f, 0xff, 0xff, 0x81, 0xbe, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0xa8, 0x80, 0x80, 0x00,
-  0x1f, 0xff, 0xff, 0xc3, 0xff, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x1f, 0xff, 0x51, 0x00, 0x40, 0x00,
-  0x0f, 0xff, 0xff, 0xe7, 0xfe, 0xa0, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x00, 0x2f, 0xfe, 0xa0, 0x00, 0x30, 0x00,
-  0x0f, 0xff, 0xfe, 0xdf, 0xff, 0x55, 0x00, 0x00, 0x10, 0x00, 0x10, 0x01, 0x5f, 0xff, 0x51, 0x00, 0x0f, 0x40,
-  0x07, 0xff, 0xfe, 0x7f, 0xfe, 0xaa, 0xa8, 0x00, 0x20, 0x00, 0x00, 0x80, 0x4f, 0xfe, 0xa0, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xfe, 0x3f, 0xff, 0x55, 0x50, 0x00, 0x40, 0x00, 0x00, 0x01, 0xdf, 0xfd, 0x41, 0x00, 0x00, 0x00,
-  0x01, 0xff, 0xfe, 0x1f, 0xff, 0xaa, 0xa0, 0x01, 0x80, 0x40, 0x00, 0x80, 0xff, 0xba, 0xa2, 0x80, 0x00, 0x00,
-  0x00, 0xff, 0xfe, 0x1f, 0xff, 0xd5, 0x00, 0x03, 0x80, 0x00, 0x01, 0x00, 0xff, 0xc5, 0x41, 0x40, 0x00, 0x00,
-  0x00, 0x7f, 0xfc, 0x0f, 0xff, 0xfa, 0x00, 0x07, 0xe0, 0x00, 0x02, 0x80, 0xff, 0xfa, 0xa2, 0x80, 0x00, 0x00,
-  0x00, 0x7f, 0xfc, 0x0f, 0xff, 0xff, 0x80, 0x1f, 0xf0, 0x00, 0x01, 0x10, 0xf7, 0xfd, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xf8, 0x0f, 0xff, 0xff, 0xf0, 0x3f, 0xfc, 0x00, 0x02, 0xbb, 0xef, 0xfe, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xf8, 0x0f, 0xff, 0xff, 0xe0, 0x41, 0xff, 0x00, 0x05, 0x75, 0xff, 0xfd, 0x50, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xfc, 0x0f, 0xff, 0xe0, 0x40, 0x80, 0x07, 0x80, 0x02, 0xbb, 0xef, 0xfe, 0xa8, 0x00, 0x00, 0x80,
-  0x00, 0x3f, 0xfc, 0x0f, 0xf8, 0x01, 0x83, 0x00, 0x01, 0x00, 0x05, 0x75, 0xe7, 0xfd, 0x54, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xfe, 0x0f, 0xc0, 0x02, 0x04, 0x00, 0x02, 0x00, 0x0a, 0xab, 0xef, 0xfc, 0xaa, 0x00, 0x00, 0x80,
-  0x00, 0x0f, 0xfe, 0x0f, 0xe0, 0x04, 0x08, 0x00, 0x0c, 0x00, 0x05, 0x75, 0xd7, 0xf8, 0x54, 0x00, 0x00, 0x40,
-  0x30, 0x03, 0xfe, 0x07, 0xe0, 0x0c, 0x10, 0x00, 0x10, 0x00, 0x0a, 0xbb, 0xef, 0xf8, 0x2a, 0x00, 0x00, 0x80,
-  0x7f, 0x01, 0xff, 0x07, 0xf0, 0x18, 0x60, 0x00, 0x20, 0x00, 0x45, 0x77, 0xdf, 0xf0, 0x55, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0xff, 0x03, 0xe0, 0x38, 0xe0, 0x00, 0x40, 0x00, 0x0a, 0xff, 0xef, 0x88, 0x2a, 0x00, 0x00, 0xa0,
-  0x40, 0x00, 0x1f, 0x83, 0xf0, 0x75, 0xc8, 0x00, 0x80, 0x00, 0x45, 0xf7, 0xff, 0x70, 0x55, 0x00, 0x01, 0x40,
-  0xa0, 0x00, 0x1f, 0x81, 0xf9, 0xeb, 0xfe, 0x01, 0x20, 0x00, 0x0a, 0xfb, 0xef, 0xf8, 0xaa, 0x00, 0x02, 0x90,
-  0xb0, 0x00, 0x0f, 0xc1, 0xf7, 0x7f, 0xd0, 0x03, 0x10, 0x00, 0x45, 0xff, 0xff, 0xfe, 0x55, 0x00, 0x05, 0x50,
-  0xd8, 0x00, 0x07, 0xe0, 0xfe, 0x3f, 0x80, 0x0f, 0x10, 0x00, 0x2a, 0xff, 0xef, 0xff, 0xaa, 0x00, 0x2a, 0xb0,
-  0xe4, 0x00, 0x03, 0xf0, 0xfc, 0x37, 0xc0, 0x1f, 0x88, 0x00, 0x4d, 0xff, 0x7f, 0xff, 0xd5, 0x40, 0x44, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam6 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam6_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM7
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM7
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM7 uint8_t hammerbeam7_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xd7, 0xfa, 0xe1, 0xdf, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xc2, 0x00, 0x0b, 0xff, 0x55, 0xfd, 0xff, 0xff, 0x80, 0x0f, 0xaa, 0xef, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xb0,
-  0x80, 0x2a, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x2a, 0x27, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-  0xaa, 0x00, 0x2b, 0xfd, 0x75, 0x75, 0xe0, 0x00, 0x00, 0x87, 0xaa, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xe0, 0xd0,
-  0x00, 0xa2, 0x83, 0xff, 0xff, 0xff, 0x00, 0x00, 0xa8, 0x0f, 0x55, 0xff, 0xff, 0xff, 0xe3, 0xfe, 0xfb, 0xe0,
-  0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x20, 0x00, 0x02, 0xff, 0xab, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xe0, 0xe0,
-  0x7b, 0xfd, 0xfe, 0x3f, 0x00, 0x00, 0x10, 0x01, 0x55, 0xff, 0xd5, 0xff, 0xcf, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x47, 0xe1, 0xfe, 0x0f, 0x00, 0x00, 0x28, 0x00, 0x00, 0xff, 0xeb, 0xff, 0xcf, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x77, 0xfb, 0xfe, 0x02, 0x00, 0x00, 0x50, 0x00, 0x10, 0x7f, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x03, 0x83, 0xff, 0xff, 0xc0, 0x00, 0x20, 0x04, 0x05, 0x3b, 0xab, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7b, 0xfb, 0xfd, 0x5f, 0x7f, 0xe0, 0x10, 0x01, 0x50, 0x3d, 0x57, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x20, 0x04, 0x04, 0x6a, 0xaf, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xe0, 0xe0,
-  0x0a, 0x82, 0xaf, 0x7d, 0x78, 0x00, 0x00, 0x00, 0x01, 0x75, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x00, 0x00, 0x0d, 0xdf, 0xc0, 0x00, 0x20, 0x2a, 0xaa, 0xea, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x2a, 0x0a, 0x2f, 0xfd, 0xc0, 0x00, 0x00, 0x55, 0x55, 0x75, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x0d, 0x57, 0xc0, 0x00, 0x00, 0x02, 0xaa, 0xaa, 0xbf, 0xfa, 0xbf, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x50, 0x15, 0x75, 0x77, 0xf5, 0x5f, 0xff, 0xff, 0xce, 0xfc, 0xe0,
-  0x00, 0x7f, 0xfd, 0xd5, 0x48, 0x08, 0x00, 0x02, 0xaa, 0xba, 0xea, 0xea, 0xaf, 0xff, 0xff, 0xce, 0xe0, 0xe0,
-  0x2f, 0xff, 0xff, 0xff, 0xc4, 0x04, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0xd5, 0x7f, 0xfe, 0xff, 0xe0,
-  0x04, 0x00, 0x08, 0x04, 0x0a, 0x0a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xae, 0xaa, 0xaf, 0xfe, 0xe0, 0xe0,
-  0x7c, 0x03, 0xf8, 0xfc, 0x04, 0x05, 0x50, 0x00, 0x55, 0x55, 0x57, 0x55, 0x5d, 0x55, 0x57, 0xfe, 0xea, 0xe0,
-  0x7c, 0x00, 0x10, 0x04, 0x08, 0x0a, 0xa4, 0x05, 0x02, 0xaa, 0xae, 0xaa, 0xaa, 0xae, 0xab, 0xfe, 0xee, 0xe0,
-  0x7c, 0x00, 0x73, 0xf8, 0x00, 0x15, 0x50, 0x00, 0x51, 0x55, 0x55, 0x55, 0x55, 0x5d, 0x5d, 0xfe, 0xff, 0xe0,
-  0x1f, 0xff, 0x10, 0xf8, 0x08, 0xaa, 0xa5, 0x14, 0x04, 0x2a, 0xae, 0xaa, 0xaa, 0xaa, 0xba, 0xfe, 0xe0, 0xe0,
-  0x41, 0xdd, 0x08, 0x08, 0x00, 0x15, 0x50, 0x00, 0x10, 0x80, 0x5d, 0x55, 0x55, 0xdd, 0x55, 0x7e, 0xfa, 0xe0,
-  0x1f, 0xff, 0x78, 0xfc, 0x08, 0x0a, 0xa5, 0x41, 0x04, 0x2a, 0xae, 0xea, 0xaa, 0xbe, 0xba, 0xbe, 0xe4, 0xe0,
-  0x7f, 0x55, 0x08, 0x04, 0x00, 0x05, 0x40, 0x00, 0x41, 0x5d, 0x5d, 0xfd, 0x55, 0xdd, 0x5d, 0x5e, 0xff, 0xe0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x82, 0x91, 0x15, 0x02, 0xba, 0xab, 0xfe, 0xaa, 0xba, 0xbe, 0xbe, 0xe0, 0xe0,
-  0x2b, 0x75, 0xfd, 0x5f, 0xfa, 0xf1, 0x00, 0x00, 0x55, 0xf5, 0x5f, 0xfd, 0x55, 0xdd, 0x7d, 0x5e, 0xea, 0xe0,
-  0x0b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xaa, 0xaa, 0xeb, 0xea, 0xbf, 0xfe, 0xea, 0xfe, 0xba, 0xae, 0xe4, 0xe0,
-  0x03, 0xff, 0xff, 0x57, 0xea, 0xde, 0x01, 0x55, 0x7f, 0xf5, 0xdf, 0xff, 0xfd, 0xdf, 0x7d, 0x5e, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x14, 0x0a, 0xaf, 0xea, 0xbf, 0xfe, 0xfe, 0xff, 0xbe, 0xae, 0xe0, 0xe0,
-  0x00, 0x00, 0x07, 0x77, 0xee, 0xf7, 0xf1, 0x55, 0x5f, 0xf5, 0xdd, 0xff, 0xff, 0x5f, 0x7f, 0x5e, 0xea, 0xe0,
-  0x08, 0x00, 0x17, 0xfe, 0xbf, 0xff, 0xff, 0xaa, 0xbf, 0xea, 0xbf, 0xff, 0xff, 0xff, 0xbe, 0xae, 0xee, 0xe0,
-  0x0b, 0xe0, 0x50, 0x1f, 0xff, 0xd7, 0x00, 0x05, 0x5f, 0xd5, 0xdd, 0xff, 0xff, 0x5f, 0x75, 0x5e, 0xff, 0xe0,
-  0x28, 0x00, 0x07, 0xfa, 0xbe, 0xfe, 0x08, 0xa0, 0x0f, 0xaa, 0xee, 0xff, 0xff, 0xae, 0xba, 0xae, 0xe0, 0xe0,
-  0x2b, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x08, 0xa3, 0xd5, 0xdd, 0xff, 0xff, 0x5d, 0x75, 0x5e, 0xfa, 0xe0,
-  0x03, 0xff, 0xff, 0xea, 0xbe, 0xf0, 0x22, 0xa0, 0x09, 0xaa, 0xae, 0xff, 0xfe, 0xae, 0xba, 0xbe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0a, 0xa0, 0x55, 0x55, 0xff, 0xff, 0x5f, 0x55, 0x5e, 0xff, 0xe0,
-  0x7f, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x2a, 0x80, 0x09, 0x2a, 0xaf, 0xff, 0xff, 0xbe, 0xaa, 0xbe, 0xe0, 0xe0,
-  0x7f, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x80, 0x00, 0x15, 0xf7, 0xff, 0x5d, 0x55, 0x7e, 0xfc, 0xe0,
-  0x00, 0x7f, 0xc0, 0x00, 0x20, 0x00, 0x28, 0x00, 0x09, 0x2a, 0xaf, 0xfb, 0xfe, 0xae, 0xaa, 0xff, 0x60, 0xe0,
-  0x7f, 0xff, 0xc0, 0x00, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x55, 0x5f, 0xfd, 0xfd, 0xdd, 0x55, 0xff, 0x7f, 0xe0,
-  0x7f, 0xc3, 0x00, 0x00, 0x20, 0x00, 0x0a, 0x20, 0x09, 0xaa, 0xaf, 0xfe, 0xfb, 0xaa, 0xab, 0xff, 0xbf, 0xe0,
-  0x78, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x55, 0x5f, 0xff, 0x75, 0x55, 0x57, 0xff, 0xcf, 0xe0,
-  0x7f, 0xc6, 0x08, 0x00, 0x20, 0x02, 0x22, 0xa0, 0x0f, 0xaa, 0xaf, 0xff, 0xab, 0xaa, 0xaf, 0xff, 0xf0, 0xa0,
-  0x7f, 0xc6, 0x00, 0x10, 0x10, 0x00, 0x00, 0x05, 0xff, 0xd5, 0x7f, 0xff, 0x57, 0x55, 0x7f, 0xff, 0xff, 0xe0,
-  0x7f, 0xc6, 0x08, 0x08, 0x00, 0x0a, 0xaf, 0xeb, 0xff, 0xaa, 0xaf, 0xff, 0xab, 0xfa, 0xef, 0xff, 0xff, 0xe0,
-  0x40, 0x0a, 0x14, 0x04, 0x00, 0x15, 0x57, 0xd7, 0xdd, 0xd5, 0x77, 0xff, 0x57, 0x7d, 0x5f, 0xff, 0xff, 0xe0,
-  0x50, 0x0c, 0x08, 0x02, 0x80, 0x00, 0xaf, 0xeb, 0xff, 0xea, 0xaf, 0xfe, 0xaf, 0xbe, 0xaf, 0xff, 0xff, 0xe0,
-  0x7c, 0x04, 0x15, 0x05, 0x54, 0x28, 0x07, 0xd7, 0xfd, 0xd5, 0x77, 0x7d, 0x57, 0xff, 0x5f, 0xff, 0xff, 0xe0,
-  0x7c, 0x06, 0x0a, 0x8a, 0xaa, 0x00, 0xae, 0xaf, 0xfe, 0xea, 0xaf, 0xaa, 0xaf, 0xfe, 0xaf, 0xff, 0xff, 0xe0,
-  0x5c, 0x06, 0x15, 0x45, 0x55, 0x55, 0x57, 0xdf, 0xfd, 0xd5, 0x77, 0x55, 0x5f, 0xff, 0x5f, 0xff, 0xff, 0xe0,
-  0x5c, 0x03, 0x0a, 0x0a, 0xaa, 0xaa, 0xae, 0xbf, 0xfb, 0xea, 0xff, 0xaa, 0xaf, 0xfe, 0xaf, 0xff, 0xff, 0xe0,
-  0x7c, 0x02, 0x94, 0x45, 0x55, 0x00, 0x00, 0x07, 0xfd, 0xd5, 0x77, 0xd5, 0x5f, 0xfd, 0x5f, 0xfd, 0xff, 0xe0,
-  0x78, 0x01, 0xaa, 0xa2, 0xaa, 0x10, 0x08, 0x87, 0xff, 0xea, 0xfb, 0xaa, 0xaf, 0xfe, 0xbf, 0xf8, 0xff, 0xe0,
-  0x58, 0x03, 0xd5, 0x51, 0x54, 0x00, 0x00, 0x17, 0xfd, 0xd5, 0x77, 0xd5, 0x5f, 0xff, 0x5f, 0xfd, 0xff, 0xe0,
-  0x43, 0xff, 0xea, 0xaa, 0x80, 0x40, 0xa8, 0xb7, 0xff, 0xea, 0xbb, 0xaa, 0xaf, 0xfe, 0xbf, 0xff, 0xff, 0xe0,
-  0x7f, 0xfe, 0x95, 0x54, 0x00, 0x00, 0x00, 0x17, 0xbf, 0xd5, 0x75, 0xd5, 0x5f, 0x7d, 0x7f, 0xff, 0xff, 0xe0,
-  0x7c, 0x02, 0xaa, 0xa8, 0x00, 0x02, 0x8a, 0x37, 0xff, 0xea, 0xab, 0xaa, 0xaf, 0xba, 0xff, 0xff, 0xff, 0xe0,
-  0x60, 0x03, 0x15, 0x50, 0x00, 0x00, 0x00, 0x37, 0xff, 0xd5, 0x55, 0xd5, 0x5f, 0x55, 0xff, 0xff, 0xff, 0xe0,
-  0x60, 0x02, 0x0a, 0x20, 0x00, 0x00, 0x02, 0x87, 0xff, 0xea, 0xaa, 0xea, 0xae, 0xab, 0xff, 0xff, 0xff, 0xe0,
-  0xa0, 0x06, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xf5, 0x55, 0x57, 0x57, 0x57, 0xff, 0xff, 0xff, 0xd0,
-  0xac, 0x04, 0x0a, 0x80, 0x00, 0x00, 0xaa, 0xaa, 0xfd, 0xea, 0xaa, 0xae, 0xae, 0xaf, 0xff, 0xff, 0xff, 0xd0,
-  0xdc, 0x04, 0x15, 0x01, 0x00, 0x00, 0x55, 0x57, 0x78, 0xf5, 0x55, 0x5f, 0xd7, 0x7f, 0xff, 0xff, 0xff, 0xb0,
-  0xe6, 0x04, 0x0a, 0x82, 0x00, 0x00, 0x00, 0xae, 0xbd, 0xeb, 0xaa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam7 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam7_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM8
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM8
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM8 uint8_t hammerbeam8_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe2, 0x00, 0x08, 0xab, 0xfa, 0xc1, 0x80, 0xaa, 0xaa, 0xa8, 0x20, 0x82, 0xaa, 0xaa, 0xff, 0xff, 0xfe, 0x70,
-  0xc4, 0x00, 0x05, 0x55, 0xfd, 0x62, 0x00, 0x55, 0x55, 0x50, 0x50, 0x01, 0x55, 0x55, 0xff, 0xfe, 0xff, 0xb0,
-  0x80, 0x02, 0x08, 0xea, 0xfe, 0xe4, 0x00, 0xaa, 0xaa, 0xa8, 0x80, 0x82, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xd0,
-  0x84, 0x01, 0x14, 0xf5, 0xff, 0x60, 0x00, 0x55, 0x55, 0x54, 0x00, 0x05, 0x55, 0x55, 0x7f, 0xfe, 0xe0, 0xd0,
-  0x0a, 0x00, 0x2a, 0xfa, 0xfe, 0xb0, 0x00, 0xaa, 0xaa, 0xa8, 0x82, 0x82, 0xaa, 0xaa, 0xff, 0xfe, 0xfb, 0xe0,
-  0x15, 0x01, 0x15, 0xff, 0x7f, 0x50, 0x00, 0x55, 0x55, 0x54, 0x40, 0x05, 0x55, 0x55, 0x7f, 0xfe, 0xe0, 0xe0,
-  0x0a, 0x00, 0x8a, 0x7f, 0xbf, 0xb0, 0x00, 0xaa, 0x8a, 0xaa, 0x20, 0x0a, 0xaa, 0xaa, 0xff, 0xfe, 0xff, 0xe0,
-  0x14, 0x10, 0x54, 0x3f, 0xdf, 0xd0, 0x01, 0x55, 0x55, 0x54, 0x40, 0x15, 0x55, 0x55, 0x7f, 0xfe, 0xe0, 0xe0,
-  0x08, 0x00, 0xaa, 0x1f, 0xaf, 0xb8, 0x00, 0xaa, 0x8a, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xfe, 0xfe, 0xfa, 0xe0,
-  0x04, 0x40, 0x55, 0x1f, 0xdf, 0xd8, 0x01, 0x55, 0x45, 0x54, 0x44, 0x55, 0x55, 0x55, 0xff, 0xfe, 0xe0, 0xe0,
-  0x08, 0x00, 0xaa, 0x1f, 0xef, 0xe8, 0x02, 0xaa, 0x8a, 0xaa, 0x08, 0x2a, 0xaa, 0xaa, 0xfe, 0xfe, 0xff, 0xe0,
-  0x00, 0x01, 0x55, 0x0f, 0xf7, 0xd8, 0x01, 0x55, 0x45, 0x55, 0x40, 0x55, 0x55, 0x55, 0xfd, 0xfe, 0xe0, 0xe0,
-  0x08, 0x02, 0xaa, 0x0f, 0xff, 0xe8, 0x00, 0xaa, 0x82, 0xaa, 0x28, 0xaa, 0xaa, 0xab, 0xfe, 0xee, 0xfc, 0xe0,
-  0x00, 0x41, 0x54, 0x07, 0xff, 0xf8, 0x00, 0x55, 0x40, 0x55, 0x01, 0x55, 0x55, 0x55, 0xfd, 0x7e, 0xe0, 0xe0,
-  0x08, 0x82, 0xa0, 0x07, 0xff, 0xe8, 0x00, 0xaa, 0x80, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xae, 0xff, 0xe0,
-  0x00, 0x05, 0x50, 0x07, 0xff, 0xf8, 0x00, 0x55, 0x00, 0x15, 0x15, 0x55, 0x55, 0x55, 0x7d, 0x76, 0xe0, 0xe0,
-  0x08, 0x0a, 0xa0, 0x03, 0xff, 0xf8, 0x00, 0xaa, 0x82, 0x0a, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xea, 0xfc, 0xe0,
-  0x04, 0x55, 0x50, 0x11, 0xff, 0xf0, 0x00, 0x15, 0x01, 0x15, 0x15, 0x55, 0x55, 0x55, 0x7f, 0xf6, 0xe0, 0xe0,
-  0x02, 0xaa, 0xa0, 0x22, 0xff, 0xf0, 0x00, 0x0a, 0x8a, 0x0a, 0x8a, 0xaa, 0xaa, 0xaa, 0xbe, 0xee, 0xff, 0xe0,
-  0x05, 0x55, 0x40, 0x01, 0x7f, 0xe0, 0x00, 0x05, 0x11, 0x15, 0x55, 0x55, 0x55, 0x55, 0x7f, 0x7e, 0xe0, 0xe0,
-  0x0a, 0xaa, 0x80, 0x20, 0xff, 0xe4, 0x00, 0x02, 0x80, 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf, 0xfe, 0xea, 0xe0,
-  0x15, 0x55, 0x40, 0x40, 0x7f, 0xe2, 0x00, 0x11, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7f, 0xfe, 0xee, 0xe0,
-  0x2a, 0xaa, 0x80, 0x20, 0x3f, 0xc2, 0x00, 0x22, 0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbf, 0xfe, 0xff, 0xe0,
-  0x55, 0x55, 0x40, 0x50, 0x1f, 0xc2, 0x00, 0x01, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7f, 0xfe, 0xe0, 0xe0,
-  0x2a, 0xa2, 0xa0, 0x28, 0x0f, 0x81, 0x00, 0x20, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xfe, 0xfa, 0xe0,
-  0x55, 0x51, 0x40, 0x50, 0x17, 0x80, 0xc0, 0x10, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x77, 0xfe, 0xe4, 0xe0,
-  0x2a, 0xa0, 0xa0, 0x20, 0x0b, 0x80, 0x20, 0x28, 0xaa, 0x82, 0xaa, 0xaa, 0xaa, 0x8a, 0xeb, 0xfe, 0xff, 0xe0,
-  0x15, 0x40, 0x40, 0x50, 0x01, 0x80, 0x10, 0x10, 0x54, 0x01, 0x05, 0x55, 0x55, 0x15, 0x55, 0xfe, 0xe0, 0xe0,
-  0x2a, 0x80, 0xb0, 0x20, 0x00, 0xc0, 0x60, 0x20, 0x20, 0x02, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xea, 0xe0,
-  0x15, 0x00, 0x50, 0x40, 0x05, 0x40, 0x80, 0x10, 0x40, 0x01, 0x00, 0x55, 0x55, 0x15, 0x55, 0xfe, 0xe4, 0xe0,
-  0x08, 0x00, 0x08, 0x20, 0x08, 0xa1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2a, 0xaa, 0xa2, 0xaa, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x18, 0x00, 0x10, 0x52, 0x00, 0x10, 0x40, 0x01, 0x00, 0x15, 0x55, 0x01, 0x55, 0x7e, 0xe0, 0xe0,
-  0x0a, 0x00, 0x0c, 0x20, 0x08, 0x30, 0x00, 0x08, 0x00, 0x00, 0x02, 0x2a, 0xaa, 0x20, 0xaa, 0xfe, 0xea, 0xe0,
-  0x15, 0x00, 0x44, 0x10, 0x14, 0x18, 0x00, 0x00, 0x40, 0x40, 0x04, 0x55, 0x55, 0x00, 0x55, 0x7e, 0xee, 0xe0,
-  0x0a, 0x80, 0x02, 0x00, 0x28, 0x78, 0x00, 0x00, 0x20, 0x00, 0x00, 0x8a, 0xaa, 0x00, 0x2b, 0xfe, 0xff, 0xe0,
-  0x55, 0x00, 0x45, 0x00, 0x14, 0xf0, 0x00, 0x00, 0x50, 0x40, 0x04, 0x01, 0x51, 0x00, 0x57, 0x5e, 0xe0, 0xe0,
-  0x0a, 0x80, 0x22, 0x80, 0x2b, 0xf0, 0x00, 0x00, 0x20, 0x20, 0x00, 0x02, 0xaa, 0x00, 0xaa, 0xae, 0xfa, 0xe0,
-  0x55, 0x00, 0x41, 0x40, 0x15, 0xe2, 0x00, 0x00, 0x00, 0x44, 0x04, 0x01, 0x51, 0x05, 0x55, 0x56, 0xe0, 0xe0,
-  0x0a, 0x80, 0x20, 0xb8, 0x6b, 0xe1, 0x00, 0x00, 0x20, 0xa8, 0x02, 0x00, 0xa8, 0x08, 0xaa, 0xaa, 0xff, 0xe0,
-  0x45, 0x00, 0x40, 0x7c, 0xf5, 0xc0, 0xc0, 0x00, 0x00, 0x55, 0x04, 0x01, 0x51, 0x00, 0x15, 0x54, 0xe0, 0xe0,
-  0x2a, 0x00, 0x00, 0xff, 0xbb, 0xc0, 0x20, 0x00, 0x20, 0xaa, 0x82, 0x00, 0xa8, 0x00, 0x0a, 0xaa, 0xfc, 0xe0,
-  0x54, 0x00, 0x05, 0xf5, 0x55, 0xe0, 0x40, 0x80, 0x10, 0x55, 0x45, 0x00, 0x55, 0x00, 0x15, 0x55, 0x60, 0xe0,
-  0x08, 0x00, 0x0b, 0xea, 0xbb, 0xa0, 0x80, 0x00, 0x02, 0xaa, 0xa2, 0x00, 0xa8, 0x00, 0x0a, 0xaa, 0x7f, 0xe0,
-  0x40, 0x00, 0x17, 0xf5, 0x37, 0x50, 0x80, 0x00, 0x00, 0x55, 0x44, 0x00, 0x55, 0x00, 0x05, 0x55, 0x3f, 0xe0,
-  0x28, 0x00, 0x2f, 0xea, 0x2e, 0xa9, 0x00, 0x00, 0x02, 0x2a, 0x82, 0x00, 0xaa, 0x80, 0x0a, 0xaa, 0x8f, 0xe0,
-  0x54, 0x00, 0x5f, 0xd4, 0x7d, 0x54, 0x08, 0x00, 0x01, 0x51, 0x00, 0x00, 0x55, 0x00, 0x15, 0x55, 0x70, 0xa0,
-  0x2a, 0x02, 0xbf, 0xa8, 0x7f, 0xae, 0x10, 0x00, 0x02, 0x28, 0x28, 0x00, 0xaa, 0x80, 0x02, 0xaa, 0xbf, 0xe0,
-  0x55, 0x15, 0x7f, 0x50, 0x7f, 0xd6, 0x08, 0x08, 0x00, 0x55, 0x54, 0x00, 0x55, 0x00, 0x01, 0x55, 0x7f, 0xe0,
-  0x2a, 0x2a, 0xfe, 0x80, 0xff, 0xeb, 0x00, 0x08, 0x02, 0x2a, 0x2a, 0x00, 0xaa, 0x80, 0x02, 0xaa, 0xbf, 0xe0,
-  0x55, 0x55, 0xff, 0x00, 0xef, 0xf5, 0x00, 0x10, 0x01, 0x55, 0x55, 0x01, 0x55, 0x11, 0x05, 0x55, 0x7f, 0xe0,
-  0x2a, 0xaa, 0xfe, 0x09, 0xef, 0xfb, 0x00, 0x08, 0x00, 0x2a, 0xaa, 0x00, 0xaa, 0x88, 0x8a, 0xaa, 0xff, 0xe0,
-  0x15, 0x55, 0xfc, 0x11, 0xf7, 0xf5, 0x02, 0x08, 0x05, 0x15, 0x55, 0x01, 0x55, 0x00, 0x15, 0x55, 0x7f, 0xe0,
-  0x2a, 0xab, 0xfc, 0x01, 0xf7, 0xfb, 0x00, 0x00, 0x00, 0x8a, 0xaa, 0x02, 0xaa, 0x88, 0xaa, 0xaa, 0xff, 0xe0,
-  0x15, 0x57, 0xf8, 0x13, 0xf7, 0xfd, 0x80, 0x00, 0x00, 0x05, 0x54, 0x01, 0x55, 0x05, 0x55, 0x55, 0xff, 0xe0,
-  0x2a, 0xbf, 0xf0, 0x0b, 0xfb, 0xff, 0x80, 0x00, 0x00, 0x02, 0x28, 0x02, 0xaa, 0x8a, 0xaa, 0xab, 0xff, 0xe0,
-  0x15, 0x7f, 0xf0, 0x17, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x11, 0x00, 0x05, 0x55, 0x45, 0x55, 0x57, 0xff, 0xe0,
-  0x2a, 0xff, 0xe0, 0x0b, 0xfb, 0xff, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0a, 0xaa, 0x8a, 0x2a, 0xaf, 0xff, 0xe0,
-  0x15, 0x7f, 0xe0, 0x17, 0xfd, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x44, 0x55, 0x57, 0xdf, 0xe0,
-  0x2a, 0xff, 0xc0, 0x0b, 0xfd, 0xff, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x2a, 0xaa, 0xaa, 0xaa, 0xab, 0xff, 0xe0,
-  0x55, 0x76, 0x80, 0x17, 0xfe, 0xfe, 0x08, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x44, 0x15, 0x57, 0xdf, 0xe0,
-  0x2a, 0xf8, 0x00, 0x0b, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x08, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0xab, 0xef, 0xe0,
-  0x55, 0x74, 0x00, 0x15, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x44, 0x15, 0x57, 0xdf, 0xe0,
-  0xaa, 0xe8, 0x00, 0x2b, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x08, 0x22, 0xaa, 0xaa, 0xa2, 0x2a, 0xab, 0xef, 0xd0,
-  0x95, 0xe5, 0x00, 0x35, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x05, 0x51, 0x55, 0x55, 0x51, 0x55, 0x57, 0xdf, 0xd0,
-  0xcb, 0xea, 0x80, 0x6f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x0a, 0xa0, 0xaa, 0xaa, 0xaa, 0x2a, 0xaf, 0xbf, 0xb0,
-  0xe5, 0xc5, 0x00, 0x77, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x05, 0x41, 0x55, 0x55, 0x55, 0x55, 0x57, 0xde, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam8 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam8_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM9
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM9
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM9 uint8_t hammerbeam9_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0xd7, 0x55, 0xc0, 0x00, 0x00, 0x00, 0x51, 0x55, 0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x70,
-  0xcb, 0xab, 0xaa, 0xf0, 0x00, 0x00, 0x20, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0x80, 0x20, 0x20, 0x00, 0xff, 0xb0,
-  0x97, 0xd5, 0xd5, 0x58, 0x00, 0x04, 0x15, 0x51, 0x54, 0x54, 0x04, 0x01, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd0,
-  0xab, 0xea, 0xfa, 0xae, 0x00, 0x00, 0x0a, 0xa8, 0xaa, 0x20, 0x0a, 0x00, 0x00, 0x20, 0x20, 0x08, 0xe0, 0xd0,
-  0x57, 0xf5, 0x7d, 0x5f, 0x00, 0x04, 0x05, 0x51, 0x54, 0x00, 0x04, 0x01, 0x40, 0x00, 0x10, 0x10, 0xfb, 0xe0,
-  0x7e, 0xfe, 0xbf, 0xff, 0x80, 0x02, 0x8a, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xa0, 0x20, 0x00, 0x00, 0xe0, 0xe0,
-  0x7d, 0x7f, 0x5f, 0xfe, 0x00, 0x05, 0x45, 0x51, 0x54, 0x00, 0x04, 0x01, 0x40, 0x10, 0x00, 0x10, 0xff, 0xe0,
-  0x7a, 0xbf, 0xaf, 0xf8, 0x00, 0x02, 0x82, 0xaa, 0xa8, 0x00, 0x00, 0x02, 0x80, 0x20, 0x00, 0x00, 0xe0, 0xe0,
-  0x75, 0x7f, 0xf7, 0xe0, 0x00, 0x05, 0x45, 0x51, 0x54, 0x10, 0x04, 0x01, 0x00, 0x10, 0x00, 0x10, 0xfa, 0xe0,
-  0x6a, 0xbf, 0xfb, 0x80, 0x00, 0x0a, 0x82, 0xaa, 0xa8, 0x00, 0x00, 0x12, 0x00, 0x20, 0x00, 0x20, 0xe0, 0xe0,
-  0x75, 0x5f, 0xfe, 0x00, 0x00, 0x04, 0x05, 0x11, 0x50, 0x10, 0x00, 0x11, 0x00, 0x10, 0x00, 0x10, 0xff, 0xe0,
-  0x7a, 0xaf, 0xfc, 0x00, 0x00, 0x0a, 0x02, 0x88, 0x80, 0x00, 0x00, 0x20, 0x80, 0x20, 0x00, 0x28, 0xe0, 0xe0,
-  0x7d, 0x5f, 0xf8, 0x40, 0x00, 0x04, 0x05, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0xfc, 0xe0,
-  0x7a, 0xaf, 0xf8, 0x20, 0x00, 0x02, 0x02, 0x88, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x00, 0x28, 0xe0, 0xe0,
-  0x7d, 0x57, 0xf0, 0x20, 0x00, 0x04, 0x05, 0x10, 0x12, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x10, 0xff, 0xe0,
-  0x7a, 0xab, 0xf0, 0x18, 0x04, 0x02, 0x0a, 0x08, 0x00, 0xe0, 0x00, 0x00, 0x80, 0x00, 0x36, 0x08, 0xe0, 0xe0,
-  0x7d, 0x55, 0xf0, 0x04, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x10, 0xfc, 0xe0,
-  0x3e, 0xab, 0xb8, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x18, 0x08, 0xe0, 0xe0,
-  0x7f, 0x55, 0xdc, 0x10, 0x00, 0x00, 0x14, 0x02, 0x10, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x38, 0x10, 0xff, 0xe0,
-  0x3e, 0xaa, 0xfe, 0x10, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xed, 0xb8, 0x28, 0x00, 0xe0, 0xe0,
-  0x5f, 0x55, 0x5f, 0x20, 0x00, 0x00, 0x40, 0x02, 0x10, 0x40, 0x00, 0x03, 0x55, 0x56, 0x44, 0x10, 0xea, 0xe0,
-  0x2f, 0xaa, 0xef, 0x00, 0x08, 0x00, 0x88, 0x00, 0x00, 0x18, 0x00, 0x06, 0xad, 0xab, 0x00, 0x00, 0xee, 0xe0,
-  0x55, 0x57, 0x75, 0x80, 0x00, 0x05, 0x54, 0x00, 0x10, 0x07, 0xf8, 0x1d, 0x55, 0x55, 0x80, 0x00, 0xff, 0xe0,
-  0x2a, 0xab, 0xbb, 0x81, 0x08, 0x02, 0xaa, 0x00, 0x08, 0x00, 0x07, 0xfa, 0xbf, 0xea, 0xc0, 0x00, 0xe0, 0xe0,
-  0x55, 0x55, 0x55, 0xc0, 0x04, 0x01, 0x55, 0x00, 0x00, 0x00, 0x01, 0xbd, 0xc5, 0x1d, 0x60, 0x00, 0xfa, 0xe0,
-  0x2a, 0xab, 0xaa, 0xc0, 0x08, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x02, 0x7e, 0x05, 0x03, 0xb0, 0x00, 0xe4, 0xe0,
-  0x55, 0x55, 0xd5, 0x60, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0c, 0x7c, 0x05, 0x00, 0xd0, 0x00, 0xff, 0xe0,
-  0x6a, 0xea, 0xea, 0xa0, 0x08, 0x20, 0x2a, 0x80, 0x80, 0x00, 0x30, 0xea, 0x05, 0x00, 0x28, 0x00, 0xe0, 0xe0,
-  0x75, 0x75, 0x75, 0x70, 0x04, 0x40, 0x15, 0x40, 0x30, 0x00, 0xc3, 0xd4, 0x05, 0x00, 0x18, 0x00, 0xea, 0xe0,
-  0x7a, 0xea, 0xfa, 0xb8, 0x00, 0x22, 0x0a, 0x80, 0x0f, 0x0b, 0xfc, 0xab, 0xff, 0xfc, 0x08, 0x02, 0xe4, 0xe0,
-  0x75, 0x75, 0x7d, 0x5c, 0x00, 0x00, 0x15, 0x40, 0x00, 0xff, 0x01, 0xdf, 0x55, 0x57, 0xcc, 0x04, 0xff, 0xe0,
-  0x3a, 0xba, 0xbe, 0xaf, 0x00, 0x00, 0x0a, 0x80, 0x00, 0xb8, 0x7f, 0xff, 0xad, 0xaa, 0xbc, 0x00, 0xe0, 0xe0,
-  0x7d, 0x75, 0x5f, 0x55, 0xe0, 0x00, 0x05, 0x00, 0x00, 0xbc, 0x21, 0xff, 0xd5, 0x55, 0x54, 0x04, 0xea, 0xe0,
-  0x3e, 0xba, 0xaf, 0xaa, 0xf0, 0x00, 0x0a, 0x00, 0x40, 0xaf, 0xb0, 0xff, 0xad, 0xaa, 0xac, 0x00, 0xee, 0xe0,
-  0x7d, 0x7d, 0x5f, 0xd5, 0x5c, 0x00, 0x04, 0x00, 0x18, 0xbd, 0xa1, 0xff, 0xd5, 0x55, 0x54, 0x04, 0xff, 0xe0,
-  0x3e, 0xba, 0xaf, 0xfa, 0xb8, 0x00, 0x0a, 0x00, 0x07, 0xa8, 0x7f, 0xff, 0xed, 0xaa, 0xbc, 0x0a, 0xe0, 0xe0,
-  0x5f, 0x5d, 0x57, 0xff, 0xe0, 0x00, 0x45, 0x04, 0x00, 0xff, 0x01, 0xdf, 0xf5, 0x57, 0xcc, 0x04, 0xfa, 0xe0,
-  0x2f, 0xbe, 0xab, 0xff, 0xc0, 0x00, 0x4a, 0x80, 0x00, 0x0b, 0xfc, 0xab, 0xff, 0xfc, 0x08, 0x02, 0xe0, 0xe0,
-  0x57, 0x5d, 0x55, 0xff, 0x80, 0x00, 0x95, 0x44, 0x00, 0x00, 0xc3, 0xd5, 0x55, 0x00, 0x18, 0x04, 0xff, 0xe0,
-  0x2b, 0xbe, 0xaa, 0xbf, 0x00, 0x00, 0x4a, 0x88, 0x00, 0x00, 0x30, 0xaa, 0xad, 0x00, 0x28, 0x00, 0xe0, 0xe0,
-  0x17, 0xdf, 0x55, 0x5e, 0x00, 0x00, 0x55, 0x44, 0x00, 0x20, 0x08, 0x7d, 0x55, 0x00, 0xd0, 0x04, 0xfc, 0xe0,
-  0x2b, 0xee, 0xaa, 0xf8, 0x00, 0x02, 0x2a, 0x88, 0x00, 0x0f, 0x06, 0x7e, 0xaf, 0x83, 0xb2, 0x00, 0x60, 0xe0,
-  0x15, 0xd7, 0x55, 0xf0, 0x00, 0x01, 0x55, 0x44, 0x00, 0x00, 0xfd, 0xbf, 0xd5, 0x5d, 0x60, 0x00, 0x7f, 0xe0,
-  0x2a, 0xef, 0xef, 0xe0, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x03, 0xff, 0xff, 0xea, 0xc2, 0x00, 0x3f, 0xe0,
-  0x35, 0xf7, 0xff, 0xc8, 0x10, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x1f, 0xfd, 0xfd, 0x80, 0x00, 0x0f, 0xe0,
-  0x3e, 0xfb, 0xff, 0x84, 0x00, 0x08, 0xaa, 0xaa, 0x08, 0x00, 0x00, 0x07, 0xff, 0xff, 0x02, 0x00, 0x00, 0xa0,
-  0x7d, 0x7f, 0xff, 0x84, 0x00, 0x01, 0x55, 0x55, 0x03, 0xe0, 0x00, 0x03, 0xfd, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x7e, 0xbf, 0xff, 0x82, 0x00, 0x00, 0xa2, 0xaa, 0x00, 0x1f, 0xff, 0xe0, 0xff, 0xf8, 0x02, 0x00, 0x00, 0x00,
-  0x7f, 0x5f, 0xff, 0x01, 0x00, 0x01, 0x51, 0x55, 0x40, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x01, 0x00, 0x00, 0x00,
-  0x3f, 0xbf, 0xff, 0x06, 0x01, 0x00, 0xa2, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x7f, 0x5d, 0xfe, 0x08, 0x02, 0x00, 0x55, 0x55, 0x41, 0x00, 0x00, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x3f, 0xae, 0xfe, 0x00, 0x01, 0x00, 0x2a, 0xaa, 0xa2, 0x00, 0x00, 0x60, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x5f, 0xd7, 0x7c, 0x00, 0x00, 0x00, 0x15, 0x55, 0x51, 0x00, 0x00, 0xd8, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
-  0x2f, 0xeb, 0xbc, 0x00, 0x00, 0x00, 0x2a, 0xaa, 0xa2, 0x00, 0x00, 0xe0, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,
-  0x55, 0xf5, 0x5e, 0x00, 0x00, 0x01, 0x15, 0x55, 0x50, 0x00, 0x01, 0x40, 0x01, 0x04, 0x04, 0x00, 0x00, 0x00,
-  0x2a, 0xea, 0xae, 0x00, 0x00, 0x02, 0x0a, 0xaa, 0xa2, 0x00, 0x00, 0x40, 0x02, 0x06, 0x02, 0x00, 0x00, 0x00,
-  0x55, 0x55, 0x57, 0x00, 0x20, 0x00, 0x05, 0x55, 0x50, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xaa, 0xab, 0x80, 0x00, 0x02, 0x2a, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00,
-  0x55, 0x55, 0x55, 0xc0, 0x00, 0x00, 0x41, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xaa, 0xaa, 0xf0, 0x00, 0x02, 0x00, 0xaa, 0xa0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x15, 0x55, 0x55, 0x58, 0x00, 0x05, 0x00, 0x55, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xaa, 0xaa, 0xac, 0x00, 0x02, 0x00, 0x2a, 0xa0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x95, 0x55, 0x57, 0xf8, 0x00, 0x04, 0x00, 0x15, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x82, 0xea, 0xbf, 0xe0, 0x00, 0x22, 0x00, 0x2a, 0xaa, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0xc1, 0xff, 0xff, 0xc0, 0x00, 0x05, 0x00, 0x15, 0x45, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0xe3, 0xff, 0xff, 0x80, 0x00, 0x22, 0x80, 0x0a, 0x8a, 0xa8, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam9 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam9_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM10
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM10
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM10 uint8_t hammerbeam10_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0xd7, 0x7d, 0x7f, 0xf5, 0xd5, 0x55, 0x45, 0xdf, 0x35, 0x50, 0xff, 0xff, 0xfe, 0xf5, 0x31, 0xfe, 0x70,
-  0xdf, 0xaa, 0xae, 0xbf, 0xfb, 0xaa, 0xaa, 0xa2, 0xaf, 0x3a, 0xa0, 0x7f, 0xff, 0xff, 0x72, 0xb0, 0xff, 0xb0,
-  0xbf, 0x75, 0x5f, 0x5f, 0xf7, 0x55, 0x55, 0x01, 0x41, 0x95, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xd0,
-  0xbf, 0xea, 0xff, 0xaf, 0xeb, 0xaa, 0xaa, 0x00, 0xa0, 0x9a, 0xa0, 0x3f, 0xff, 0xff, 0xfb, 0xea, 0xe0, 0xd0,
-  0x7f, 0xd5, 0xff, 0xd7, 0xf7, 0x55, 0x55, 0x04, 0x50, 0x4d, 0x51, 0x1f, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xe0,
-  0x7f, 0xeb, 0xaa, 0xfb, 0xef, 0xaa, 0xaa, 0x03, 0xac, 0x2d, 0xe0, 0xaf, 0xff, 0xff, 0xfe, 0xfe, 0xe0, 0xe0,
-  0x5f, 0xd7, 0xd5, 0x7d, 0xdf, 0x55, 0x54, 0x01, 0xd7, 0x0f, 0xf8, 0x57, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xe0,
-  0x5b, 0xbf, 0xaa, 0xab, 0xaf, 0xaa, 0xa8, 0x00, 0xeb, 0x8f, 0xfc, 0xeb, 0xff, 0xff, 0xff, 0xbe, 0xe0, 0xe0,
-  0x0b, 0xff, 0x75, 0x57, 0xdf, 0xd5, 0x50, 0x00, 0x77, 0xcf, 0xfc, 0x7d, 0xff, 0xff, 0xff, 0x5e, 0xfa, 0xe0,
-  0x03, 0xff, 0xea, 0xaf, 0xbf, 0xea, 0xa8, 0x80, 0x3b, 0xe7, 0xfe, 0xbe, 0xff, 0xff, 0xff, 0xae, 0xe0, 0xe0,
-  0x01, 0x6f, 0xdd, 0x5f, 0x5f, 0xf5, 0x50, 0x40, 0x15, 0xe3, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xde, 0xff, 0xe0,
-  0x00, 0x2d, 0xfb, 0xaf, 0xbe, 0xea, 0xa0, 0x22, 0x0a, 0xf9, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xee, 0xe0, 0xe0,
-  0x20, 0x05, 0x7f, 0x5f, 0x7f, 0x75, 0x40, 0x51, 0x05, 0xfe, 0xff, 0x57, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x74, 0x00, 0x5f, 0xbe, 0xff, 0x3a, 0xa0, 0x20, 0x92, 0xff, 0xff, 0x2b, 0xff, 0xff, 0xef, 0xfe, 0xe0, 0xe0,
-  0x7f, 0x80, 0x03, 0x7f, 0x7f, 0x9d, 0x50, 0x01, 0x48, 0x7f, 0xff, 0x55, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0xe0,
-  0x50, 0x00, 0xbe, 0xbe, 0xff, 0x9e, 0xa0, 0x20, 0xa8, 0x3f, 0x7e, 0x2a, 0xf8, 0xfe, 0x23, 0xfe, 0xe0, 0xe0,
-  0x00, 0x01, 0xff, 0x7f, 0xff, 0xcf, 0x50, 0x00, 0x54, 0x3f, 0x9f, 0x15, 0xfc, 0x5c, 0x51, 0xfe, 0xfc, 0xe0,
-  0x00, 0x4d, 0xfe, 0xfb, 0xff, 0xee, 0xa8, 0x00, 0x20, 0x9f, 0xcf, 0x82, 0xf8, 0x3f, 0xa9, 0xfe, 0xe0, 0xe0,
-  0x0a, 0xdf, 0xfd, 0xfd, 0xff, 0xe7, 0xd4, 0x00, 0x51, 0x4f, 0xc7, 0xc1, 0x7c, 0x1f, 0xd1, 0xfe, 0xff, 0xe0,
-  0x2f, 0xdf, 0xfb, 0xfc, 0xfe, 0xf3, 0xa8, 0x00, 0x2a, 0xa3, 0xe1, 0xc0, 0x2e, 0x0f, 0xe8, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xfd, 0xfe, 0x7f, 0x71, 0xf0, 0x04, 0x15, 0x51, 0xe4, 0x60, 0x14, 0x07, 0xf4, 0x3e, 0xea, 0xe0,
-  0x5f, 0xff, 0xfb, 0xff, 0x3f, 0xb8, 0xe8, 0x00, 0x2a, 0xa0, 0xea, 0x30, 0x0e, 0x03, 0xe8, 0x0e, 0xee, 0xe0,
-  0x57, 0xff, 0xf7, 0xf7, 0x3f, 0x9c, 0x70, 0x05, 0x15, 0x50, 0x75, 0x14, 0x87, 0x03, 0xf4, 0x06, 0xff, 0xe0,
-  0x07, 0xff, 0xef, 0xf9, 0x9f, 0x9c, 0x38, 0x02, 0x8a, 0xa0, 0x3a, 0x88, 0xc3, 0x02, 0xea, 0x02, 0xe0, 0xe0,
-  0x51, 0x7f, 0xff, 0xfc, 0x8f, 0xce, 0x1c, 0x01, 0x45, 0x44, 0x35, 0x04, 0x71, 0x05, 0x74, 0x00, 0xfa, 0xe0,
-  0x54, 0x1b, 0xff, 0xfe, 0x43, 0xcf, 0x0e, 0x00, 0x82, 0xa2, 0x0a, 0x02, 0x30, 0x82, 0xaa, 0x00, 0xe4, 0xe0,
-  0x7d, 0x53, 0xff, 0xff, 0x01, 0xe7, 0x87, 0x80, 0x41, 0x51, 0x05, 0x01, 0x10, 0x45, 0x51, 0x00, 0xff, 0xe0,
-  0x7d, 0xca, 0xbf, 0xff, 0x80, 0xe3, 0xc3, 0xc0, 0x20, 0xa0, 0x82, 0x80, 0x08, 0x0a, 0xa2, 0x00, 0xe0, 0xe0,
-  0x7f, 0xf8, 0x8f, 0xff, 0xc0, 0xe0, 0xc0, 0xf8, 0x00, 0x50, 0x00, 0x40, 0x04, 0x05, 0x51, 0x7e, 0xea, 0xe0,
-  0x7f, 0xfd, 0x22, 0xbf, 0x60, 0x70, 0x60, 0x3e, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfe, 0xe4, 0xe0,
-  0x7f, 0xff, 0xa8, 0x1f, 0x90, 0x3c, 0x30, 0x03, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0xfe, 0x47, 0xc0, 0x1e, 0x08, 0x01, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xf0, 0xe0, 0x07, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x7f, 0xff, 0xff, 0x8b, 0xf3, 0x81, 0xc0, 0x03, 0x60, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x7f, 0xff, 0xf3, 0x5f, 0xf9, 0xe0, 0xfc, 0x01, 0xe0, 0x05, 0x51, 0x40, 0x07, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0x69, 0x5f, 0xfc, 0xff, 0xf0, 0x47, 0xc0, 0x0b, 0xa2, 0x80, 0x02, 0xaa, 0x28, 0x3e, 0xe0, 0xe0,
-  0x7f, 0xea, 0xaa, 0x7d, 0xff, 0xf5, 0xe3, 0x8f, 0x80, 0x17, 0x55, 0x00, 0x05, 0x54, 0x50, 0x40, 0xfa, 0xe0,
-  0x7f, 0x4a, 0xaa, 0xfb, 0xff, 0xab, 0xce, 0x3f, 0x00, 0x2e, 0xaa, 0x02, 0x08, 0xa8, 0xa0, 0x82, 0xe0, 0xe0,
-  0x7e, 0x52, 0xcf, 0xf7, 0xfd, 0x57, 0x9c, 0x7e, 0x10, 0x5d, 0xd4, 0x44, 0x11, 0x53, 0x41, 0x04, 0xff, 0xe0,
-  0x3a, 0x94, 0xef, 0xab, 0xaa, 0xaf, 0x7d, 0xfc, 0x20, 0xbf, 0xa8, 0x80, 0xa2, 0xae, 0x82, 0xaa, 0xe0, 0xe0,
-  0x2a, 0xbf, 0xff, 0x57, 0x55, 0x5f, 0xeb, 0xf8, 0x01, 0x7f, 0xf0, 0x45, 0x05, 0x7d, 0x15, 0x74, 0xfc, 0xe0,
-  0x28, 0xff, 0xfe, 0xae, 0xab, 0xbd, 0x5f, 0xe0, 0x02, 0xbf, 0xf8, 0x8a, 0x02, 0xfa, 0xaa, 0xeb, 0x60, 0xe0,
-  0x03, 0xff, 0xff, 0xd5, 0x55, 0xfa, 0xab, 0xc0, 0x05, 0x7f, 0xf1, 0x14, 0x45, 0xf7, 0x55, 0xd7, 0x7f, 0xe0,
-  0x2f, 0xff, 0xff, 0xaa, 0xab, 0xf5, 0x57, 0x80, 0x0a, 0xff, 0xe2, 0xa8, 0x8f, 0xee, 0xab, 0xaf, 0xbf, 0xe0,
-  0x7f, 0xff, 0xff, 0x57, 0xd5, 0x6a, 0xaf, 0x40, 0x05, 0xff, 0xe5, 0x55, 0x9f, 0xfd, 0x55, 0xdf, 0x4f, 0xe0,
-  0x3b, 0xff, 0xff, 0xaf, 0xba, 0xd5, 0x5e, 0x80, 0x0b, 0xff, 0xe8, 0xab, 0x3f, 0xfa, 0xab, 0xbe, 0xf0, 0xa0,
-  0x2b, 0xbf, 0xff, 0x7f, 0x75, 0xea, 0xbd, 0x40, 0x53, 0x77, 0xe1, 0x57, 0x7f, 0xf5, 0x77, 0x7d, 0xf7, 0xc0,
-  0x09, 0x3b, 0xfe, 0xff, 0xfb, 0xd5, 0x7a, 0xa0, 0x82, 0xef, 0xe2, 0xae, 0x7f, 0xea, 0xef, 0xff, 0xff, 0xa0,
-  0x00, 0x2b, 0xfd, 0xff, 0xf5, 0xaa, 0xf5, 0x50, 0x05, 0xef, 0xc5, 0x7c, 0x7f, 0xdd, 0x77, 0x7f, 0xff, 0xc0,
-  0x20, 0x02, 0xff, 0xff, 0xeb, 0xd5, 0xea, 0xa0, 0x2b, 0xef, 0x8a, 0xf8, 0xff, 0xba, 0xee, 0xff, 0xff, 0xa0,
-  0x7a, 0x00, 0x1f, 0xff, 0xf7, 0xaf, 0xd5, 0x40, 0x17, 0xc7, 0x05, 0xf5, 0xff, 0x75, 0xdd, 0xff, 0xff, 0xc0,
-  0x7f, 0x01, 0xff, 0xff, 0xef, 0x5f, 0x6a, 0x80, 0x23, 0xa0, 0x8b, 0xef, 0xff, 0xfb, 0xef, 0xfe, 0xff, 0xa0,
-  0x28, 0x0b, 0xff, 0xff, 0xde, 0xfa, 0xd5, 0x04, 0x47, 0x41, 0x17, 0xdf, 0xff, 0xf7, 0xdf, 0xfd, 0xff, 0x40,
-  0x00, 0x4b, 0xff, 0xff, 0xaf, 0xf5, 0xaa, 0x88, 0xae, 0x8a, 0x2f, 0xbf, 0xff, 0xef, 0xbf, 0xf3, 0xfe, 0xa0,
-  0x02, 0xdf, 0xff, 0xff, 0xdf, 0xab, 0xd5, 0x40, 0x4d, 0x14, 0x4f, 0xff, 0xff, 0xdf, 0xdf, 0xe7, 0xfd, 0x00,
-  0x2a, 0xff, 0xfe, 0xff, 0xbd, 0x57, 0xaa, 0x80, 0x98, 0x28, 0x1f, 0xff, 0xff, 0xbf, 0xbf, 0xc7, 0xea, 0x20,
-  0x2b, 0xfd, 0xff, 0x7f, 0x7a, 0xab, 0x55, 0x41, 0x10, 0x50, 0x3f, 0xff, 0xff, 0x7f, 0x7f, 0x8f, 0xd4, 0x40,
-  0x3f, 0xfe, 0xff, 0xbf, 0xd5, 0x57, 0xaa, 0xa0, 0x20, 0xa0, 0xff, 0xff, 0xfa, 0xbf, 0xff, 0x9e, 0xb8, 0x20,
-  0x7f, 0x7e, 0xff, 0xff, 0xff, 0xaf, 0x55, 0x50, 0x01, 0x40, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0x3d, 0xf4, 0x40,
-  0x7f, 0x9e, 0x7f, 0xbf, 0xef, 0x56, 0xaa, 0xa8, 0x00, 0x8a, 0xfe, 0xff, 0xee, 0xff, 0xfe, 0x7b, 0xe8, 0xa0,
-  0x7f, 0xc7, 0x3f, 0xdf, 0xf7, 0xed, 0x55, 0x50, 0x01, 0x15, 0xfd, 0xff, 0xdd, 0xff, 0xfc, 0xff, 0xf1, 0x40,
-  0x7f, 0xc1, 0x9f, 0xaf, 0xfb, 0xda, 0xaa, 0xaa, 0x82, 0x8b, 0xf9, 0xff, 0xbb, 0xff, 0xfb, 0xff, 0xe2, 0x20,
-  0xbd, 0xe0, 0x5f, 0xdf, 0xfd, 0xfd, 0x55, 0x55, 0x54, 0x11, 0xf7, 0xff, 0x77, 0xdf, 0xff, 0xff, 0xc0, 0x50,
-  0xbb, 0xf8, 0x0f, 0xef, 0xfe, 0xfa, 0xaa, 0xaa, 0xa0, 0x23, 0xef, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0xa2, 0xd0,
-  0xd5, 0x5c, 0x0f, 0xf7, 0xfd, 0x75, 0x55, 0x55, 0x00, 0x07, 0xdf, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0x44, 0xb0,
-  0xe2, 0xbf, 0x03, 0xeb, 0xfe, 0xfa, 0xaa, 0xaa, 0x00, 0x06, 0xbf, 0xff, 0xee, 0xff, 0xff, 0xfe, 0x8a, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam10 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam10_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM11
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM11
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM11 uint8_t hammerbeam11_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0xc5, 0xfd, 0x55, 0x40, 0x15, 0x39, 0x1c, 0x37, 0xf7, 0xcf, 0x00, 0x01, 0x11, 0xd7, 0xd5, 0xfe, 0x70,
-  0xc0, 0x7f, 0xfe, 0xaa, 0x20, 0x0a, 0x78, 0x0e, 0x1e, 0xfb, 0xe7, 0x80, 0x00, 0x28, 0xfb, 0xea, 0xff, 0xb0,
-  0x85, 0xff, 0xf5, 0x55, 0x10, 0x05, 0x78, 0x06, 0x18, 0x79, 0xe1, 0xc0, 0x00, 0x55, 0x7f, 0xf7, 0xff, 0xd0,
-  0x8f, 0x97, 0xfe, 0xaa, 0x02, 0x0b, 0x70, 0x06, 0x0f, 0x38, 0x70, 0x60, 0x00, 0x2a, 0xbf, 0xfa, 0xe0, 0xd0,
-  0x2f, 0xff, 0xff, 0xd5, 0x04, 0x45, 0xb0, 0x07, 0x07, 0x9c, 0x13, 0x38, 0x01, 0x15, 0x7f, 0xfe, 0xfb, 0xe0,
-  0x78, 0xbf, 0xff, 0xea, 0x80, 0x81, 0xf0, 0x07, 0x83, 0xfe, 0x19, 0xdc, 0x00, 0x8a, 0xbf, 0xfa, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0x55, 0x44, 0x04, 0xf0, 0x0f, 0xe1, 0xff, 0x89, 0xf0, 0x00, 0x51, 0x5f, 0xfc, 0xff, 0xe0,
-  0x6b, 0xe2, 0xff, 0xaa, 0x82, 0x00, 0xf0, 0x1f, 0xf0, 0x3f, 0xc4, 0xf0, 0x00, 0x28, 0xab, 0xfe, 0xe0, 0xe0,
-  0x60, 0xbf, 0xff, 0x55, 0x44, 0x00, 0x70, 0x1f, 0xfc, 0x1f, 0xe0, 0x70, 0x00, 0x14, 0x5d, 0xfe, 0xfa, 0xe0,
-  0x3f, 0xff, 0xff, 0xee, 0xaa, 0x00, 0x78, 0x9f, 0xc0, 0x0f, 0x70, 0x70, 0x02, 0x0a, 0x2e, 0xfe, 0xe0, 0xe0,
-  0x35, 0xe8, 0xbf, 0xff, 0xc5, 0x00, 0x78, 0x9f, 0x80, 0xff, 0x98, 0x3c, 0x01, 0x04, 0x15, 0x7e, 0xff, 0xe0,
-  0x25, 0x6f, 0xff, 0xfe, 0xaa, 0x00, 0x6d, 0xdf, 0x03, 0xff, 0xc4, 0x3e, 0x00, 0x82, 0x2a, 0xfe, 0xe0, 0xe0,
-  0x01, 0x4d, 0xdf, 0xfd, 0x55, 0x01, 0x5d, 0xdf, 0x0f, 0x3f, 0xe0, 0x1e, 0x00, 0x41, 0x15, 0x7e, 0xfc, 0xe0,
-  0x60, 0x05, 0x57, 0xfe, 0xaa, 0x00, 0x5c, 0xee, 0x7c, 0x7b, 0xf0, 0x0f, 0x00, 0x20, 0x8a, 0xbe, 0xe0, 0xe0,
-  0x00, 0x00, 0x13, 0x7f, 0xf5, 0x41, 0x1e, 0xfd, 0xf9, 0xfc, 0x7c, 0x03, 0x00, 0x40, 0x47, 0x5e, 0xff, 0xe0,
-  0x21, 0x00, 0x03, 0x7f, 0xfe, 0xa0, 0x9f, 0x7f, 0xe1, 0xfe, 0x1f, 0x01, 0x80, 0x20, 0x03, 0xae, 0xe0, 0xe0,
-  0x6b, 0x20, 0x00, 0x2f, 0xff, 0x41, 0x1f, 0xff, 0xc3, 0x1f, 0x07, 0x80, 0xc0, 0x10, 0x01, 0xde, 0xfc, 0xe0,
-  0x7f, 0xe8, 0x00, 0x03, 0xfe, 0xa0, 0x1f, 0xff, 0x87, 0xcf, 0x81, 0xe0, 0x20, 0x28, 0x02, 0xee, 0xe0, 0xe0,
-  0x7f, 0xfc, 0x00, 0x3f, 0xfd, 0x50, 0x0f, 0xff, 0x8f, 0x97, 0xc0, 0xfc, 0x30, 0x14, 0x11, 0xd6, 0xff, 0xe0,
-  0x7f, 0xe0, 0x01, 0xbf, 0xea, 0xa0, 0x0e, 0xff, 0x0f, 0xff, 0xe0, 0x7f, 0x90, 0x0a, 0xa8, 0xee, 0xe0, 0xe0,
-  0x7e, 0x40, 0x09, 0xff, 0x55, 0x40, 0x06, 0x7f, 0x1f, 0xff, 0xe0, 0x3f, 0xd9, 0x14, 0x51, 0x76, 0xea, 0xe0,
-  0x6c, 0x00, 0x5d, 0xff, 0xea, 0xa0, 0x02, 0xfe, 0x3f, 0x9f, 0xf0, 0x1f, 0xf0, 0x8a, 0x28, 0xfa, 0xee, 0xe0,
-  0x24, 0x02, 0xdf, 0xf5, 0x55, 0x40, 0x03, 0x7e, 0x7f, 0xce, 0xfc, 0x0f, 0xe0, 0x45, 0x54, 0x7c, 0xff, 0xe0,
-  0x00, 0x16, 0xff, 0xfa, 0xaa, 0x80, 0x01, 0xfe, 0xff, 0xcf, 0x7f, 0xcf, 0x80, 0x2a, 0xaa, 0xbe, 0xe0, 0xe0,
-  0x40, 0x57, 0xff, 0xd5, 0x55, 0x00, 0x03, 0xfd, 0xdf, 0xc7, 0x7f, 0xe7, 0x00, 0x15, 0x55, 0x7e, 0xfa, 0xe0,
-  0x61, 0x57, 0xfe, 0xaa, 0xb8, 0x80, 0x03, 0xff, 0xef, 0xe7, 0x7f, 0xfe, 0x00, 0x2a, 0xae, 0xbe, 0xe4, 0xe0,
-  0x05, 0xff, 0xff, 0xd5, 0x54, 0x44, 0x07, 0x7f, 0xef, 0xe3, 0x37, 0xf8, 0x00, 0x15, 0x77, 0xde, 0xff, 0xe0,
-  0x0d, 0xff, 0xfa, 0xaa, 0xb2, 0x28, 0x17, 0x7f, 0xe7, 0xf3, 0x31, 0xf8, 0x02, 0x0a, 0xbb, 0xee, 0xe0, 0xe0,
-  0x2f, 0xc2, 0xf5, 0x55, 0x60, 0x04, 0x1f, 0x7f, 0xf3, 0xf1, 0x30, 0x74, 0x01, 0x15, 0x7d, 0xfe, 0xea, 0xe0,
-  0x2f, 0x7f, 0xff, 0xaa, 0x80, 0x08, 0x5f, 0x3f, 0xf8, 0xf9, 0x9b, 0x08, 0x00, 0x8a, 0xbe, 0xfe, 0xe4, 0xe0,
-  0x7d, 0x5f, 0xff, 0xd5, 0x10, 0x05, 0xdf, 0x3d, 0xe0, 0x78, 0x9b, 0xd0, 0x11, 0x01, 0x5f, 0xfe, 0xff, 0xe0,
-  0x28, 0x0b, 0xff, 0xfe, 0xa8, 0x0a, 0xdf, 0xbe, 0xdf, 0xf8, 0x9b, 0xe8, 0x08, 0x88, 0xaf, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xdf, 0xff, 0xf5, 0x14, 0x05, 0x6f, 0xbe, 0xf1, 0xfc, 0x5f, 0xd0, 0x04, 0x44, 0x5f, 0xfe, 0xea, 0xe0,
-  0x72, 0xfc, 0x2f, 0xff, 0xe8, 0x0a, 0xbd, 0xbf, 0x6f, 0xfc, 0x0f, 0xa8, 0x02, 0x20, 0xaf, 0xfe, 0xee, 0xe0,
-  0x5f, 0xff, 0xff, 0xff, 0xd4, 0x15, 0x5b, 0xdf, 0x7f, 0xfc, 0x0f, 0xd4, 0x05, 0x00, 0x55, 0xfe, 0xff, 0xe0,
-  0x00, 0xb0, 0xb0, 0xbf, 0xfe, 0x0a, 0xa3, 0xff, 0x3f, 0xfc, 0x0f, 0xa8, 0x02, 0x00, 0x2a, 0xfe, 0xe0, 0xe0,
-  0x5f, 0xff, 0xff, 0xff, 0xf5, 0x05, 0x47, 0xff, 0x9f, 0xfe, 0x07, 0x54, 0x01, 0x00, 0x14, 0xfe, 0xfa, 0xe0,
-  0x7f, 0xfc, 0x5c, 0x17, 0xea, 0x9a, 0xa7, 0xef, 0x8f, 0xfe, 0x06, 0xaa, 0x08, 0xa8, 0x0a, 0x3e, 0xe0, 0xe0,
-  0x4b, 0x5f, 0xff, 0xff, 0xf5, 0x35, 0x47, 0xf3, 0xc3, 0xfe, 0x07, 0x55, 0x04, 0x54, 0x41, 0x9e, 0xff, 0xe0,
-  0x7e, 0x05, 0x85, 0xfe, 0xaa, 0xba, 0xcd, 0xf8, 0x73, 0xbe, 0x06, 0xaa, 0x82, 0x28, 0x2d, 0xee, 0xe0, 0xe0,
-  0x7f, 0x7f, 0xff, 0xf5, 0xd5, 0x0d, 0x48, 0x78, 0xe7, 0xdf, 0x03, 0x55, 0x41, 0x54, 0x15, 0xfe, 0xfc, 0xe0,
-  0x37, 0xf0, 0xbf, 0xfe, 0xaa, 0x03, 0xc8, 0x3d, 0xcf, 0xcf, 0x03, 0xaa, 0x80, 0xaa, 0x0e, 0xff, 0x60, 0xe0,
-  0x01, 0xff, 0xff, 0xd5, 0x44, 0x05, 0x80, 0x1f, 0xdf, 0xe7, 0x03, 0xd4, 0x01, 0x54, 0x07, 0x7f, 0x7f, 0xe0,
-  0x0f, 0xf8, 0x5f, 0xfa, 0xa8, 0x03, 0x80, 0x1f, 0xbb, 0xf3, 0x83, 0xaa, 0x00, 0xaa, 0x0b, 0xbf, 0xbf, 0xe0,
-  0x3e, 0xbf, 0xff, 0xfd, 0x40, 0x07, 0x80, 0x0f, 0xfc, 0xf3, 0x81, 0xd4, 0x00, 0x15, 0x07, 0xff, 0xcf, 0xe0,
-  0x7c, 0x0b, 0xff, 0xea, 0xa0, 0x03, 0x80, 0x0f, 0xee, 0x79, 0xc1, 0xe8, 0x00, 0x02, 0x03, 0xff, 0xf0, 0xa0,
-  0x7f, 0xff, 0xff, 0xd5, 0x40, 0x01, 0x80, 0x1b, 0xe7, 0xf8, 0x40, 0xf4, 0x00, 0x01, 0x05, 0xff, 0xff, 0xe0,
-  0x62, 0xf5, 0xfe, 0xea, 0x20, 0x01, 0xc0, 0x1d, 0xe7, 0xfc, 0x60, 0x78, 0x00, 0x80, 0x83, 0xdf, 0xff, 0xe0,
-  0x7f, 0xe0, 0xbd, 0x54, 0x40, 0x01, 0xc0, 0x3c, 0xf3, 0xfe, 0x20, 0x38, 0x00, 0x41, 0x41, 0xf7, 0xff, 0xe0,
-  0x57, 0x7f, 0xfe, 0xaa, 0x00, 0x09, 0xc8, 0xfc, 0xf3, 0xfe, 0x10, 0x1c, 0x00, 0x28, 0xa0, 0xff, 0xff, 0xe0,
-  0x03, 0x7f, 0xff, 0xd4, 0x00, 0x01, 0x65, 0xfe, 0x71, 0xff, 0x80, 0x0c, 0x00, 0x54, 0x41, 0x77, 0xff, 0xe0,
-  0x68, 0x5f, 0x7f, 0xfe, 0x00, 0x09, 0x67, 0xfe, 0x78, 0xff, 0x80, 0x06, 0x00, 0x2a, 0xa8, 0xbb, 0xff, 0xe0,
-  0x00, 0x06, 0x7f, 0xf5, 0x01, 0x04, 0x77, 0x7e, 0x3c, 0x7f, 0xe0, 0x07, 0x01, 0x15, 0x54, 0x5d, 0xff, 0xe0,
-  0x47, 0x40, 0x5f, 0xfa, 0x02, 0x00, 0x33, 0x6f, 0x1f, 0x1f, 0xf8, 0x03, 0x80, 0xaa, 0xaa, 0x2b, 0xff, 0xe0,
-  0x50, 0x00, 0x0b, 0xff, 0x01, 0x04, 0x3b, 0x37, 0x1f, 0x83, 0xfe, 0x00, 0xc0, 0x55, 0xd5, 0x55, 0xff, 0xe0,
-  0x7a, 0x00, 0x00, 0xfa, 0x02, 0x02, 0x1b, 0x73, 0x8f, 0xc7, 0xff, 0xc0, 0xe0, 0x3e, 0xea, 0xaa, 0xff, 0xe0,
-  0x7f, 0x00, 0x1f, 0xf4, 0x01, 0x00, 0x1d, 0xb9, 0x87, 0x1f, 0xff, 0xf0, 0x72, 0x1f, 0x75, 0x54, 0x3f, 0xe0,
-  0x70, 0x04, 0xdf, 0xaa, 0x02, 0x80, 0x0f, 0xf9, 0xc3, 0xff, 0xff, 0xff, 0xe1, 0x2e, 0xbe, 0x8a, 0x3f, 0xe0,
-  0x7d, 0x2e, 0xff, 0xfd, 0x15, 0x00, 0x0f, 0xfc, 0xc0, 0xff, 0xff, 0xfb, 0xc1, 0x97, 0x7f, 0x44, 0x9f, 0xe0,
-  0x40, 0xae, 0xff, 0xfa, 0xa2, 0xa0, 0x07, 0xde, 0x60, 0x7f, 0xff, 0xc7, 0x80, 0xcf, 0xbf, 0xe2, 0x4f, 0xe0,
-  0x02, 0xff, 0xff, 0xff, 0x85, 0x50, 0x07, 0x6f, 0x10, 0x1f, 0xfe, 0x0f, 0x00, 0x77, 0xdf, 0xf1, 0x6f, 0xe0,
-  0x16, 0xcb, 0xff, 0xea, 0xa2, 0xa8, 0x06, 0xe7, 0x00, 0x3f, 0xfc, 0x1e, 0x00, 0x3b, 0xef, 0xf0, 0x77, 0xe0,
-  0xb7, 0xff, 0xff, 0x5d, 0x41, 0x54, 0x06, 0xf7, 0x80, 0xff, 0xf0, 0x7d, 0x00, 0x5f, 0xff, 0xf8, 0x7f, 0xd0,
-  0xbf, 0x05, 0xfe, 0xaa, 0xa2, 0xa8, 0x06, 0x73, 0xc1, 0xff, 0x80, 0xfa, 0x80, 0x3f, 0xff, 0xf8, 0x3f, 0xd0,
-  0xd5, 0xff, 0x5f, 0xfd, 0x51, 0x54, 0x0f, 0xf8, 0xe3, 0xfe, 0x01, 0xf5, 0x00, 0x1f, 0xff, 0xfd, 0x1f, 0xb0,
-  0xe0, 0x50, 0x05, 0xfa, 0xa2, 0xa8, 0x0f, 0xfc, 0x7f, 0xfc, 0x07, 0xea, 0x80, 0x0f, 0xff, 0xfe, 0x9e, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam11 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam11_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM12
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM12
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM12 uint8_t hammerbeam12_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x5f, 0xd5, 0xf5, 0x5e, 0xf9, 0x5d, 0x43, 0x5d, 0x40, 0x01, 0xc5, 0x01, 0x7f, 0xe0, 0x45, 0xfe, 0x70,
-  0xca, 0xbf, 0xaa, 0xea, 0xb8, 0x80, 0x0e, 0xa1, 0xba, 0xa0, 0x00, 0xc2, 0x03, 0x3f, 0xe0, 0x22, 0xff, 0xb0,
-  0xbd, 0x7f, 0x55, 0xd5, 0x5f, 0xff, 0xe7, 0x41, 0xdd, 0x50, 0x00, 0x41, 0x01, 0x1f, 0xc0, 0x43, 0xff, 0xd0,
-  0xbf, 0xfe, 0xaa, 0xea, 0xb0, 0x20, 0x0b, 0xa0, 0xba, 0xa8, 0x00, 0x60, 0x80, 0xbf, 0x80, 0x04, 0xe0, 0xd0,
-  0x7f, 0xfd, 0x55, 0xd5, 0x7f, 0xbe, 0x55, 0xd0, 0xdd, 0x54, 0x00, 0x21, 0x00, 0x1f, 0x00, 0x40, 0xfb, 0xe0,
-  0x7f, 0xfa, 0xab, 0xaa, 0xff, 0x80, 0xab, 0xa0, 0xfa, 0xa8, 0x04, 0x10, 0x80, 0x0e, 0x00, 0x80, 0xe0, 0xe0,
-  0x7f, 0xfd, 0x55, 0x55, 0xff, 0xff, 0xdd, 0xd0, 0xdd, 0x50, 0x02, 0x00, 0x00, 0x16, 0x00, 0x00, 0xff, 0xe0,
-  0x7f, 0xfa, 0xaa, 0xab, 0xef, 0xff, 0xef, 0xe0, 0xea, 0xa0, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x02, 0xe0, 0xe0,
-  0x7f, 0xd5, 0x55, 0x55, 0xdf, 0xff, 0xf7, 0xd0, 0x5d, 0x40, 0x03, 0x00, 0x00, 0x06, 0x40, 0x00, 0xfa, 0xe0,
-  0x7f, 0xaa, 0xae, 0xab, 0xbf, 0xef, 0xfb, 0xe8, 0x6e, 0x80, 0x01, 0x80, 0x10, 0x0a, 0x20, 0x02, 0xe0, 0xe0,
-  0x7d, 0x55, 0x5d, 0x57, 0x5f, 0x73, 0xfd, 0xf4, 0x3d, 0x40, 0x00, 0x80, 0x08, 0x07, 0x00, 0x00, 0xff, 0xe0,
-  0x02, 0xaa, 0xba, 0xae, 0xbe, 0xf8, 0xfe, 0xe8, 0x3e, 0x80, 0x08, 0x40, 0x0c, 0x0b, 0x28, 0x02, 0xe0, 0xe0,
-  0x75, 0x55, 0x55, 0x55, 0x5f, 0x7c, 0x7f, 0x74, 0x1f, 0x00, 0x04, 0x00, 0x04, 0x05, 0x10, 0x06, 0xfc, 0xe0,
-  0x02, 0xaa, 0xba, 0xae, 0xbe, 0xbe, 0x1f, 0xfa, 0x1f, 0x80, 0x06, 0x00, 0x06, 0x02, 0xa0, 0x0e, 0xe0, 0xe0,
-  0x15, 0x55, 0x75, 0x5d, 0x5d, 0x5f, 0x0f, 0xf5, 0x0f, 0x00, 0x07, 0x00, 0x02, 0x04, 0x00, 0x04, 0xff, 0xe0,
-  0x2b, 0xaa, 0xaa, 0xba, 0xbe, 0xae, 0x87, 0xfa, 0x07, 0x00, 0x03, 0x00, 0x03, 0x02, 0x00, 0x08, 0xe0, 0xe0,
-  0x57, 0x55, 0x75, 0x55, 0x7f, 0x57, 0x43, 0xf5, 0x07, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x10, 0xfc, 0xe0,
-  0x7e, 0xaa, 0xea, 0xaa, 0xbf, 0xeb, 0xa1, 0xfa, 0x83, 0x80, 0x01, 0x80, 0x00, 0x82, 0x00, 0x20, 0xe0, 0xe0,
-  0x7d, 0x55, 0xd5, 0x55, 0x70, 0x17, 0xd0, 0x7d, 0x01, 0x80, 0x00, 0xe0, 0x40, 0x01, 0x00, 0x00, 0xff, 0xe0,
-  0x7a, 0xab, 0xea, 0xaa, 0xb7, 0xcb, 0xa8, 0x7a, 0x80, 0xc0, 0x00, 0xf0, 0x20, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x55, 0x57, 0xd5, 0x55, 0x04, 0x01, 0xd0, 0x1d, 0x40, 0xc0, 0x00, 0x78, 0x10, 0x00, 0x00, 0x00, 0xea, 0xe0,
-  0x2a, 0xaf, 0xaa, 0xaa, 0xff, 0xfc, 0xe8, 0x0e, 0xa0, 0x70, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0xee, 0xe0,
-  0x55, 0x57, 0x55, 0x55, 0x10, 0x21, 0xf4, 0x05, 0x40, 0x70, 0x00, 0x1c, 0x14, 0x00, 0x00, 0x00, 0xff, 0xe0,
-  0x2a, 0xae, 0xaa, 0xaa, 0xdf, 0x3b, 0xea, 0x02, 0xa0, 0x38, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x55, 0x7f, 0x55, 0x55, 0xc0, 0x03, 0xf4, 0x00, 0x54, 0x38, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0xfa, 0xe0,
-  0x2a, 0xfe, 0xaa, 0xaa, 0xff, 0xff, 0xfa, 0x00, 0x2a, 0x1c, 0x00, 0x03, 0x02, 0x00, 0x1f, 0x00, 0xe4, 0xe0,
-  0x55, 0xfd, 0x55, 0x55, 0xf7, 0xfd, 0xf5, 0x00, 0x14, 0x0c, 0x00, 0x01, 0x80, 0x00, 0x7f, 0xc0, 0xff, 0xe0,
-  0x28, 0x3a, 0xaa, 0xab, 0xfb, 0xfe, 0xfa, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x40, 0x01, 0xe0, 0xf0, 0xe0, 0xe0,
-  0x53, 0xb5, 0x55, 0x57, 0xf7, 0xfe, 0x3d, 0x00, 0x01, 0x07, 0x80, 0x00, 0x00, 0x03, 0x80, 0x38, 0xea, 0xe0,
-  0x06, 0x02, 0xaa, 0xaf, 0xfb, 0xff, 0x0a, 0x80, 0x00, 0x83, 0x80, 0x00, 0x00, 0x03, 0x00, 0x18, 0xe4, 0xe0,
-  0x7f, 0xf1, 0x55, 0x5f, 0xf5, 0xff, 0xc5, 0x40, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x06, 0x00, 0x0c, 0xff, 0xe0,
-  0x7f, 0xfa, 0xaa, 0xae, 0xfa, 0xbf, 0xe0, 0x80, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x06, 0x00, 0x0c, 0xe0, 0xe0,
-  0x0c, 0x01, 0x5d, 0x5d, 0xf5, 0x5f, 0xc0, 0x40, 0x00, 0x00, 0x78, 0x00, 0x00, 0x0c, 0x00, 0x06, 0xea, 0xe0,
-  0x67, 0x2a, 0xba, 0xbb, 0xea, 0xaf, 0xe0, 0x20, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x06, 0xee, 0xe0,
-  0x70, 0x55, 0x55, 0x5d, 0xe0, 0x57, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x06, 0xff, 0xe0,
-  0x7e, 0xaa, 0xba, 0xbb, 0xcf, 0x2b, 0xe8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x06, 0xe0, 0xe0,
-  0x7d, 0x55, 0x75, 0x7c, 0x18, 0x03, 0xf4, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x0c, 0x00, 0x06, 0xfa, 0xe0,
-  0x7a, 0xaa, 0xea, 0xbb, 0xff, 0xfb, 0xfa, 0x80, 0x00, 0x1f, 0xbf, 0x00, 0x00, 0x06, 0x00, 0x0c, 0xe0, 0xe0,
-  0x75, 0x55, 0x55, 0x7f, 0xff, 0xf3, 0xf5, 0x40, 0x00, 0x7d, 0x70, 0x00, 0x04, 0x06, 0x00, 0x0c, 0xff, 0xe0,
-  0x6a, 0xaa, 0xea, 0xf8, 0xc0, 0x03, 0xf0, 0x00, 0x03, 0xea, 0xc0, 0x00, 0x18, 0x03, 0x00, 0x18, 0xe0, 0xe0,
-  0x75, 0x55, 0xd5, 0x76, 0x79, 0x57, 0xe0, 0x00, 0x3f, 0x57, 0x80, 0x00, 0x70, 0x03, 0x80, 0x38, 0xfc, 0xe0,
-  0x7a, 0xaa, 0xaa, 0xeb, 0x02, 0xab, 0xe0, 0x01, 0xfa, 0xea, 0x00, 0x01, 0xc0, 0x01, 0xe0, 0xf0, 0x60, 0xe0,
-  0x75, 0x01, 0xd5, 0xf7, 0xd5, 0x57, 0xc0, 0x07, 0x75, 0xde, 0x00, 0x03, 0x80, 0x00, 0x7f, 0xc0, 0x7f, 0xe0,
-  0x7a, 0xbd, 0xaa, 0xeb, 0xaa, 0xaf, 0xc0, 0x3e, 0xeb, 0xb8, 0x00, 0x07, 0xc0, 0x10, 0x1f, 0x00, 0x3f, 0xe0,
-  0x78, 0x20, 0x15, 0xd7, 0xd5, 0x5f, 0x80, 0xfd, 0x57, 0x70, 0x00, 0x0f, 0xc0, 0x20, 0x00, 0x00, 0x0f, 0xe0,
-  0x7f, 0xff, 0xab, 0xaf, 0xaa, 0xbf, 0x83, 0xea, 0xae, 0xf0, 0x00, 0x1b, 0xc0, 0x60, 0x00, 0x00, 0x00, 0xa0,
-  0x79, 0x00, 0x15, 0xd7, 0xd5, 0x5f, 0x07, 0x55, 0x57, 0xc0, 0x00, 0x31, 0x81, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x39, 0xee, 0xab, 0xaf, 0xaa, 0xbe, 0x0e, 0xaa, 0xae, 0x00, 0x00, 0x20, 0x02, 0xc0, 0x00, 0x00, 0x00, 0x80,
-  0x54, 0x07, 0x57, 0x5f, 0xd5, 0x7c, 0x1d, 0x55, 0x5c, 0x00, 0x00, 0x40, 0x05, 0x80, 0x00, 0x00, 0x00, 0x40,
-  0x6a, 0xae, 0xaa, 0xaf, 0xaa, 0xfc, 0x7a, 0xaa, 0xb8, 0x00, 0x00, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0x00, 0x20,
-  0x55, 0x5d, 0x55, 0x5f, 0xd5, 0xf8, 0xd5, 0x55, 0x7c, 0x00, 0x00, 0x00, 0x17, 0xe1, 0x00, 0x40, 0x00, 0x00,
-  0x6a, 0xbe, 0xaa, 0xaf, 0xab, 0xf9, 0xaa, 0xaa, 0xfa, 0x00, 0x00, 0x00, 0x0f, 0xf2, 0x00, 0x20, 0x00, 0x00,
-  0x75, 0x7d, 0x55, 0x5f, 0x55, 0xf3, 0x55, 0x55, 0x75, 0x00, 0x00, 0x00, 0x17, 0xf1, 0x00, 0x00, 0x00, 0x00,
-  0x7a, 0xe0, 0x2a, 0xbf, 0xab, 0xf6, 0xaa, 0xaa, 0xea, 0x00, 0x00, 0x00, 0x2f, 0xf2, 0x00, 0x20, 0x00, 0x00,
-  0x7d, 0xcf, 0x55, 0x60, 0x55, 0xe5, 0x55, 0x55, 0xd5, 0x00, 0x00, 0x10, 0x1d, 0xe0, 0x00, 0x10, 0x20, 0x00,
-  0x7e, 0x18, 0x02, 0xaf, 0x2b, 0xee, 0xaa, 0xab, 0xaa, 0x80, 0x00, 0x20, 0x38, 0xc2, 0x00, 0x08, 0x10, 0xa0,
-  0x7f, 0xff, 0xf5, 0x08, 0x07, 0xdd, 0x55, 0x55, 0x55, 0x40, 0x00, 0x60, 0x22, 0x04, 0x00, 0x10, 0x18, 0x40,
-  0x7f, 0xff, 0xe2, 0xff, 0xf3, 0xfb, 0xaa, 0xab, 0xaa, 0xa0, 0x00, 0x40, 0x4c, 0x02, 0x02, 0x08, 0x0c, 0x20,
-  0x7f, 0x8c, 0x05, 0x20, 0x07, 0xff, 0x55, 0x57, 0x55, 0x40, 0x00, 0x80, 0x18, 0x04, 0x00, 0x04, 0x04, 0x00,
-  0x7f, 0xe7, 0x2a, 0xbc, 0xaf, 0xfe, 0xaa, 0xae, 0xaa, 0x80, 0x01, 0x80, 0x30, 0x0a, 0x02, 0x0a, 0x06, 0xe0,
-  0x7f, 0xf0, 0x55, 0x81, 0x57, 0xfd, 0x55, 0x57, 0x55, 0x00, 0x01, 0x00, 0x70, 0x04, 0x01, 0x05, 0x03, 0xe0,
-  0x7f, 0xea, 0xaa, 0xfe, 0xaf, 0xfa, 0xae, 0xae, 0xaa, 0x00, 0x03, 0x00, 0x60, 0x0a, 0x02, 0x02, 0x09, 0xe0,
-  0xbf, 0xf5, 0x55, 0xfd, 0x5f, 0xf5, 0x7d, 0x5f, 0x54, 0x00, 0x02, 0x00, 0xdc, 0x14, 0x01, 0x05, 0x15, 0xd0,
-  0xbf, 0xfa, 0xaa, 0xfa, 0xaf, 0xea, 0xfa, 0xbe, 0xa8, 0x00, 0x04, 0x01, 0xfe, 0x0a, 0x02, 0x82, 0x8a, 0xd0,
-  0xdf, 0xfd, 0x55, 0x05, 0x5f, 0xdd, 0xfd, 0x5f, 0x50, 0x00, 0x00, 0x21, 0xfe, 0x15, 0x01, 0x41, 0x55, 0x30,
-  0xe7, 0xfe, 0xab, 0x72, 0xbf, 0xfb, 0xfa, 0xb7, 0xa0, 0x00, 0x00, 0x43, 0xfe, 0x2a, 0x80, 0x82, 0xaa, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam12 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam12_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM13
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM13
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM13 uint8_t hammerbeam13_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe2, 0xbf, 0xaa, 0xb6, 0xaa, 0xa8, 0x6c, 0xaf, 0xee, 0x3e, 0xfb, 0xf7, 0x9f, 0xbe, 0xa8, 0x03, 0xfe, 0x70,
-  0xd5, 0x7f, 0xd5, 0x75, 0x55, 0x51, 0x69, 0x57, 0xfd, 0x1f, 0x7f, 0xef, 0x1f, 0xff, 0xc4, 0x00, 0xff, 0xb0,
-  0xab, 0xef, 0xaa, 0xe6, 0xaa, 0xa8, 0x48, 0x83, 0xfe, 0x1f, 0xfb, 0xef, 0x1f, 0xff, 0xa8, 0x23, 0xff, 0xd0,
-  0x97, 0x5f, 0x55, 0xc7, 0x55, 0x55, 0x4c, 0x43, 0xdf, 0x9f, 0xff, 0xef, 0x1f, 0xff, 0xd0, 0x40, 0xe0, 0xd0,
-  0x7e, 0xbe, 0xab, 0xe7, 0xaa, 0xaa, 0x2c, 0x83, 0xbf, 0xff, 0xfb, 0xef, 0x1f, 0xff, 0xa0, 0x00, 0xfb, 0xe0,
-  0x7d, 0x7f, 0x55, 0xf3, 0x55, 0x55, 0x0e, 0x43, 0x7f, 0xdf, 0xfd, 0xcf, 0xbf, 0xff, 0xc0, 0x40, 0xe0, 0xe0,
-  0x6a, 0xfe, 0xab, 0xf1, 0xaa, 0xaa, 0x8f, 0x21, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x20, 0xff, 0xe0,
-  0x3d, 0xff, 0x57, 0xf1, 0xd5, 0x55, 0x0f, 0x01, 0x7f, 0xdf, 0x7f, 0xdf, 0xff, 0xff, 0xd0, 0x00, 0xe0, 0xe0,
-  0x2f, 0xfe, 0xae, 0xf9, 0xea, 0xaa, 0x1e, 0x21, 0xbf, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x20, 0xfa, 0xe0,
-  0x02, 0xff, 0xd6, 0x78, 0xf5, 0x54, 0x1c, 0x10, 0xdf, 0xd7, 0x7f, 0xff, 0xff, 0xff, 0xf4, 0x10, 0xe0, 0xe0,
-  0x40, 0x6f, 0xec, 0x78, 0xea, 0xa8, 0x1f, 0x00, 0x3e, 0xae, 0xbf, 0xff, 0xff, 0xff, 0xea, 0x00, 0xff, 0xe0,
-  0x7c, 0x46, 0xfc, 0x3c, 0xf5, 0x50, 0x1f, 0x80, 0x1f, 0x55, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x00, 0xe0, 0xe0,
-  0x20, 0x00, 0x0c, 0x1c, 0x7a, 0xa0, 0x1f, 0xc0, 0x3f, 0xee, 0xbf, 0xff, 0xff, 0xff, 0xea, 0x80, 0xfc, 0xe0,
-  0x00, 0x03, 0x7e, 0x1c, 0x7d, 0x50, 0x1f, 0xc0, 0x3f, 0xf7, 0x7f, 0xdf, 0xff, 0xff, 0xfd, 0x40, 0xe0, 0xe0,
-  0x00, 0x2f, 0xff, 0x0e, 0x3e, 0xa0, 0x1f, 0xc0, 0x3f, 0xfa, 0xbf, 0xdf, 0xff, 0xff, 0xee, 0xa0, 0xff, 0xe0,
-  0x03, 0x6f, 0xcf, 0x0e, 0x1f, 0x40, 0x8f, 0x80, 0x7f, 0xfd, 0x7b, 0xff, 0xff, 0xff, 0xdd, 0x40, 0xe0, 0xe0,
-  0x17, 0xff, 0x8f, 0x07, 0x0b, 0x80, 0x8b, 0x08, 0x3f, 0xfa, 0xb7, 0xef, 0xff, 0xff, 0xea, 0xa0, 0xfc, 0xe0,
-  0x3f, 0xdf, 0x07, 0x83, 0x0d, 0xc0, 0x8c, 0x10, 0x7f, 0xfd, 0x77, 0xef, 0xff, 0xff, 0xdc, 0x40, 0xe0, 0xe0,
-  0x3e, 0xaf, 0x83, 0x81, 0x8c, 0xe0, 0x8e, 0x10, 0x3f, 0xfa, 0xb7, 0xef, 0xff, 0xff, 0xae, 0x20, 0xff, 0xe0,
-  0x7d, 0x57, 0xc3, 0xc0, 0xc4, 0x60, 0xce, 0x10, 0x3f, 0xf5, 0x77, 0xf7, 0xff, 0xff, 0xd4, 0x40, 0xe0, 0xe0,
-  0x6a, 0xab, 0xe3, 0xc0, 0x46, 0x60, 0xcc, 0x18, 0x3f, 0xa8, 0xb3, 0xff, 0xff, 0xff, 0xaa, 0xa0, 0xea, 0xe0,
-  0x7f, 0x55, 0xf1, 0xf0, 0x22, 0x70, 0x84, 0x38, 0x1f, 0xd5, 0x77, 0xff, 0xff, 0xff, 0x54, 0x40, 0xee, 0xe0,
-  0x3f, 0xea, 0xf9, 0xf8, 0x01, 0x30, 0x84, 0x10, 0x1f, 0xaa, 0xa3, 0xff, 0xff, 0xff, 0xaa, 0x80, 0xff, 0xe0,
-  0x5f, 0xfd, 0x78, 0xdc, 0x00, 0x38, 0x42, 0x10, 0x1f, 0xc1, 0x57, 0xff, 0xff, 0xff, 0xd5, 0x00, 0xe0, 0xe0,
-  0x3b, 0xaa, 0xbc, 0x6e, 0x00, 0x38, 0x00, 0x08, 0x0f, 0x02, 0xaf, 0xff, 0xff, 0xff, 0xea, 0x00, 0xfa, 0xe0,
-  0x7d, 0x75, 0x5e, 0x77, 0x80, 0x1c, 0x00, 0x00, 0x1c, 0x01, 0x57, 0xff, 0xf7, 0xff, 0xf5, 0x00, 0xe4, 0xe0,
-  0x7f, 0xfe, 0xaf, 0x3b, 0xc0, 0x0f, 0xed, 0x00, 0x08, 0x02, 0x2f, 0xaf, 0xcf, 0xff, 0xf8, 0x80, 0xff, 0xe0,
-  0x3f, 0xe7, 0xf5, 0x9d, 0x70, 0x03, 0x80, 0x00, 0x0c, 0x01, 0x57, 0xf7, 0xff, 0xff, 0xf5, 0x00, 0xe0, 0xe0,
-  0x50, 0xd7, 0x3e, 0xfe, 0xbc, 0x01, 0xff, 0x68, 0x0e, 0x02, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x80, 0xea, 0xe0,
-  0x6d, 0x50, 0x9f, 0xfd, 0x5e, 0x00, 0xe0, 0x00, 0x04, 0x01, 0x57, 0xff, 0xff, 0xff, 0xf1, 0x40, 0xe4, 0xe0,
-  0x7f, 0xb5, 0xac, 0xfe, 0xaf, 0x80, 0x7f, 0xff, 0xff, 0xda, 0x2f, 0xff, 0xff, 0xff, 0xf8, 0x80, 0xff, 0xe0,
-  0x7f, 0xff, 0xf2, 0x77, 0x57, 0xc0, 0x1f, 0x48, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf1, 0x40, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0x81, 0xaa, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x7f, 0xfe, 0xc8, 0x2f, 0x55, 0x5f, 0x8f, 0xea, 0x80, 0x00, 0x03, 0xfb, 0xf5, 0xfd, 0x40, 0x00, 0xee, 0xe0,
-  0x7f, 0xf8, 0xb3, 0xfa, 0xaa, 0xab, 0xfd, 0x54, 0x00, 0x00, 0x03, 0xf5, 0x7a, 0xfe, 0xa8, 0x00, 0xff, 0xe0,
-  0x6f, 0x56, 0x7f, 0x55, 0x55, 0x55, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x65, 0x17, 0xfe, 0xaa, 0xaa, 0xaa, 0xad, 0x20, 0x00, 0x00, 0x03, 0x92, 0xff, 0xff, 0xfa, 0x80, 0xfa, 0xe0,
-  0x59, 0x67, 0xfd, 0x55, 0x55, 0x55, 0x5f, 0xff, 0xff, 0xff, 0xb5, 0xc7, 0xff, 0xff, 0xf1, 0x10, 0xe0, 0xe0,
-  0x3e, 0x7f, 0xfa, 0xaa, 0xaa, 0xaa, 0xf8, 0x00, 0x00, 0x00, 0x0b, 0xab, 0xff, 0xff, 0xba, 0x20, 0xff, 0xe0,
-  0x7f, 0xff, 0xf5, 0x55, 0x55, 0x55, 0xe0, 0x00, 0x00, 0x00, 0x05, 0x4f, 0xff, 0xff, 0x7c, 0x20, 0xe0, 0xe0,
-  0x3f, 0xff, 0xea, 0xba, 0xaa, 0xab, 0xff, 0x6a, 0x00, 0x88, 0x0b, 0xdb, 0xff, 0xfa, 0xf8, 0x20, 0xfc, 0xe0,
-  0x7f, 0xff, 0x57, 0xf5, 0x5d, 0x57, 0x00, 0x01, 0x40, 0x90, 0x15, 0xd7, 0xff, 0xdf, 0xf8, 0x30, 0x60, 0xe0,
-  0x3f, 0xfe, 0xaf, 0xaa, 0xfa, 0xab, 0xb4, 0x02, 0x81, 0x98, 0x0a, 0x9b, 0xff, 0xff, 0xf8, 0x38, 0x7f, 0xe0,
-  0x5f, 0xf5, 0x7f, 0x55, 0xf5, 0x56, 0x00, 0x09, 0x81, 0x90, 0x15, 0xdf, 0xff, 0xff, 0xf8, 0x30, 0x3f, 0xe0,
-  0x6f, 0xaa, 0xfe, 0xab, 0xea, 0xac, 0x00, 0x12, 0xc1, 0x80, 0x2a, 0xbf, 0xff, 0xff, 0xf8, 0x10, 0x0f, 0xe0,
-  0x55, 0xfd, 0xfd, 0x57, 0xd5, 0x5c, 0x00, 0x31, 0xa1, 0x60, 0x15, 0xef, 0xff, 0xff, 0xfd, 0x10, 0x10, 0xa0,
-  0x2a, 0xff, 0xfe, 0xaf, 0xaa, 0xb8, 0x00, 0x33, 0xe9, 0xf0, 0x2a, 0xef, 0xff, 0xff, 0xfa, 0x08, 0x0b, 0x80,
-  0x57, 0xff, 0xfd, 0x5f, 0x55, 0x70, 0x00, 0x35, 0xd7, 0xf1, 0x15, 0x7f, 0xff, 0xff, 0xf6, 0x00, 0x07, 0x00,
-  0x3f, 0xff, 0xfa, 0xbf, 0xaa, 0xb0, 0x00, 0x7a, 0xab, 0xfa, 0x0e, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x03, 0xa0,
-  0x7f, 0xff, 0xfd, 0x7f, 0x55, 0x60, 0x00, 0x6d, 0xd7, 0xfa, 0x1d, 0x7f, 0xff, 0xff, 0xd7, 0x00, 0x05, 0x00,
-  0x6f, 0xff, 0xfa, 0xbe, 0xaa, 0xe0, 0x04, 0xfe, 0xab, 0xf2, 0x0a, 0xff, 0xff, 0xff, 0xfa, 0x80, 0x0b, 0x20,
-  0x05, 0xff, 0xf5, 0x7f, 0x55, 0xc0, 0x04, 0xfd, 0x55, 0xe2, 0x0d, 0x7f, 0xff, 0xdf, 0xd7, 0x00, 0x15, 0xc0,
-  0x41, 0x6f, 0xfa, 0xee, 0xab, 0xe0, 0x04, 0x7e, 0xab, 0x82, 0x0a, 0xff, 0xff, 0xef, 0xea, 0x80, 0x0a, 0x20,
-  0x78, 0x27, 0x75, 0xf7, 0x57, 0xd0, 0x04, 0x7d, 0x55, 0x83, 0x0d, 0xff, 0xff, 0xff, 0xd5, 0x00, 0x15, 0x40,
-  0x20, 0x00, 0x1f, 0xff, 0xab, 0xa8, 0x04, 0x62, 0xad, 0x82, 0x0e, 0xff, 0xff, 0xef, 0xaa, 0x80, 0x2a, 0x20,
-  0x00, 0x0a, 0xf7, 0xf7, 0x57, 0x54, 0x06, 0x6d, 0x15, 0x82, 0x0d, 0xff, 0xfd, 0xff, 0xd5, 0x00, 0x34, 0x20,
-  0x00, 0x2f, 0xef, 0xfb, 0xaf, 0xaa, 0x04, 0xfe, 0x8f, 0xb0, 0x0c, 0xff, 0xfb, 0xeb, 0xaa, 0x00, 0x6a, 0x20,
-  0x24, 0xbf, 0x7f, 0xf5, 0xd7, 0x54, 0x04, 0xff, 0x5f, 0x7c, 0x0d, 0xff, 0xfb, 0xff, 0xd4, 0x10, 0x55, 0x60,
-  0x2d, 0xff, 0xbf, 0xea, 0xee, 0xaa, 0x02, 0xff, 0xaf, 0xfc, 0x1d, 0xff, 0xfb, 0xeb, 0xaa, 0x22, 0x6a, 0x60,
-  0x3f, 0xff, 0xd7, 0xf5, 0xdd, 0x55, 0x00, 0xff, 0x7f, 0xfe, 0x1f, 0xff, 0xfb, 0xdd, 0xd4, 0x04, 0xd5, 0x60,
-  0x7e, 0xff, 0xaa, 0xea, 0xfe, 0xaa, 0x80, 0x7e, 0xef, 0xfe, 0x1f, 0xff, 0xfd, 0xeb, 0xa0, 0x26, 0xeb, 0xe0,
-  0x7d, 0x7f, 0xd5, 0x75, 0xfd, 0x55, 0x50, 0x7d, 0x5f, 0xfe, 0x5f, 0xff, 0xff, 0xdd, 0x40, 0x45, 0xff, 0xe0,
-  0xbe, 0xbf, 0xea, 0xaa, 0xfa, 0xaa, 0xa0, 0x7a, 0xef, 0xfc, 0xdf, 0xff, 0xff, 0xaf, 0xa0, 0xae, 0xff, 0xd0,
-  0x9f, 0x5f, 0xfd, 0x75, 0x75, 0x55, 0x40, 0x7d, 0xd7, 0xfc, 0x9f, 0xff, 0xff, 0x55, 0x40, 0x5d, 0xff, 0xd0,
-  0xce, 0xaf, 0xfe, 0xba, 0xea, 0xaa, 0x80, 0x1a, 0xef, 0xfe, 0xdf, 0xff, 0xfe, 0xba, 0xa0, 0xaf, 0xff, 0xb0,
-  0xe7, 0x57, 0xfd, 0x55, 0x75, 0x55, 0x00, 0x55, 0xd7, 0xfe, 0x9f, 0xfb, 0xfd, 0x55, 0x51, 0x5d, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam13 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam13_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM14
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM14
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM14 uint8_t hammerbeam14_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x00, 0x00, 0x3c, 0x3f, 0xff, 0xff, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfe, 0x70,
-  0xc0, 0x00, 0x10, 0x3e, 0x3f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xc7, 0xfe, 0xff, 0xb0,
-  0x90, 0x00, 0x08, 0x1e, 0x1f, 0xf8, 0xff, 0x7f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xd0,
-  0xa0, 0x00, 0x0c, 0x0f, 0x1f, 0x7d, 0xff, 0xfe, 0xff, 0xff, 0x8f, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xd0,
-  0x50, 0x00, 0x06, 0x07, 0x8f, 0xff, 0xff, 0xfc, 0x7f, 0x7f, 0xdf, 0xfc, 0x7f, 0xff, 0xff, 0xfe, 0xfb, 0xe0,
-  0x60, 0x00, 0x03, 0x07, 0x8f, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x01, 0x03, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x60, 0x00, 0x01, 0x83, 0xc7, 0xff, 0xef, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x00, 0x81, 0xe7, 0xf7, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x60, 0x00, 0x00, 0xc0, 0xf3, 0xff, 0xff, 0xf0, 0x3f, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x00, 0x60, 0x7b, 0xff, 0xff, 0x80, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x60, 0x00, 0x00, 0x22, 0x19, 0xff, 0xff, 0x03, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xbf, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x3f, 0xe1, 0x8d, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x60, 0x00, 0xff, 0xf0, 0xc4, 0xff, 0xf8, 0x0f, 0xf7, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x01, 0xfd, 0xf0, 0x62, 0x7e, 0xf0, 0x03, 0xe3, 0xfb, 0xfe, 0x03, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x60, 0x07, 0xf3, 0xc0, 0x30, 0x3f, 0xe0, 0x7f, 0xf7, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xfd, 0xfe, 0xe0, 0xe0,
-  0x50, 0x1f, 0x07, 0xc4, 0x38, 0x1f, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xfe, 0xf8, 0xfe, 0xfc, 0xe0,
-  0x60, 0x10, 0x07, 0x82, 0x1c, 0x07, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xfd, 0xfe, 0xe0, 0xe0,
-  0x50, 0x20, 0x0f, 0x83, 0x0e, 0x03, 0x80, 0x07, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x60, 0x00, 0x1f, 0xc1, 0x03, 0x81, 0x87, 0xfe, 0xff, 0xfb, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x00, 0x3f, 0xc1, 0x80, 0x40, 0xc1, 0xff, 0xfd, 0xf1, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xfe, 0xea, 0xe0,
-  0x60, 0x00, 0x7d, 0xe0, 0xc0, 0x00, 0x60, 0x7f, 0xff, 0xfb, 0xff, 0xfc, 0x01, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x50, 0x00, 0xec, 0xf0, 0x60, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x60, 0x03, 0x9c, 0x7c, 0x38, 0x03, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfe, 0xe0, 0xe0,
-  0x50, 0x06, 0x3c, 0x0e, 0x1c, 0x0f, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xde, 0xfa, 0xe0,
-  0x60, 0x08, 0x78, 0x00, 0x0f, 0x1e, 0x1f, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xfc, 0xe4, 0xe0,
-  0x50, 0x00, 0xd0, 0x00, 0x7e, 0x3e, 0x3e, 0x00, 0x03, 0xff, 0xbf, 0xff, 0x80, 0x00, 0x7f, 0xfc, 0xff, 0xe0,
-  0x60, 0x01, 0xb0, 0x00, 0xfc, 0x3f, 0xfc, 0x0e, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xfc, 0xe0, 0xe0,
-  0x50, 0x03, 0x20, 0x07, 0xf0, 0x6d, 0xf8, 0x03, 0x0f, 0xff, 0xff, 0xbf, 0xc0, 0x00, 0xff, 0xfc, 0xea, 0xe0,
-  0x60, 0x06, 0x60, 0x3f, 0xe0, 0x1f, 0xf0, 0xff, 0x80, 0x1f, 0xff, 0x1f, 0xe0, 0x00, 0x0f, 0xfc, 0xe4, 0xe0,
-  0x50, 0x0e, 0x40, 0x7f, 0xc0, 0x3f, 0xc0, 0x1f, 0xc3, 0xff, 0xff, 0xbf, 0xe0, 0x01, 0xff, 0xfc, 0xff, 0xe0,
-  0x60, 0x0c, 0x40, 0xff, 0x80, 0xf7, 0x83, 0xfd, 0xc0, 0x7b, 0xff, 0xff, 0xf0, 0x03, 0xbf, 0xfc, 0xe0, 0xe0,
-  0x50, 0x0c, 0x81, 0xff, 0x81, 0xe3, 0x00, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xea, 0xe0,
-  0x60, 0x08, 0x83, 0xdf, 0x03, 0xc3, 0x03, 0xff, 0xe0, 0x3f, 0x80, 0x3f, 0xd8, 0x00, 0xff, 0xf8, 0xee, 0xe0,
-  0x50, 0x19, 0x87, 0x3e, 0x47, 0x91, 0x8f, 0xff, 0xe1, 0xff, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xf8, 0xff, 0xe0,
-  0x60, 0x11, 0x0e, 0x7f, 0x83, 0x63, 0x81, 0xfb, 0xe0, 0xfe, 0x04, 0x1f, 0xfc, 0x01, 0xff, 0xf8, 0xe0, 0xe0,
-  0x50, 0x21, 0x1c, 0xff, 0x07, 0xc6, 0x03, 0xb1, 0xf0, 0x1e, 0x0e, 0x0f, 0xfe, 0x00, 0x7f, 0xf0, 0xfa, 0xe0,
-  0x60, 0x02, 0x31, 0xff, 0x0f, 0x8c, 0x1f, 0xfb, 0xf0, 0x7e, 0x02, 0x03, 0xfe, 0x00, 0x03, 0xf0, 0xe0, 0xe0,
-  0x50, 0x06, 0x21, 0xfe, 0x1f, 0x18, 0x03, 0xff, 0xf1, 0xfe, 0x1f, 0x07, 0xff, 0x00, 0x1f, 0xf0, 0xff, 0xe0,
-  0x60, 0x04, 0x43, 0xfc, 0x3e, 0x30, 0x1f, 0xff, 0xf0, 0x0e, 0x07, 0x0f, 0xff, 0x00, 0x00, 0x60, 0xe0, 0xe0,
-  0x50, 0x04, 0x03, 0xfc, 0x3c, 0x20, 0x7e, 0xff, 0xf0, 0x7e, 0x03, 0x07, 0xff, 0xc0, 0x03, 0xc0, 0xfc, 0xe0,
-  0x60, 0x04, 0x07, 0xf9, 0x78, 0x41, 0xff, 0xfe, 0xe0, 0x1e, 0x0f, 0x03, 0xef, 0xe0, 0x01, 0x80, 0x60, 0xe0,
-  0x50, 0x08, 0x0f, 0xf3, 0x78, 0xe3, 0xff, 0xff, 0xe0, 0x1e, 0x01, 0x8f, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xe0,
-  0x60, 0x08, 0x0f, 0xf2, 0xf0, 0xc7, 0x70, 0x0f, 0xe0, 0xfe, 0x1f, 0x8f, 0xff, 0xdc, 0x00, 0x00, 0xbf, 0xe0,
-  0x50, 0x08, 0x0f, 0xe7, 0xf1, 0x8f, 0xc0, 0x07, 0xe3, 0xf6, 0x07, 0x83, 0xff, 0xff, 0x00, 0x7f, 0xcf, 0xe0,
-  0x60, 0x18, 0x0f, 0xc7, 0xe3, 0x1f, 0x00, 0x01, 0xe1, 0xfe, 0x00, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa0,
-  0x50, 0x18, 0x0f, 0xc7, 0xc7, 0x3e, 0x03, 0x87, 0xe0, 0x7c, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x60, 0x10, 0x0f, 0x8f, 0x86, 0x3c, 0x7f, 0xc0, 0x61, 0xfc, 0x07, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x50, 0x10, 0x1f, 0x8f, 0x06, 0x78, 0x1f, 0xc3, 0xf0, 0x7c, 0x1f, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x60, 0x20, 0x1f, 0x1e, 0x0d, 0xf0, 0xff, 0xe1, 0xf0, 0x08, 0x03, 0xc0, 0x3f, 0xff, 0xff, 0xef, 0xbf, 0xe0,
-  0x50, 0x00, 0x3f, 0x1e, 0x0d, 0xe0, 0x7d, 0xe0, 0x30, 0x78, 0x1f, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe0,
-  0x60, 0x00, 0x3e, 0x3c, 0x1d, 0xc3, 0xff, 0xe1, 0xf1, 0xf8, 0x0f, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xbf, 0xe0,
-  0x50, 0x00, 0x3e, 0x78, 0x3f, 0x80, 0x3f, 0xf0, 0x10, 0x38, 0x01, 0xc0, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xc0,
-  0x60, 0x00, 0x7e, 0x70, 0x3f, 0x8f, 0xff, 0xf0, 0xf0, 0xf0, 0x1f, 0xc0, 0xbf, 0x8f, 0xff, 0xff, 0xff, 0x80,
-  0x50, 0x00, 0x7c, 0xe0, 0x7f, 0x00, 0x7f, 0xf0, 0x70, 0xe0, 0xff, 0xe0, 0x3f, 0xdf, 0xef, 0xff, 0xff, 0x00,
-  0x60, 0x00, 0x7d, 0xe0, 0x6f, 0x07, 0xff, 0xf0, 0x18, 0xc0, 0x1f, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x50, 0x00, 0x7b, 0xc0, 0xde, 0x01, 0xff, 0xf0, 0xfc, 0x03, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x60, 0x00, 0xdf, 0xc1, 0x9e, 0x07, 0xff, 0x70, 0x07, 0xff, 0xf7, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x50, 0x00, 0x9f, 0x83, 0xbe, 0x00, 0xfe, 0x30, 0x7f, 0xbf, 0xfe, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x20,
-  0x60, 0x01, 0x1f, 0x83, 0x3c, 0x0f, 0xff, 0x70, 0x3f, 0x1f, 0xfc, 0x60, 0x0f, 0xff, 0xfd, 0xff, 0x78, 0x20,
-  0x50, 0x00, 0x1f, 0x06, 0x3c, 0x03, 0xff, 0xf0, 0x03, 0xbf, 0xbe, 0xe0, 0x83, 0xff, 0xff, 0xff, 0xf0, 0x60,
-  0x60, 0x00, 0x3f, 0x04, 0x3c, 0x3f, 0xdf, 0xf0, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x90, 0x00, 0x3e, 0x04, 0x7c, 0x01, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xe1, 0xd0,
-  0xa0, 0x00, 0x3c, 0x0c, 0x7c, 0x0f, 0xff, 0xf0, 0x3f, 0xfd, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xe0, 0x10,
-  0xd0, 0x00, 0x3c, 0x08, 0x7c, 0x3f, 0xff, 0xf0, 0x01, 0xff, 0xfe, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0xb0,
-  0xe0, 0x00, 0x7c, 0x08, 0x78, 0x7f, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0x86, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam14 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam14_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM15
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM15
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM15 uint8_t hammerbeam15_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x02, 0xb7, 0xff, 0xfe, 0xae, 0xab, 0xab, 0x8e, 0x00, 0x02, 0x80, 0x0e, 0x00, 0xfa, 0x82, 0x00, 0x70,
-  0xc0, 0x02, 0x12, 0xff, 0xfd, 0x5f, 0x57, 0xd7, 0x57, 0x00, 0x05, 0x40, 0x1d, 0x00, 0x75, 0x01, 0x00, 0x30,
-  0x80, 0x00, 0x00, 0x37, 0xfe, 0xae, 0xaf, 0xac, 0xaf, 0x00, 0x02, 0x80, 0x0e, 0x80, 0x7a, 0x82, 0x00, 0x10,
-  0x80, 0x00, 0x00, 0x01, 0xfd, 0x5f, 0x5f, 0x5d, 0x57, 0x80, 0x05, 0x40, 0x17, 0x00, 0x7d, 0x05, 0x1f, 0x10,
-  0x00, 0x00, 0x00, 0x6f, 0xfa, 0xbe, 0xbe, 0xb8, 0xab, 0x80, 0x02, 0xa0, 0x0e, 0x80, 0x7a, 0x83, 0x04, 0x00,
-  0x00, 0x00, 0x0a, 0xff, 0xfd, 0x5f, 0x5f, 0x79, 0x55, 0x80, 0x05, 0x40, 0x07, 0x00, 0x7d, 0x05, 0x1f, 0x00,
-  0x00, 0x00, 0x2f, 0xff, 0xfa, 0xbe, 0xbe, 0xb2, 0xab, 0xc0, 0x02, 0xa0, 0x0f, 0x80, 0x7a, 0x83, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xfd, 0x7f, 0x5f, 0x71, 0x55, 0xc0, 0x05, 0x50, 0x07, 0x00, 0x7d, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x2f, 0xff, 0xfa, 0xbe, 0xbe, 0xe2, 0xaa, 0xc0, 0x02, 0xa0, 0x0f, 0x80, 0x7e, 0x83, 0x05, 0x00,
-  0x00, 0x00, 0x05, 0xff, 0xf5, 0x7f, 0x5d, 0x6d, 0x55, 0x60, 0x01, 0x50, 0x07, 0x40, 0x7d, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xfa, 0xfe, 0xbe, 0xee, 0xaa, 0xf0, 0x02, 0xa0, 0x0f, 0x80, 0x3e, 0x83, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x7f, 0xf5, 0xfd, 0x7d, 0xdd, 0x55, 0x70, 0x01, 0x50, 0x07, 0xc0, 0x3d, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x27, 0xff, 0xfa, 0xfe, 0xfb, 0x9e, 0xaa, 0xb8, 0x02, 0xa0, 0x0b, 0x80, 0x3e, 0x01, 0x03, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0x9f, 0x55, 0x58, 0x01, 0x50, 0x07, 0xc0, 0x3d, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x15, 0xff, 0xfb, 0xfb, 0xff, 0x9f, 0xaa, 0xb8, 0x02, 0xa8, 0x0b, 0xe0, 0x3e, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0xbf, 0xfd, 0xff, 0xff, 0x1f, 0x55, 0x58, 0x01, 0x50, 0x07, 0xd0, 0x3f, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x3f, 0xaa, 0xb8, 0x02, 0xa8, 0x0b, 0xe0, 0x3e, 0x01, 0x03, 0x00,
-  0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xfe, 0x5f, 0xd5, 0x58, 0x01, 0x50, 0x07, 0xd0, 0x3f, 0x01, 0x1f, 0x00,
-  0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xea, 0xbc, 0x02, 0xa8, 0x03, 0xe8, 0x3e, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0xdb, 0xff, 0xff, 0xff, 0xfe, 0x57, 0xd5, 0x5c, 0x01, 0x50, 0x07, 0xf0, 0x3f, 0x01, 0x1f, 0x00,
-  0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xaf, 0xea, 0xac, 0x02, 0xa8, 0x03, 0xe8, 0x3f, 0x81, 0x15, 0x00,
-  0x00, 0x3f, 0x6e, 0xff, 0xff, 0xff, 0xfd, 0x57, 0xf5, 0x5e, 0x01, 0x50, 0x07, 0xf4, 0x3f, 0x01, 0x11, 0x00,
-  0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xfc, 0xab, 0xfa, 0xae, 0x02, 0xa8, 0x03, 0xf8, 0x3f, 0x81, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5b, 0xff, 0xff, 0xf9, 0x57, 0xf5, 0x56, 0x01, 0x54, 0x05, 0xf4, 0x1f, 0x41, 0x1f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xfa, 0xab, 0xfa, 0xab, 0x02, 0xa8, 0x03, 0xfa, 0x1f, 0x81, 0x05, 0x00,
-  0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xf9, 0x55, 0xfd, 0x55, 0x81, 0x54, 0x05, 0xf5, 0x1f, 0x41, 0x1b, 0x00,
-  0x00, 0x00, 0x01, 0x9f, 0xff, 0xff, 0xfa, 0xaa, 0xfa, 0xab, 0xc2, 0xa8, 0x03, 0xfa, 0x1f, 0xa1, 0x00, 0x00,
-  0x00, 0x00, 0x2b, 0xbf, 0xff, 0xff, 0xf1, 0x55, 0xfd, 0x55, 0xe1, 0x54, 0x05, 0xfd, 0x1f, 0xc1, 0x1f, 0x00,
-  0x00, 0x03, 0x7b, 0xff, 0xff, 0xff, 0xf2, 0xaa, 0xfe, 0xaa, 0xf2, 0xa8, 0x03, 0xfa, 0x1f, 0xa1, 0x15, 0x00,
-  0x00, 0x17, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x7f, 0x5d, 0x71, 0x54, 0x01, 0xfd, 0x1f, 0xd1, 0x1b, 0x00,
-  0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xea, 0xaa, 0xbf, 0xae, 0xb8, 0xa8, 0x03, 0xfa, 0x9f, 0xa9, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x55, 0x7f, 0xd7, 0x5c, 0x54, 0x01, 0xfd, 0x1f, 0xd1, 0x1f, 0x00,
-  0x00, 0x57, 0x6e, 0xff, 0xff, 0xff, 0xea, 0xaa, 0xbf, 0xeb, 0xae, 0x2a, 0x03, 0xfe, 0x9f, 0xe9, 0x15, 0x00,
-  0x00, 0x01, 0x2a, 0x5f, 0xff, 0xff, 0xed, 0x55, 0x5f, 0xf7, 0xf7, 0x14, 0x01, 0xfd, 0x5f, 0xd1, 0x11, 0x00,
-  0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xde, 0xaa, 0xaf, 0xfb, 0xfb, 0x2a, 0x03, 0xfe, 0x9f, 0xe9, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xdf, 0x55, 0x5f, 0xfd, 0xfe, 0x54, 0x01, 0xff, 0x5f, 0xd5, 0x1f, 0x00,
-  0x00, 0x00, 0x00, 0x9d, 0xff, 0xff, 0xde, 0xaa, 0xaf, 0xfe, 0xfc, 0xaa, 0x02, 0xfe, 0xbf, 0xe9, 0x05, 0x00,
-  0x00, 0x00, 0x0d, 0xbf, 0xff, 0xff, 0xdf, 0x55, 0x57, 0xff, 0xfd, 0x54, 0x05, 0xff, 0x5f, 0xd5, 0x1f, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xbf, 0xab, 0xaa, 0xff, 0xf8, 0xaa, 0x02, 0xfe, 0xbf, 0xe9, 0x00, 0x00,
-  0x00, 0x00, 0x17, 0xff, 0xff, 0xff, 0xbf, 0xd5, 0xf5, 0x7f, 0xf1, 0x54, 0x05, 0xff, 0x5f, 0xf5, 0x1f, 0x00,
-  0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0xbf, 0xea, 0xfa, 0xbf, 0xe0, 0xaa, 0x0b, 0xff, 0xbf, 0xeb, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x1b, 0xef, 0xff, 0x9f, 0xf5, 0xfd, 0x7f, 0x81, 0x54, 0x05, 0xff, 0x5f, 0xf4, 0x9f, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xae, 0xff, 0xaf, 0xfa, 0xff, 0xbf, 0x00, 0xaa, 0x0b, 0xff, 0xbf, 0xea, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xb7, 0x9f, 0xfd, 0x5f, 0xdf, 0x01, 0x54, 0x15, 0xff, 0xdf, 0xf4, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xfe, 0xaf, 0xfe, 0x00, 0xba, 0x2b, 0xff, 0xbf, 0xfa, 0x30, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x97, 0xff, 0x57, 0xfc, 0x01, 0x55, 0x15, 0xff, 0xdf, 0xf5, 0x1f, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xab, 0xff, 0xaf, 0xfc, 0x00, 0xba, 0x2a, 0xff, 0xaf, 0xfa, 0x2a, 0xa0,
-  0x00, 0x00, 0x00, 0x16, 0xfb, 0xff, 0x95, 0xff, 0xf7, 0xf8, 0x01, 0x55, 0x15, 0xff, 0xdf, 0xf5, 0x15, 0x40,
-  0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x2a, 0xff, 0xff, 0xf8, 0x00, 0xba, 0x2a, 0xff, 0xef, 0xfa, 0x2a, 0xa0,
-  0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x55, 0x7f, 0xff, 0xf0, 0x01, 0x5d, 0x15, 0xff, 0xdf, 0xf5, 0x15, 0x40,
-  0x20, 0x00, 0x17, 0xff, 0xff, 0xff, 0x2a, 0xbf, 0xff, 0xf0, 0x00, 0xba, 0x2a, 0xff, 0xef, 0xfa, 0x0a, 0xa0,
-  0x7c, 0x00, 0x7e, 0xff, 0xff, 0xff, 0x55, 0x57, 0xff, 0xe0, 0x01, 0x5d, 0x15, 0x7f, 0xdf, 0xfd, 0x15, 0x40,
-  0x50, 0x00, 0x0a, 0x6f, 0xff, 0xff, 0x2a, 0xab, 0xff, 0xe0, 0x00, 0xba, 0xaa, 0xff, 0xef, 0xfa, 0x8a, 0xa0,
-  0x40, 0x00, 0x00, 0x2d, 0xdf, 0xfe, 0x55, 0x55, 0xff, 0xf0, 0x01, 0x5d, 0x15, 0x7f, 0xff, 0xfd, 0x15, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0xdb, 0xfe, 0xaa, 0xba, 0xbf, 0xe0, 0x00, 0xaa, 0xaa, 0xff, 0xef, 0xfe, 0x8a, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x55, 0x5f, 0x5f, 0xe0, 0x01, 0x5d, 0x15, 0x7f, 0xff, 0xff, 0xd5, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0xfe, 0xaa, 0xaf, 0xff, 0xc0, 0x00, 0xae, 0xaa, 0xff, 0xef, 0xff, 0xca, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0xfe, 0x55, 0x57, 0xff, 0xc0, 0x01, 0x5d, 0x55, 0x7f, 0xdf, 0xff, 0xd5, 0x40,
-  0x40, 0x00, 0x00, 0x06, 0xff, 0xfc, 0xaa, 0xab, 0xff, 0xc0, 0x00, 0xae, 0xaa, 0xff, 0xff, 0xff, 0xea, 0xa0,
-  0x68, 0x00, 0x00, 0x57, 0xff, 0xfd, 0x55, 0x55, 0xff, 0x80, 0x01, 0x5f, 0x55, 0x7f, 0xff, 0xff, 0xe5, 0x40,
-  0x7f, 0x00, 0x01, 0xff, 0x7f, 0xfc, 0xaa, 0xaa, 0xff, 0x80, 0x00, 0xae, 0xaa, 0xbf, 0xff, 0xff, 0xea, 0xa0,
-  0x74, 0x00, 0x00, 0x0a, 0x5f, 0x7d, 0x75, 0x55, 0xff, 0x00, 0x00, 0x5f, 0x55, 0x3f, 0xff, 0xff, 0xf5, 0x40,
-  0x80, 0x00, 0x00, 0x00, 0x0d, 0x58, 0xba, 0xaa, 0xff, 0x00, 0x00, 0xaf, 0xaa, 0x3f, 0xff, 0xff, 0xfa, 0x90,
-  0x94, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1b, 0x55, 0x7f, 0x00, 0x00, 0x5f, 0x55, 0x3f, 0xff, 0xff, 0xf5, 0x50,
-  0xd6, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xbe, 0x00, 0x00, 0xaf, 0xaa, 0x3f, 0xff, 0xff, 0xfa, 0xb0,
-  0xe7, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf5, 0x7e, 0x00, 0x00, 0x5f, 0xd5, 0x3f, 0xff, 0xff, 0xf4, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam15 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam15_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM16
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM16
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM16 uint8_t hammerbeam16_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0xef, 0xff, 0xff, 0x80, 0x00, 0x04, 0xff, 0xef, 0xab, 0xf0, 0xcf, 0xff, 0xc0, 0x00, 0xa0, 0x00, 0x70,
-  0xde, 0x0f, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x37, 0xd7, 0x55, 0xf0, 0xcf, 0xff, 0xc0, 0x01, 0x51, 0x00, 0x30,
-  0xba, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x01, 0xeb, 0xaa, 0xf8, 0xcf, 0xff, 0x80, 0x00, 0xa0, 0x00, 0x10,
-  0x94, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf7, 0x55, 0xf8, 0x77, 0xff, 0x80, 0x01, 0x51, 0x1f, 0x10,
-  0x57, 0xff, 0xfa, 0xa8, 0x00, 0x00, 0x02, 0xff, 0xeb, 0xaa, 0xf8, 0x67, 0xff, 0x80, 0x00, 0xa1, 0x04, 0x00,
-  0x4f, 0xff, 0xff, 0xbe, 0x90, 0x00, 0x2b, 0xff, 0xf5, 0xd5, 0xfc, 0x67, 0xff, 0x00, 0x01, 0x51, 0x1f, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xfa, 0xaa, 0xfe, 0x33, 0xff, 0x00, 0x00, 0xa1, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xe8, 0x01, 0x7f, 0xff, 0xf5, 0x55, 0x7e, 0x3b, 0xfe, 0x00, 0x01, 0x51, 0x1f, 0x00,
-  0x7f, 0xff, 0xff, 0xfe, 0xc0, 0x00, 0x57, 0xff, 0xfa, 0xaa, 0xff, 0x1d, 0xfc, 0x00, 0x00, 0xa1, 0x05, 0x00,
-  0x7f, 0xff, 0xff, 0xe4, 0x80, 0x00, 0x17, 0xff, 0xfd, 0x55, 0x7f, 0x9d, 0xfc, 0x00, 0x01, 0x41, 0x1f, 0x00,
-  0x7f, 0xff, 0xff, 0x40, 0x00, 0x00, 0x02, 0xff, 0xfa, 0xaa, 0xff, 0xce, 0xbc, 0x00, 0x00, 0xa1, 0x00, 0x00,
-  0x33, 0xff, 0xf5, 0x40, 0x00, 0x00, 0x00, 0x6f, 0xf5, 0x55, 0x77, 0xe7, 0x58, 0x00, 0x01, 0x41, 0x1f, 0x00,
-  0x48, 0x9f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfa, 0xaa, 0xb9, 0xfb, 0x98, 0x00, 0x00, 0xa1, 0x03, 0x00,
-  0x6a, 0x5f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x55, 0x7c, 0x3f, 0x98, 0x00, 0x00, 0x41, 0x1f, 0x00,
-  0x7f, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x7a, 0xaa, 0xbc, 0x1f, 0xc8, 0x00, 0x00, 0xa1, 0x00, 0x00,
-  0x7d, 0x0f, 0xa9, 0x00, 0x00, 0x00, 0x85, 0x77, 0xf5, 0x55, 0x5e, 0x0f, 0xe0, 0x00, 0x00, 0x41, 0x1f, 0x00,
-  0x6a, 0x7f, 0xfd, 0x40, 0x00, 0x05, 0xaf, 0x7f, 0xea, 0xaa, 0xae, 0x03, 0xe0, 0x00, 0x00, 0x81, 0x03, 0x00,
-  0x07, 0xff, 0xff, 0xf4, 0x00, 0x1f, 0xff, 0xff, 0xd5, 0x55, 0x5f, 0x03, 0xf0, 0x00, 0x00, 0x41, 0x1f, 0x00,
-  0x54, 0xff, 0xff, 0xff, 0x00, 0x02, 0xff, 0xff, 0xbf, 0xaa, 0xaf, 0x01, 0xf0, 0x00, 0x00, 0x81, 0x00, 0x00,
-  0x7a, 0xff, 0xff, 0xc8, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfd, 0x57, 0x80, 0xf8, 0x00, 0x00, 0x41, 0x1f, 0x00,
-  0x7f, 0x7f, 0x56, 0x80, 0x00, 0x00, 0x1b, 0x7f, 0xff, 0xfe, 0xab, 0xc0, 0xf8, 0x00, 0x00, 0x81, 0x15, 0x00,
-  0x74, 0x75, 0x44, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xd5, 0xc0, 0x78, 0x00, 0x00, 0x41, 0x11, 0x00,
-  0x69, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0xeb, 0xe0, 0x3c, 0x00, 0x00, 0x81, 0x00, 0x00,
-  0x2f, 0xe8, 0x00, 0x00, 0x00, 0x09, 0x4f, 0xff, 0xff, 0xe7, 0xf5, 0xe0, 0x1c, 0x00, 0x00, 0x41, 0x1f, 0x00,
-  0x1f, 0xfe, 0xa0, 0x00, 0x01, 0xfd, 0xdf, 0xff, 0xff, 0xf0, 0x7e, 0xf0, 0x1c, 0x00, 0x00, 0x81, 0x05, 0x00,
-  0x3f, 0xff, 0xb2, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0x78, 0x0c, 0x00, 0x00, 0x01, 0x1b, 0x00,
-  0x7f, 0xff, 0xff, 0xc0, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xf8, 0x06, 0x00, 0x00, 0x81, 0x00, 0x00,
-  0x7f, 0xff, 0xf9, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xf6, 0x01, 0xfc, 0x03, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x7f, 0xfe, 0xd0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xef, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x81, 0x15, 0x00,
-  0x7d, 0xaa, 0x40, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xd7, 0x80, 0x3e, 0x03, 0x80, 0x01, 0x01, 0x1b, 0x00,
-  0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0xab, 0xe0, 0x1e, 0x01, 0x80, 0x00, 0x01, 0x00, 0x00,
-  0x7e, 0xa0, 0x00, 0x00, 0x00, 0x89, 0x3b, 0xff, 0xd5, 0x55, 0xf0, 0x0f, 0x01, 0xc0, 0x00, 0x01, 0x1f, 0x00,
-  0x7f, 0xf5, 0x00, 0x00, 0x0a, 0xab, 0x7f, 0xfe, 0xaa, 0xaa, 0xf8, 0x07, 0x00, 0xc0, 0x00, 0x01, 0x15, 0x00,
-  0x7f, 0xff, 0xc0, 0x00, 0xff, 0xbf, 0xff, 0xfd, 0x55, 0x55, 0x78, 0x03, 0x80, 0xe0, 0x00, 0x01, 0x11, 0x00,
-  0x7f, 0xfc, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xea, 0xaa, 0xaa, 0xbc, 0x00, 0x80, 0x70, 0x00, 0x01, 0x00, 0x00,
-  0x7f, 0xa8, 0x00, 0x00, 0x01, 0x7f, 0xff, 0xd5, 0x55, 0x55, 0x5f, 0x00, 0x40, 0x60, 0x00, 0x01, 0x1f, 0x00,
-  0x7a, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xaa, 0xaa, 0xaa, 0xab, 0x80, 0x00, 0x30, 0x00, 0x01, 0x05, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x13, 0xbf, 0xff, 0x55, 0x75, 0x55, 0x55, 0xc0, 0x08, 0x38, 0x00, 0x01, 0x1f, 0x00,
-  0x7e, 0x50, 0x00, 0x00, 0x57, 0xff, 0xfe, 0xaf, 0xea, 0xaa, 0xaa, 0xe0, 0x04, 0x1c, 0x00, 0x01, 0x00, 0x00,
-  0x7f, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xfd, 0x7f, 0xd5, 0x55, 0x55, 0x78, 0x06, 0x0c, 0x00, 0x01, 0x1f, 0x00,
-  0x7f, 0xe4, 0x00, 0x00, 0xaf, 0xff, 0xea, 0xff, 0xaa, 0xaa, 0xaa, 0xbc, 0x03, 0x0e, 0x00, 0x01, 0x03, 0x00,
-  0x7f, 0x40, 0x00, 0x00, 0x06, 0xff, 0xd7, 0xff, 0xd5, 0x55, 0x55, 0x5e, 0x03, 0x86, 0x00, 0x00, 0x9f, 0x00,
-  0x72, 0x40, 0x00, 0x00, 0x00, 0x37, 0xaf, 0xff, 0xaa, 0xaa, 0xaa, 0xaf, 0x01, 0x83, 0x00, 0x00, 0x80, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x55, 0x55, 0x55, 0x57, 0xc1, 0xc1, 0x00, 0x00, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xfe, 0xaa, 0xaa, 0xaa, 0xaf, 0xf0, 0xf1, 0x80, 0x00, 0x30, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xfd, 0x55, 0x55, 0x55, 0x57, 0x7c, 0xf8, 0x80, 0x00, 0x0f, 0x40,
-  0x40, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xfa, 0xaa, 0xaa, 0xaa, 0xae, 0xaf, 0x78, 0xc0, 0x00, 0x00, 0x00,
-  0x68, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x55, 0x55, 0x5f, 0x57, 0xf8, 0x40, 0x00, 0x00, 0x00,
-  0x7f, 0x80, 0x00, 0x01, 0x37, 0xff, 0xff, 0xfa, 0xae, 0xaa, 0xaa, 0xbe, 0xaa, 0xfc, 0x60, 0x00, 0x00, 0x00,
-  0x72, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xf5, 0x5d, 0x55, 0x55, 0x7d, 0x55, 0xf7, 0x20, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xff, 0xea, 0xbe, 0xaa, 0xea, 0xbe, 0xab, 0xfb, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xd5, 0xfd, 0x55, 0xd5, 0x7d, 0x57, 0xf5, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0xdf, 0xff, 0xeb, 0xfa, 0xaf, 0xea, 0xfa, 0xab, 0xea, 0xc0, 0x00, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xd7, 0xf5, 0x5f, 0xd5, 0xf5, 0x57, 0xf5, 0xc0, 0x00, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x5f, 0xff, 0xff, 0xaf, 0xfa, 0xbf, 0xaa, 0xeb, 0xaf, 0xea, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xf7, 0x7f, 0xff, 0x5f, 0xf5, 0x7f, 0x55, 0xd7, 0x5f, 0xd5, 0x80, 0x00, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xb5, 0x2f, 0xff, 0xbf, 0xea, 0xff, 0xab, 0xee, 0xbf, 0xeb, 0x00, 0x00, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x05, 0xff, 0xff, 0xd5, 0xff, 0x55, 0xdd, 0x5f, 0xd7, 0x00, 0x00, 0x50, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xab, 0xfe, 0xab, 0xfa, 0xbf, 0xaa, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0xff, 0xd7, 0xff, 0x55, 0xfd, 0x7f, 0x56, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xaf, 0xfe, 0xab, 0xfa, 0xfe, 0xac, 0x00, 0x00, 0x28, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xdf, 0xff, 0x5f, 0xfd, 0x57, 0xf5, 0x7d, 0x5c, 0x04, 0x00, 0x14, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x5f, 0xfe, 0xff, 0xfe, 0xab, 0xea, 0xfa, 0xbc, 0x02, 0x00, 0x0a, 0x10,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xfd, 0xff, 0xfd, 0x57, 0xd5, 0xf5, 0xd8, 0x05, 0x00, 0x14, 0x10,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xfa, 0xaf, 0xab, 0xef, 0xb8, 0x02, 0x00, 0x0a, 0x30,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7f, 0xff, 0xf5, 0x5f, 0x55, 0xd7, 0x50, 0x01, 0x00, 0x14, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam16 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam16_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM17
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM17
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM17 uint8_t hammerbeam17_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe4, 0x29, 0x3d, 0xce, 0xff, 0xff, 0xfe, 0x80, 0x2a, 0x82, 0x00, 0x81, 0xa0, 0x2e, 0xaa, 0xaf, 0xfe, 0x70,
-  0xd4, 0x51, 0xbd, 0x8f, 0xff, 0xff, 0xf7, 0x00, 0x55, 0x40, 0x04, 0x01, 0x40, 0x3d, 0x55, 0x5e, 0xff, 0xb0,
-  0xa8, 0x29, 0x3d, 0x8f, 0xff, 0xff, 0xfe, 0x80, 0x2a, 0x82, 0x08, 0x81, 0xa0, 0x3a, 0xba, 0xaf, 0xff, 0xd0,
-  0x94, 0x50, 0x39, 0x8f, 0xff, 0xff, 0xf7, 0x00, 0x15, 0x00, 0x01, 0x00, 0xc0, 0xfd, 0x5d, 0x5e, 0xe0, 0xd0,
-  0x28, 0xa0, 0x3b, 0x8f, 0xff, 0xff, 0xf6, 0x80, 0x22, 0x00, 0x08, 0xa0, 0xe3, 0xfa, 0xba, 0xbe, 0xfb, 0xe0,
-  0x50, 0x50, 0x3b, 0x8f, 0xff, 0xff, 0xff, 0x00, 0x14, 0x00, 0x01, 0x50, 0x4d, 0x55, 0x7d, 0x5e, 0xe0, 0xe0,
-  0x28, 0xa0, 0x7d, 0x8f, 0xff, 0xff, 0x66, 0x80, 0xa0, 0x00, 0x08, 0xa8, 0x2a, 0xaa, 0xfa, 0xbe, 0xff, 0xe0,
-  0x11, 0x40, 0x7d, 0x8f, 0xff, 0xff, 0xf3, 0x01, 0x10, 0x00, 0x11, 0x50, 0x4c, 0x55, 0x7d, 0x5e, 0xe0, 0xe0,
-  0x28, 0x80, 0x3d, 0xcf, 0xff, 0xff, 0x66, 0x80, 0x00, 0x00, 0x08, 0xa8, 0x28, 0xaa, 0xfe, 0xae, 0xfa, 0xe0,
-  0x11, 0x00, 0x3d, 0xcf, 0xff, 0xff, 0x63, 0x01, 0x10, 0x00, 0x01, 0x54, 0x0d, 0x55, 0x7d, 0x56, 0xe0, 0xe0,
-  0x28, 0x00, 0x5d, 0xdf, 0xff, 0xfe, 0xf2, 0x82, 0x08, 0x00, 0x08, 0xaa, 0x26, 0xaa, 0xbe, 0xae, 0xff, 0xe0,
-  0x10, 0x40, 0x5e, 0xdf, 0xff, 0xff, 0x67, 0x00, 0x04, 0x00, 0x15, 0x55, 0x13, 0x55, 0x7f, 0x56, 0xe0, 0xe0,
-  0x08, 0x80, 0x5e, 0xdf, 0xff, 0xfe, 0x62, 0x82, 0x00, 0x00, 0x08, 0xaa, 0x02, 0xea, 0xbe, 0xae, 0xfc, 0xe0,
-  0x15, 0x40, 0x6e, 0xdf, 0xff, 0xfe, 0x63, 0x01, 0x00, 0x00, 0x11, 0x55, 0x05, 0xd5, 0x7f, 0x56, 0xe0, 0xe0,
-  0x0a, 0xa0, 0x6e, 0xde, 0xff, 0xff, 0x62, 0xfe, 0xc0, 0x00, 0x08, 0xaa, 0x86, 0xea, 0xbb, 0xae, 0xff, 0xe0,
-  0x15, 0x50, 0xee, 0xed, 0xff, 0xfc, 0x23, 0xfd, 0x70, 0x00, 0x11, 0x55, 0x09, 0xfd, 0x75, 0x56, 0xe0, 0xe0,
-  0x0a, 0xa0, 0xf7, 0x7d, 0xff, 0xfe, 0x63, 0xc2, 0x7c, 0x00, 0x08, 0xaa, 0x0b, 0xfa, 0xaa, 0xae, 0xfc, 0xe0,
-  0x15, 0x40, 0xf7, 0x7d, 0xff, 0xf4, 0x22, 0x01, 0x0f, 0x00, 0x11, 0x14, 0x1d, 0xdd, 0x55, 0x56, 0xe0, 0xe0,
-  0x0a, 0xa0, 0xf7, 0x7d, 0xff, 0xfc, 0x22, 0x02, 0x03, 0x80, 0x00, 0xa0, 0x1b, 0xde, 0xaa, 0xae, 0xff, 0xe0,
-  0x05, 0x50, 0xf7, 0x7d, 0xff, 0xf6, 0x62, 0x00, 0x01, 0xc0, 0x11, 0x10, 0x1d, 0xdd, 0x55, 0x56, 0xe0, 0xe0,
-  0x02, 0xa0, 0x77, 0x7d, 0xff, 0xf4, 0x22, 0x02, 0x00, 0x60, 0x00, 0x80, 0x07, 0xfe, 0xaa, 0xae, 0xea, 0xe0,
-  0x05, 0x50, 0x77, 0x7d, 0xdf, 0xfc, 0x22, 0x01, 0x00, 0x70, 0x01, 0x10, 0x47, 0xff, 0x55, 0xde, 0xee, 0xe0,
-  0x02, 0xa0, 0x7b, 0x7d, 0xbf, 0xf4, 0x22, 0x00, 0x00, 0x38, 0x00, 0x88, 0x87, 0xef, 0xaa, 0xee, 0xff, 0xe0,
-  0x05, 0x50, 0x7b, 0xbd, 0xbf, 0xd4, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x23, 0xef, 0x55, 0xdc, 0xe0, 0xe0,
-  0x02, 0xa8, 0x3b, 0xbd, 0xbf, 0xf4, 0x22, 0x00, 0x00, 0x18, 0x00, 0x80, 0xa3, 0xef, 0xaa, 0xee, 0xfa, 0xe0,
-  0x05, 0x50, 0x3b, 0xbd, 0xbf, 0xc4, 0x22, 0x00, 0x00, 0x14, 0x00, 0x01, 0x20, 0xef, 0x55, 0xfc, 0xe4, 0xe0,
-  0x0a, 0xa8, 0x3b, 0xb9, 0xbf, 0x50, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x02, 0xa0, 0xef, 0xaa, 0xfa, 0xff, 0xe0,
-  0x15, 0x50, 0x3b, 0xb9, 0xbf, 0xf4, 0x22, 0x00, 0x00, 0x16, 0x00, 0x01, 0x60, 0x6d, 0x55, 0xf4, 0xe0, 0xe0,
-  0x0a, 0xa8, 0x3b, 0xb9, 0xbf, 0x44, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x02, 0xb0, 0x7e, 0xaa, 0xfa, 0xea, 0xe0,
-  0x15, 0x50, 0x7b, 0xb9, 0xbf, 0x50, 0x02, 0x00, 0x00, 0x16, 0x04, 0x47, 0x70, 0xed, 0x55, 0xf4, 0xe4, 0xe0,
-  0x0a, 0xa8, 0x77, 0xb9, 0xbf, 0x44, 0x02, 0x00, 0x00, 0x0a, 0x08, 0x02, 0xb8, 0xfa, 0xaa, 0xfa, 0xff, 0xe0,
-  0x15, 0x50, 0x77, 0xb9, 0xdf, 0x40, 0x02, 0x00, 0x00, 0x14, 0x00, 0x47, 0x58, 0xfd, 0x55, 0xfc, 0xe0, 0xe0,
-  0x2a, 0xa8, 0x77, 0xb9, 0xff, 0x40, 0x02, 0x00, 0x00, 0x0a, 0x08, 0xa3, 0xb8, 0xfa, 0xab, 0xfa, 0xea, 0xe0,
-  0x15, 0x50, 0x77, 0x79, 0xff, 0x44, 0x02, 0x00, 0x00, 0x14, 0x00, 0x47, 0xd9, 0xd5, 0x55, 0xfc, 0xee, 0xe0,
-  0x2a, 0xa8, 0x77, 0x79, 0xff, 0x50, 0x22, 0x00, 0x00, 0x0e, 0x08, 0x07, 0xb9, 0xaa, 0xab, 0xfa, 0xff, 0xe0,
-  0x15, 0x50, 0xef, 0x7d, 0xff, 0x44, 0x02, 0x00, 0x00, 0x06, 0x04, 0x47, 0x59, 0xd5, 0x57, 0xf4, 0xe0, 0xe0,
-  0x22, 0xa0, 0xef, 0x7c, 0xff, 0xd4, 0x22, 0x00, 0x00, 0x0c, 0x08, 0x22, 0xb1, 0xfa, 0xbf, 0xea, 0xfa, 0xe0,
-  0x55, 0x40, 0xef, 0x7c, 0xff, 0x50, 0x22, 0x00, 0x00, 0x04, 0x04, 0x03, 0x71, 0xfd, 0x5f, 0xf4, 0xe0, 0xe0,
-  0x20, 0xa0, 0xef, 0x7c, 0xff, 0xd4, 0x02, 0x00, 0x00, 0x18, 0x0a, 0x02, 0xb1, 0xfa, 0xbf, 0xea, 0xff, 0xe0,
-  0x51, 0x40, 0xf7, 0x7c, 0xff, 0xf4, 0x22, 0x00, 0x00, 0x14, 0x05, 0x02, 0x23, 0xfd, 0x5f, 0xf4, 0xe0, 0xe0,
-  0x28, 0xa0, 0x77, 0x7c, 0xff, 0xd4, 0x22, 0x00, 0x00, 0x28, 0x0a, 0x82, 0xa2, 0xea, 0xbf, 0xea, 0xfc, 0xe0,
-  0x51, 0x40, 0x77, 0xbc, 0xff, 0xd4, 0x22, 0x04, 0x00, 0x70, 0x15, 0x10, 0x05, 0xd5, 0x5f, 0xd5, 0x60, 0xe0,
-  0x28, 0xa0, 0x77, 0xbc, 0xff, 0xfc, 0x22, 0x08, 0x00, 0x68, 0x0a, 0x28, 0x87, 0xaa, 0xaf, 0xea, 0x7f, 0xe0,
-  0x54, 0x50, 0x3b, 0xbc, 0xff, 0xd4, 0x62, 0x00, 0x01, 0xc0, 0x15, 0x54, 0x4d, 0x55, 0x57, 0xd5, 0x3f, 0xe0,
-  0x28, 0x20, 0x3b, 0xbe, 0xff, 0xf6, 0x22, 0x08, 0x03, 0x80, 0x08, 0xaa, 0x0e, 0xaa, 0xaf, 0xea, 0x8f, 0xe0,
-  0x54, 0x10, 0x3b, 0xbe, 0xff, 0xfc, 0x22, 0x00, 0x0f, 0x00, 0x11, 0x54, 0x1d, 0x55, 0x57, 0xf5, 0x70, 0xa0,
-  0x2a, 0x20, 0x3b, 0xbe, 0xff, 0xf4, 0x63, 0xc8, 0x7c, 0x00, 0x08, 0xaa, 0x0e, 0xaa, 0xae, 0xea, 0xbf, 0xe0,
-  0x55, 0x10, 0x37, 0xbe, 0xff, 0xfe, 0x23, 0xf7, 0xf0, 0x00, 0x11, 0x54, 0x1d, 0x55, 0x55, 0x75, 0x5f, 0xe0,
-  0x2a, 0x88, 0x37, 0xbe, 0xff, 0xfc, 0x62, 0xeb, 0xc0, 0x00, 0x8a, 0xaa, 0x0e, 0xaa, 0xaa, 0xba, 0xaf, 0xe0,
-  0x55, 0x40, 0x17, 0xbe, 0xff, 0xfe, 0x63, 0x14, 0x00, 0x01, 0x11, 0x54, 0x1d, 0x55, 0x55, 0x75, 0x57, 0xe0,
-  0x2a, 0x88, 0x0f, 0x7e, 0xff, 0xfe, 0xe2, 0x88, 0x00, 0x00, 0x0a, 0x88, 0x0e, 0xaa, 0xaa, 0xaa, 0xaf, 0xe0,
-  0x55, 0x44, 0x0f, 0x7f, 0x7f, 0xfe, 0x63, 0x00, 0x00, 0x01, 0x15, 0x40, 0x45, 0x55, 0x55, 0x75, 0x5f, 0xe0,
-  0x2a, 0xa0, 0x1f, 0x7f, 0xff, 0xff, 0x6a, 0x88, 0x00, 0x00, 0x8a, 0xa0, 0x22, 0xaa, 0xaa, 0xaa, 0xaf, 0xe0,
-  0x55, 0x50, 0x1f, 0x7b, 0xff, 0xfe, 0xe3, 0x00, 0x00, 0x11, 0x15, 0x50, 0x41, 0x5d, 0x55, 0x55, 0x57, 0xe0,
-  0x2a, 0xa0, 0x1f, 0x77, 0xff, 0xfe, 0x66, 0x88, 0x00, 0x20, 0x0a, 0xa0, 0xa2, 0xaa, 0xaa, 0xaa, 0xab, 0xe0,
-  0x55, 0x10, 0x1f, 0x77, 0xff, 0xff, 0xeb, 0x00, 0x00, 0x01, 0x14, 0x40, 0x40, 0x1d, 0x55, 0x55, 0x57, 0xe0,
-  0x28, 0x28, 0x1f, 0x77, 0xff, 0xfe, 0xe2, 0x80, 0x00, 0x20, 0x0a, 0x00, 0x02, 0x2e, 0xaa, 0xaa, 0xab, 0xe0,
-  0x50, 0x50, 0x1f, 0x77, 0xff, 0xff, 0xef, 0x00, 0x00, 0x10, 0x04, 0x00, 0x41, 0x0d, 0x55, 0x55, 0x57, 0xe0,
-  0x20, 0xa0, 0x1f, 0x77, 0xff, 0xff, 0xea, 0x80, 0x00, 0x28, 0x02, 0x00, 0x22, 0x0a, 0xaa, 0xaa, 0xab, 0xe0,
-  0x40, 0x50, 0x9f, 0x77, 0xff, 0xff, 0xef, 0x00, 0x00, 0x14, 0x00, 0x00, 0x01, 0x0d, 0x55, 0x55, 0x57, 0xe0,
-  0x00, 0x21, 0x1f, 0x77, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x0a, 0xaa, 0xaa, 0xab, 0xe0,
-  0x00, 0x51, 0x8f, 0x67, 0xff, 0xff, 0xef, 0x00, 0x00, 0x45, 0x00, 0x00, 0x01, 0x0d, 0x57, 0xd5, 0x57, 0xe0,
-  0x80, 0x21, 0x0f, 0x67, 0xff, 0xff, 0xee, 0x80, 0x00, 0x22, 0x02, 0x00, 0x20, 0x8a, 0xab, 0xaa, 0xaf, 0xd0,
-  0x81, 0x50, 0x87, 0x63, 0xff, 0xff, 0xff, 0x00, 0x40, 0x04, 0x01, 0x00, 0x00, 0x15, 0x5f, 0xd5, 0x5f, 0xd0,
-  0xc0, 0xa0, 0x06, 0xe3, 0xff, 0xff, 0xee, 0x80, 0x20, 0x28, 0x80, 0x00, 0x20, 0x2a, 0xff, 0xff, 0xff, 0xb0,
-  0xe5, 0x50, 0x06, 0xe3, 0xff, 0xff, 0xff, 0x00, 0x40, 0x11, 0x40, 0x40, 0x14, 0x57, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam17 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam17_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM18
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM18
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM18 uint8_t hammerbeam18_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0xfb, 0xbf, 0xf9, 0xc0, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-  0xca, 0xbb, 0xbf, 0xf3, 0xc0, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30,
-  0x97, 0xfb, 0x7f, 0xf3, 0x80, 0x60, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0xaa, 0xeb, 0x7f, 0xf3, 0x80, 0xe0, 0x00, 0x40, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x10,
-  0x45, 0xfb, 0x7f, 0xe7, 0x00, 0xc0, 0x00, 0x40, 0x06, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00,
-  0x2a, 0xba, 0xff, 0xe7, 0x00, 0xc0, 0x00, 0x80, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x17, 0xfa, 0xff, 0xe7, 0x01, 0x80, 0x00, 0x80, 0x0f, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xf9, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00,
-  0x2a, 0xb9, 0xe0, 0x03, 0x90, 0x04, 0x80, 0x00, 0x41, 0xd0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x17, 0xfb, 0x00, 0x00, 0x90, 0x04, 0x80, 0x01, 0xc9, 0xc8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xe9, 0x09, 0x00, 0xf0, 0x07, 0x88, 0x00, 0x48, 0xe8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xf9, 0x19, 0x00, 0x90, 0x04, 0x8e, 0x00, 0x78, 0xe4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00,
-  0x2a, 0xb8, 0x0f, 0x00, 0x9c, 0x04, 0xf8, 0x00, 0x4e, 0x74, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x17, 0xf8, 0x09, 0x80, 0x10, 0x04, 0x88, 0x00, 0x48, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xe8, 0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x3b, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x40, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00,
-  0x2a, 0xba, 0x48, 0x00, 0x02, 0x00, 0x00, 0x22, 0x00, 0x9d, 0x0c, 0x20, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x17, 0xfb, 0xc8, 0x01, 0xfa, 0x00, 0x00, 0x22, 0x00, 0x9d, 0x02, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xea, 0x78, 0x0e, 0x07, 0x80, 0x00, 0x3e, 0x00, 0xfd, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xf8, 0x49, 0x3d, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x9d, 0x00, 0x62, 0x00, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x2a, 0xb8, 0x49, 0x7e, 0x00, 0x0f, 0xff, 0xff, 0xf9, 0x9d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x11, 0x00,
-  0x17, 0xfa, 0x41, 0x7c, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x9d, 0x00, 0x04, 0xc0, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xea, 0x01, 0x3e, 0x08, 0x07, 0xff, 0xff, 0xff, 0x9d, 0xc0, 0x03, 0x20, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xfa, 0x41, 0x3c, 0x17, 0x03, 0xff, 0xff, 0xfc, 0x9d, 0x3e, 0x00, 0xd0, 0x00, 0x00, 0x01, 0x05, 0x00,
-  0x2a, 0xba, 0x47, 0xfa, 0x1a, 0x0f, 0x29, 0xff, 0xfe, 0x5d, 0x01, 0xc0, 0x3c, 0x00, 0x00, 0x01, 0x1b, 0x00,
-  0x17, 0xfa, 0x41, 0x3c, 0x1f, 0xf0, 0x18, 0xff, 0xfe, 0x5d, 0x00, 0x3c, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xeb, 0xc1, 0x38, 0x1f, 0xc0, 0x24, 0x8f, 0xfe, 0x5d, 0x00, 0x03, 0xc6, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xfa, 0x49, 0x34, 0x3e, 0x00, 0x2c, 0x48, 0xfe, 0x5d, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x2a, 0xba, 0x49, 0x39, 0xf0, 0x00, 0x04, 0x70, 0x4f, 0x5d, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0x1b, 0x00,
-  0x17, 0xfa, 0x4f, 0x3e, 0x7a, 0x5c, 0xbc, 0x59, 0x21, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xea, 0x49, 0x3e, 0xe0, 0x2c, 0xa6, 0x46, 0xab, 0xdd, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xfa, 0x49, 0x3e, 0xfd, 0x00, 0x0d, 0x5f, 0x56, 0x5d, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x01, 0x15, 0x00,
-  0x2a, 0xba, 0x49, 0x3e, 0x7a, 0xa0, 0x26, 0xea, 0xbe, 0x5d, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x01, 0x11, 0x00,
-  0x17, 0xf8, 0x79, 0x3d, 0xff, 0x55, 0x7d, 0xd5, 0xfe, 0x5d, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xe8, 0x49, 0x3a, 0xbf, 0xea, 0xba, 0xbf, 0xfe, 0x5d, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x45, 0xf8, 0x48, 0x3d, 0x15, 0x5f, 0x5d, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x01, 0x05, 0x00,
-  0x2a, 0xb8, 0x08, 0x3e, 0x9a, 0xab, 0xff, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x01, 0x1f, 0x00,
-  0x17, 0xf8, 0x08, 0x7d, 0x5f, 0xd7, 0xff, 0xff, 0xfc, 0x9d, 0xff, 0xff, 0xc0, 0x00, 0x60, 0x01, 0x00, 0x00,
-  0x2a, 0xe8, 0x00, 0x7e, 0x8e, 0xaf, 0xff, 0xff, 0xf9, 0x1d, 0xff, 0xff, 0x00, 0x00, 0x10, 0x01, 0x1f, 0x00,
-  0x45, 0xf8, 0x80, 0x3f, 0x45, 0x5f, 0xff, 0xff, 0xfe, 0x1d, 0xff, 0xfe, 0x00, 0x00, 0x28, 0x01, 0x03, 0x00,
-  0x2a, 0xbb, 0x90, 0x0e, 0xaa, 0xb9, 0x20, 0x90, 0x01, 0x3d, 0xff, 0xfc, 0x00, 0x00, 0x08, 0x00, 0x9f, 0x00,
-  0x17, 0xf8, 0xf2, 0x03, 0xd7, 0xc1, 0x20, 0xf0, 0x01, 0xfd, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-  0x2a, 0xe8, 0x92, 0x01, 0xfc, 0x01, 0x20, 0x90, 0x01, 0x3d, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
-  0x45, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-  0x2a, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x40,
-  0x17, 0xfb, 0xff, 0xfd, 0xbe, 0xff, 0xf7, 0xfd, 0xff, 0xf3, 0xfe, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xeb, 0xef, 0xfd, 0xbe, 0x3f, 0xb7, 0xfd, 0xbf, 0xf7, 0xfc, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0xfb, 0xed, 0xfc, 0x36, 0xfe, 0x37, 0xfc, 0x3f, 0xe7, 0xf8, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xbb, 0xec, 0xf1, 0xb0, 0xff, 0xb3, 0xfd, 0xbf, 0xef, 0xfc, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x17, 0xfb, 0xe1, 0xfd, 0x86, 0xff, 0x87, 0xf1, 0x8f, 0xcf, 0xf3, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xeb, 0x8d, 0xff, 0xb7, 0xff, 0xb7, 0xfd, 0xbf, 0xdf, 0xf8, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0xfb, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe6, 0x30, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x2a, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf1, 0x90, 0x2c, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x17, 0xfa, 0xff, 0xe7, 0x01, 0x80, 0x00, 0x80, 0x0f, 0x3f, 0xfc, 0x60, 0x0c, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x2a, 0xea, 0xff, 0xe7, 0x00, 0xc0, 0x00, 0x80, 0x07, 0x77, 0xff, 0x20, 0x04, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0x45, 0xfb, 0x7f, 0xe7, 0x00, 0xc0, 0x00, 0x40, 0x06, 0x43, 0xff, 0xc0, 0x08, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x2a, 0xbb, 0x7f, 0xf3, 0x80, 0xe0, 0x00, 0x40, 0x03, 0x80, 0xfa, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x17, 0xfb, 0x7f, 0xf3, 0x80, 0x60, 0x00, 0x20, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-  0x2a, 0xeb, 0xbf, 0xf3, 0xc0, 0x60, 0x00, 0x20, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x45, 0xfb, 0xbf, 0xf9, 0xc0, 0x30, 0x00, 0x10, 0x00, 0x00, 0x18, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0xbb, 0xbf, 0xf9, 0xc0, 0x30, 0x00, 0x08, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x97, 0xfb, 0xdf, 0xf8, 0xe0, 0x18, 0x00, 0x08, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0xaa, 0xeb, 0xdf, 0xfc, 0xe0, 0x18, 0x00, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0xc5, 0xfb, 0xdf, 0xfc, 0x70, 0x0c, 0x00, 0x02, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0xe2, 0xbb, 0xef, 0xfe, 0x70, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam18 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam18_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM19
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM19
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM19 uint8_t hammerbeam19_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x55, 0x55, 0x00, 0x00, 0x05, 0x7d, 0x55, 0x55, 0xf0, 0x03, 0xf7, 0xff, 0xd5, 0x7f, 0xff, 0xfe, 0x70,
-  0xc2, 0xaa, 0xaa, 0x80, 0x00, 0x02, 0xba, 0xae, 0xab, 0xf0, 0x07, 0xeb, 0xfd, 0xab, 0xff, 0xfe, 0xff, 0xb0,
-  0x80, 0x55, 0x55, 0x40, 0x00, 0x01, 0x5f, 0xd7, 0xd5, 0xe0, 0x0f, 0xf7, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xd0,
-  0xb0, 0x2a, 0xaa, 0xa0, 0x00, 0x82, 0xbf, 0xef, 0xfb, 0xe0, 0x0f, 0xef, 0xe1, 0xff, 0xff, 0xfe, 0xe0, 0xd0,
-  0x7c, 0x05, 0x55, 0x50, 0x00, 0x41, 0x7f, 0xd7, 0xfd, 0xe0, 0x1f, 0xdf, 0x73, 0xff, 0xff, 0xfe, 0xfb, 0xe0,
-  0x3f, 0x80, 0xaa, 0xaa, 0x00, 0x02, 0xff, 0xef, 0xff, 0xe0, 0x3f, 0xbc, 0x7f, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x5f, 0xe0, 0x55, 0x55, 0x00, 0x01, 0xff, 0xf7, 0xff, 0xc0, 0x7f, 0x70, 0x7f, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x2f, 0xfc, 0x02, 0xaa, 0x80, 0x01, 0xff, 0xef, 0xff, 0xe0, 0x3e, 0xe0, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x57, 0xff, 0x01, 0x55, 0x40, 0x01, 0xff, 0xf7, 0xff, 0xc0, 0x55, 0x50, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x2f, 0xff, 0xe0, 0x2a, 0xa0, 0x01, 0xff, 0xff, 0xff, 0xe0, 0xaa, 0xa1, 0xf8, 0x6a, 0xbf, 0xfe, 0xe0, 0xe0,
-  0x57, 0xff, 0xd0, 0x05, 0x54, 0x01, 0xff, 0xf7, 0xff, 0xc1, 0x55, 0x53, 0xf8, 0x75, 0x7f, 0xfe, 0xff, 0xe0,
-  0x2f, 0xff, 0xaa, 0x02, 0xaa, 0x01, 0xff, 0xff, 0xff, 0xe2, 0xaa, 0xa0, 0xf8, 0x6a, 0xab, 0xfe, 0xe0, 0xe0,
-  0x57, 0xff, 0x55, 0x40, 0x55, 0x00, 0xff, 0xff, 0xff, 0xe5, 0x55, 0x41, 0xfc, 0x35, 0x55, 0xfe, 0xfc, 0xe0,
-  0x2f, 0xff, 0xaa, 0xa0, 0x0a, 0x80, 0xff, 0xff, 0xff, 0xee, 0xaa, 0xa1, 0xfc, 0x2a, 0xab, 0xfe, 0xe0, 0xe0,
-  0x57, 0xff, 0x55, 0x54, 0x01, 0x40, 0x7f, 0xff, 0xff, 0xef, 0x55, 0x41, 0xfc, 0x15, 0x57, 0xfe, 0xff, 0xe0,
-  0x2f, 0xfe, 0xaa, 0xab, 0x80, 0xa0, 0x3f, 0xff, 0xff, 0x9f, 0xaf, 0xa1, 0xfc, 0x2a, 0xaf, 0xfe, 0xe0, 0xe0,
-  0x57, 0xff, 0x55, 0x57, 0x80, 0x14, 0x1f, 0xff, 0xf8, 0x07, 0xff, 0xe1, 0xfc, 0x15, 0x7f, 0xfe, 0xfc, 0xe0,
-  0x2b, 0xfe, 0xaa, 0xab, 0x84, 0x02, 0x1f, 0xff, 0x80, 0x23, 0xff, 0xe1, 0xfc, 0xab, 0xff, 0xfe, 0xe0, 0xe0,
-  0x57, 0xfd, 0x55, 0x57, 0x87, 0x00, 0x0f, 0xf8, 0x00, 0x50, 0xff, 0xe1, 0xfd, 0x57, 0xff, 0xfe, 0xff, 0xe0,
-  0x2b, 0xfe, 0xaa, 0xab, 0x87, 0xe0, 0x07, 0xc0, 0x00, 0xa0, 0x3f, 0xe1, 0xfa, 0xbf, 0xff, 0xfe, 0xe0, 0xe0,
-  0x55, 0xf5, 0x55, 0x57, 0x87, 0xf0, 0x03, 0x80, 0x01, 0x50, 0x1f, 0xe1, 0xd5, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x6a, 0xea, 0xaa, 0xab, 0x0f, 0xf8, 0x00, 0x22, 0x00, 0xa8, 0x07, 0xc3, 0xaf, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x75, 0x55, 0x55, 0x57, 0x0f, 0xf8, 0x71, 0x41, 0x01, 0x54, 0x03, 0xc3, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x7e, 0xaa, 0xaa, 0xab, 0x0f, 0xf8, 0x70, 0xa0, 0x22, 0xa8, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0x55, 0x55, 0x0f, 0xf8, 0x65, 0x50, 0x05, 0x54, 0x00, 0x03, 0xfe, 0x15, 0x55, 0xfe, 0xfa, 0xe0,
-  0x7f, 0xff, 0xfe, 0xaa, 0x0f, 0xf8, 0x0a, 0xa0, 0x0b, 0xaa, 0x00, 0x03, 0xfe, 0x0a, 0xab, 0xfe, 0xe4, 0xe0,
-  0x7f, 0xff, 0xfd, 0x55, 0x0f, 0xf8, 0x55, 0x50, 0x15, 0xf5, 0x01, 0x03, 0xfe, 0x15, 0x7f, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xea, 0x0f, 0xf8, 0xba, 0xa8, 0x2a, 0xae, 0x02, 0x23, 0xfe, 0x0a, 0xbf, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0x8f, 0xf8, 0x5f, 0x50, 0x55, 0x55, 0x10, 0x13, 0xfe, 0x15, 0x55, 0xfe, 0xea, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xab, 0xe8, 0x2a, 0xa8, 0x00, 0x23, 0xfe, 0x0a, 0xab, 0xfe, 0xe4, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x55, 0x74, 0x40, 0x04, 0x00, 0x53, 0xfc, 0x15, 0x55, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaa, 0xa8, 0x0a, 0xa8, 0x00, 0x2b, 0xfa, 0x0a, 0xab, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x55, 0x51, 0x55, 0x50, 0x04, 0x55, 0xfc, 0x15, 0x5f, 0xfe, 0xea, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0xef, 0xf2, 0xaa, 0x8a, 0xaa, 0x80, 0x02, 0xa9, 0xfe, 0x0a, 0xaf, 0xfe, 0xee, 0xe0,
-  0x7f, 0xff, 0xff, 0xff, 0x0f, 0xe5, 0x55, 0x15, 0x55, 0x00, 0x00, 0x54, 0xfe, 0x15, 0x5f, 0xfe, 0xff, 0xe0,
-  0x7f, 0xff, 0xff, 0xfb, 0x0f, 0x60, 0x00, 0xaa, 0xaa, 0x00, 0x00, 0x8a, 0xde, 0x0a, 0xbf, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xff, 0xff, 0xd7, 0x0f, 0xff, 0xff, 0x55, 0x50, 0x00, 0x01, 0x51, 0x7e, 0x15, 0x7f, 0xfe, 0xfa, 0xe0,
-  0x7f, 0xff, 0xea, 0xab, 0x0f, 0xff, 0xff, 0xaa, 0xa0, 0x00, 0x0a, 0xaa, 0x7e, 0x0a, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xfd, 0x55, 0x57, 0x0f, 0xff, 0xff, 0xd5, 0x40, 0x00, 0x15, 0x7c, 0xfe, 0x55, 0xff, 0xfe, 0xff, 0xe0,
-  0x7f, 0xfa, 0xaa, 0xab, 0x0f, 0xfa, 0xfe, 0xea, 0x00, 0x00, 0x2b, 0xe9, 0xfe, 0x2a, 0xff, 0xfe, 0xe0, 0xe0,
-  0x7f, 0xd5, 0x55, 0x55, 0x0f, 0xf8, 0x7f, 0x74, 0x01, 0x54, 0x5d, 0x53, 0xfc, 0x15, 0x5f, 0xfe, 0xfc, 0xe0,
-  0x7e, 0xaa, 0xaa, 0xaa, 0x0f, 0xf8, 0x3f, 0xfa, 0xab, 0xff, 0x2a, 0xa3, 0xfa, 0x0a, 0xab, 0xff, 0x60, 0xe0,
-  0x7d, 0x55, 0x55, 0x55, 0x0f, 0xf8, 0x5f, 0x7f, 0xff, 0xf7, 0x55, 0x43, 0xfc, 0x15, 0x57, 0xff, 0x7f, 0xe0,
-  0x7f, 0xaa, 0xaa, 0xaa, 0x0f, 0xf8, 0x6f, 0xfb, 0xff, 0xef, 0xaa, 0x83, 0xfa, 0x0a, 0xaa, 0xff, 0xbf, 0xe0,
-  0x7f, 0xd5, 0x7d, 0x55, 0x0f, 0xf8, 0x77, 0xf7, 0xff, 0x7f, 0x95, 0x43, 0xfc, 0x15, 0x55, 0xff, 0xcf, 0xe0,
-  0x7f, 0xab, 0xfa, 0xaa, 0x0f, 0xf8, 0x7b, 0xbf, 0xfb, 0xff, 0xca, 0xc3, 0xff, 0x8a, 0xaa, 0xbf, 0xf0, 0xa0,
-  0x7f, 0x57, 0xf5, 0x7f, 0x05, 0xf8, 0x7d, 0xf7, 0xd7, 0xff, 0xd5, 0xc3, 0xff, 0xf5, 0x55, 0x5f, 0xff, 0xe0,
-  0x3e, 0xaf, 0xea, 0xff, 0x0b, 0xf8, 0x6f, 0xff, 0xbf, 0xff, 0xeb, 0xc3, 0xff, 0xfe, 0xaa, 0xaf, 0xff, 0xe0,
-  0x7f, 0x5f, 0xd5, 0xff, 0x05, 0xf8, 0x5f, 0xfd, 0xff, 0xff, 0xe7, 0xc3, 0xfd, 0xff, 0xd5, 0x7f, 0xff, 0xe0,
-  0x3e, 0xbf, 0xeb, 0xff, 0x0b, 0xf8, 0x3f, 0xef, 0xff, 0xaa, 0xaf, 0xc3, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xe0,
-  0x55, 0x7f, 0xd7, 0xff, 0x85, 0xf1, 0x5f, 0xf5, 0x55, 0xff, 0xff, 0xe1, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xe0,
-  0x2a, 0xbf, 0xaf, 0xff, 0x83, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xe0,
-  0x55, 0x7f, 0x5f, 0xff, 0x85, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xe0,
-  0x2a, 0xff, 0xaf, 0xff, 0x82, 0xfa, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xfc, 0x2b, 0xff, 0xff, 0xff, 0xe0,
-  0x55, 0x7f, 0x57, 0xff, 0x85, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xfc, 0x15, 0xff, 0xff, 0xff, 0xe0,
-  0x6a, 0xff, 0xaf, 0xff, 0x82, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xfe, 0x2a, 0xff, 0xff, 0xff, 0xe0,
-  0x55, 0x7f, 0x57, 0xff, 0x85, 0x55, 0xfd, 0xff, 0xff, 0xfb, 0xff, 0xe5, 0xff, 0x15, 0x7f, 0xff, 0xff, 0xe0,
-  0x6a, 0xbf, 0xab, 0xff, 0x82, 0xaa, 0xfb, 0xff, 0xff, 0xf9, 0xff, 0xea, 0xff, 0xea, 0xbf, 0xff, 0xff, 0xe0,
-  0x75, 0x5f, 0xd5, 0xff, 0x85, 0x54, 0xfd, 0xff, 0xff, 0xf9, 0xff, 0xe5, 0x77, 0xf5, 0x5f, 0xff, 0xff, 0xe0,
-  0x6a, 0xaf, 0xaa, 0xff, 0x82, 0xab, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xf2, 0xa9, 0xfe, 0xab, 0xff, 0xff, 0xe0,
-  0x75, 0x5f, 0xd5, 0xff, 0x55, 0x55, 0xf5, 0xff, 0xff, 0xfc, 0x7f, 0xf1, 0x51, 0xff, 0x55, 0xff, 0xff, 0xe0,
-  0x7a, 0xaf, 0xea, 0xfa, 0xaa, 0xa8, 0xfa, 0xff, 0xff, 0xfc, 0x3f, 0xf0, 0xa8, 0xff, 0xaa, 0xff, 0xff, 0xe0,
-  0xbd, 0x5f, 0xf5, 0xfd, 0x55, 0x55, 0x55, 0x77, 0xff, 0xfc, 0x3f, 0xf0, 0x54, 0x7f, 0xf7, 0xff, 0xff, 0xd0,
-  0xbe, 0xaf, 0xeb, 0xfe, 0xaa, 0xa8, 0xaa, 0xeb, 0xff, 0xfc, 0x0f, 0xf0, 0xaa, 0x3f, 0xff, 0xff, 0xff, 0xd0,
-  0xdf, 0x5f, 0xf5, 0xff, 0x55, 0x51, 0x55, 0xf5, 0xff, 0xfc, 0x05, 0x50, 0x55, 0x5f, 0xff, 0xff, 0xff, 0xb0,
-  0xe7, 0xaf, 0xfb, 0xfe, 0xaa, 0xaa, 0xab, 0xfa, 0xff, 0xfc, 0x02, 0xa8, 0x2a, 0xbf, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam19 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam19_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM20
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM20
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM20 uint8_t hammerbeam20_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0xdf, 0xf5, 0x55, 0x55, 0x55, 0x55, 0xff, 0x57, 0xff, 0xf5, 0x00, 0x01, 0x10, 0x00, 0x04, 0x00, 0x70,
-  0xca, 0xab, 0xff, 0xfa, 0xaa, 0xaf, 0xff, 0xea, 0xff, 0xbf, 0xcb, 0x00, 0x01, 0xe0, 0x00, 0x2b, 0x00, 0x30,
-  0x81, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x5f, 0xfd, 0x7f, 0xc5, 0x80, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x10,
-  0xaa, 0xae, 0xeb, 0xff, 0xff, 0xfe, 0xab, 0xff, 0x8a, 0xbf, 0x82, 0xc0, 0x00, 0x83, 0xc0, 0x8b, 0x1f, 0x10,
-  0x05, 0xdf, 0xfd, 0x57, 0xff, 0x55, 0xff, 0xfc, 0x05, 0x5f, 0x81, 0x40, 0x00, 0x80, 0x00, 0x05, 0x04, 0x00,
-  0x2a, 0xab, 0xff, 0xfe, 0xab, 0xff, 0xff, 0xa8, 0x02, 0xbf, 0x80, 0xa0, 0x00, 0x40, 0x00, 0x2b, 0x1f, 0x00,
-  0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x01, 0x78, 0x81, 0x50, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xfa, 0xaf, 0xff, 0xff, 0xae, 0xa0, 0x02, 0xc0, 0x80, 0xb0, 0x00, 0x20, 0x00, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xff, 0xf5, 0x57, 0xd5, 0x7d, 0x40, 0x05, 0x00, 0x80, 0x50, 0x00, 0x20, 0xc0, 0x05, 0x05, 0x00,
-  0x2a, 0xab, 0xeb, 0xff, 0xaa, 0xfe, 0xba, 0x80, 0x0b, 0x00, 0x80, 0xa8, 0x00, 0x20, 0xc0, 0x2b, 0x1f, 0x00,
-  0x01, 0x7f, 0xff, 0x7f, 0xd5, 0x57, 0xf5, 0x00, 0x06, 0x00, 0x40, 0x58, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xff, 0xaf, 0xff, 0xaa, 0xaa, 0x00, 0x0a, 0x00, 0x40, 0x28, 0x00, 0x10, 0x00, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xf7, 0xd5, 0x55, 0x7f, 0xd4, 0x00, 0x14, 0x00, 0x40, 0x14, 0x00, 0x10, 0x00, 0x05, 0x03, 0x00,
-  0x2a, 0xab, 0xfe, 0xfa, 0xaf, 0xaa, 0xe8, 0x00, 0x2c, 0x00, 0x40, 0x2c, 0x00, 0x0e, 0x00, 0x2b, 0x1f, 0x00,
-  0x01, 0x7f, 0xff, 0x57, 0xd5, 0xfd, 0xd4, 0x00, 0x16, 0x00, 0x40, 0x14, 0x00, 0x09, 0x80, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xeb, 0xea, 0xfe, 0xab, 0xa8, 0x00, 0x2e, 0x03, 0xc0, 0x0c, 0x00, 0x04, 0x40, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xfd, 0x7d, 0x55, 0xfd, 0xd0, 0x00, 0x56, 0x07, 0xe0, 0x16, 0x00, 0x04, 0x00, 0x05, 0x03, 0x00,
-  0x2a, 0xab, 0xeb, 0xbf, 0xaa, 0xaf, 0xa0, 0x00, 0x2a, 0x07, 0xe0, 0x0a, 0x00, 0x04, 0x00, 0x2b, 0x1f, 0x00,
-  0x01, 0x7f, 0xf5, 0xf7, 0xf5, 0xf5, 0x50, 0x00, 0x17, 0x07, 0xe0, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xfe, 0xbe, 0xfe, 0xbf, 0xa0, 0x00, 0x2b, 0x03, 0xa0, 0x0b, 0x00, 0x02, 0x00, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xf7, 0x57, 0xdf, 0xd5, 0x40, 0x00, 0x17, 0x00, 0x20, 0x05, 0x00, 0x02, 0x00, 0x05, 0x15, 0x00,
-  0x2a, 0xab, 0xea, 0xaa, 0xfb, 0xfa, 0x80, 0x00, 0x0b, 0x00, 0x20, 0x02, 0x80, 0x02, 0x00, 0x2b, 0x11, 0x00,
-  0x01, 0x7f, 0xf5, 0xd5, 0x5f, 0x7f, 0x40, 0x00, 0x17, 0x80, 0x30, 0x05, 0x80, 0x02, 0x00, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xfa, 0xfa, 0xaf, 0xef, 0x80, 0x00, 0x0b, 0x80, 0x70, 0x02, 0x80, 0x01, 0x00, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xff, 0x5f, 0x55, 0xfd, 0x80, 0x00, 0x05, 0x80, 0x70, 0x01, 0x40, 0x01, 0x40, 0x05, 0x05, 0x00,
-  0x2a, 0xab, 0xeb, 0xab, 0xaa, 0xbe, 0xc0, 0x00, 0x03, 0xc0, 0xf0, 0x02, 0xc0, 0x01, 0x80, 0x2b, 0x1b, 0x00,
-  0x01, 0x7f, 0xfd, 0x55, 0x75, 0x57, 0x40, 0x00, 0x05, 0xf3, 0xf8, 0x01, 0x40, 0x01, 0x80, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xff, 0xaa, 0xae, 0xab, 0xe4, 0x00, 0x02, 0xff, 0xfe, 0x03, 0xe0, 0x01, 0x40, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xff, 0xf5, 0x55, 0xd5, 0xfa, 0x00, 0x3f, 0xc0, 0x7f, 0xdd, 0x60, 0x01, 0x00, 0x05, 0x15, 0x00,
-  0x2a, 0xab, 0xef, 0xff, 0xaa, 0xba, 0xf2, 0x1f, 0xc0, 0x00, 0x00, 0xf0, 0xb0, 0x00, 0x80, 0x2b, 0x1b, 0x00,
-  0x01, 0x7f, 0xf5, 0xff, 0xf5, 0x5d, 0x61, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xea, 0xaf, 0xff, 0xab, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x80, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xff, 0xd7, 0xff, 0xf5, 0x10, 0x00, 0x00, 0x00, 0x01, 0x55, 0x58, 0x00, 0x80, 0x05, 0x15, 0x00,
-  0x2a, 0xab, 0xea, 0xff, 0xfa, 0xbe, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xeb, 0xf8, 0x00, 0x80, 0x2b, 0x11, 0x00,
-  0x01, 0x7f, 0xf5, 0x55, 0xff, 0x54, 0x00, 0x15, 0x55, 0x55, 0x57, 0xfe, 0x58, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xeb, 0xfb, 0xfe, 0xea, 0x00, 0xfa, 0xaa, 0xaa, 0xff, 0xf0, 0xa8, 0x00, 0x80, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xf5, 0x57, 0xff, 0xd7, 0x40, 0x57, 0xff, 0x57, 0xff, 0xc0, 0x58, 0x00, 0x80, 0x05, 0x05, 0x00,
-  0x2a, 0xab, 0xea, 0xaa, 0xff, 0xab, 0xa0, 0x6a, 0xab, 0xf8, 0xff, 0x80, 0xa8, 0x00, 0x80, 0x2b, 0x1f, 0x00,
-  0x01, 0x7f, 0xf5, 0xff, 0xff, 0x77, 0xd4, 0x35, 0x55, 0x78, 0x3f, 0x00, 0x58, 0x00, 0xc0, 0x01, 0x00, 0x00,
-  0x2a, 0xae, 0xea, 0xaa, 0xff, 0xef, 0xfa, 0xea, 0xaa, 0xf0, 0x1f, 0x00, 0xa8, 0x00, 0x40, 0x8b, 0x1f, 0x00,
-  0x05, 0xdf, 0xf5, 0x55, 0x7f, 0x5f, 0xfd, 0xd5, 0x05, 0x70, 0x0e, 0x00, 0x58, 0x00, 0x40, 0x05, 0x03, 0x00,
-  0x2a, 0xab, 0xea, 0xba, 0xfa, 0xfe, 0xfe, 0x20, 0x02, 0xe0, 0x0e, 0x00, 0x2c, 0x00, 0x40, 0x2a, 0x9f, 0x00,
-  0x01, 0x7f, 0xf7, 0xd7, 0xfd, 0xfd, 0xfc, 0x00, 0x05, 0xe0, 0x0e, 0x00, 0x54, 0x00, 0x40, 0x01, 0x80, 0x00,
-  0x2a, 0xae, 0xfa, 0xfe, 0xfb, 0xfb, 0xac, 0x00, 0x02, 0xc0, 0x06, 0x00, 0x2c, 0x00, 0x40, 0x8a, 0xc0, 0x00,
-  0x05, 0xdf, 0xf7, 0x55, 0xff, 0xd5, 0x7c, 0x00, 0x05, 0xc0, 0x04, 0x00, 0x54, 0x00, 0x40, 0x04, 0x70, 0x00,
-  0x2a, 0xab, 0xea, 0xab, 0xff, 0xba, 0xf8, 0x00, 0x02, 0xc0, 0x04, 0x00, 0x2c, 0x02, 0xc0, 0x2a, 0xaf, 0x40,
-  0x01, 0x7f, 0xf5, 0x7d, 0xfd, 0x75, 0xd4, 0x00, 0x05, 0x80, 0x04, 0x00, 0x54, 0x55, 0x40, 0x01, 0x57, 0xe0,
-  0x2a, 0xae, 0xeb, 0xef, 0xfb, 0xab, 0xb8, 0x00, 0x0a, 0x80, 0x04, 0x00, 0x2e, 0xaa, 0xc0, 0x8a, 0xaa, 0xa0,
-  0x05, 0xdf, 0xfd, 0x7f, 0xdd, 0x5f, 0xf4, 0x00, 0x05, 0x80, 0x74, 0x00, 0x55, 0x55, 0xc0, 0x04, 0x5d, 0xe0,
-  0x2a, 0xab, 0xeb, 0xff, 0xba, 0xbe, 0xea, 0x00, 0x0b, 0x80, 0xfc, 0x00, 0x2e, 0xaa, 0x80, 0x2a, 0xaa, 0xa0,
-  0x01, 0x7f, 0xf7, 0xfd, 0x55, 0xfd, 0xf4, 0x00, 0x05, 0x00, 0xfc, 0x00, 0x55, 0x55, 0xc0, 0x01, 0x57, 0xe0,
-  0x2a, 0xae, 0xff, 0xea, 0xab, 0xef, 0xfa, 0x00, 0x0b, 0x00, 0xfc, 0x00, 0xae, 0xaa, 0x80, 0x8a, 0xaa, 0xa0,
-  0x05, 0xdf, 0xff, 0xd7, 0x5f, 0x5f, 0x54, 0x00, 0x05, 0x00, 0x74, 0x00, 0x55, 0x55, 0x40, 0x04, 0x5d, 0xe0,
-  0x2a, 0xab, 0xfe, 0xba, 0xfe, 0xfa, 0xfa, 0x00, 0x0b, 0x00, 0x04, 0x00, 0xae, 0xab, 0x80, 0x2a, 0xaa, 0xa0,
-  0x01, 0x7f, 0xf5, 0x77, 0xf7, 0xf7, 0xdc, 0x00, 0x05, 0x80, 0x04, 0x00, 0x55, 0x55, 0x40, 0x01, 0x57, 0xe0,
-  0x2a, 0xae, 0xeb, 0xaf, 0xaf, 0xaa, 0xba, 0x00, 0x02, 0x80, 0x04, 0x00, 0xaa, 0xab, 0xc0, 0x8a, 0xaa, 0xa0,
-  0x05, 0xdf, 0xf7, 0x7f, 0x7d, 0x55, 0xdd, 0x00, 0x05, 0x80, 0x04, 0x00, 0x5d, 0x57, 0x40, 0x04, 0x5d, 0xe0,
-  0x2a, 0xab, 0xfa, 0xfb, 0xfa, 0xae, 0xbe, 0x80, 0x02, 0x80, 0x04, 0x00, 0xba, 0xaa, 0x80, 0x2a, 0xaa, 0xa0,
-  0x01, 0x7f, 0xf7, 0xf7, 0xd7, 0x75, 0xf5, 0x00, 0x01, 0x80, 0x04, 0x01, 0x7d, 0x57, 0x40, 0x01, 0x57, 0xe0,
-  0x2a, 0xae, 0xef, 0xbf, 0xbe, 0xae, 0xbe, 0x80, 0x02, 0xc0, 0x04, 0x00, 0xfa, 0xaa, 0xc0, 0x8a, 0xaa, 0xa0,
-  0x05, 0xdf, 0xfd, 0xff, 0xfd, 0x55, 0xf7, 0x40, 0x01, 0x40, 0x04, 0x03, 0xfd, 0x57, 0xc0, 0x04, 0x5d, 0xe0,
-  0x2a, 0xab, 0xfb, 0xff, 0xfa, 0xaf, 0xae, 0xa0, 0x00, 0xa0, 0x04, 0x07, 0xfa, 0xab, 0x80, 0x2a, 0xaa, 0xa0,
-  0x81, 0x7f, 0xff, 0xff, 0xd5, 0x7d, 0x7d, 0x40, 0x00, 0x5c, 0x0c, 0x1f, 0xf5, 0x57, 0x40, 0x01, 0x57, 0xd0,
-  0xaa, 0xae, 0xfe, 0xff, 0xab, 0xeb, 0xaf, 0xa0, 0x00, 0x2b, 0xfc, 0x3e, 0xfa, 0xae, 0x80, 0x8a, 0xaa, 0x90,
-  0xc5, 0xdf, 0xfd, 0xfd, 0x5f, 0xdd, 0x7d, 0xd0, 0x00, 0x55, 0xfe, 0xfd, 0xf5, 0x55, 0x40, 0x04, 0x5d, 0xb0,
-  0xe2, 0xab, 0xef, 0xfa, 0xfe, 0xab, 0xeb, 0xea, 0x00, 0x2b, 0xff, 0xff, 0xea, 0xaa, 0xc0, 0x2a, 0xaa, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam20 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam20_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM21
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM21
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM21 uint8_t hammerbeam21_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x00, 0x00, 0x80, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfe, 0x70,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0x7e, 0xff, 0xb0,
-  0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xd0,
-  0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf7, 0xff, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xf7, 0x7e, 0xe0, 0xd0,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xbe, 0xfb, 0xe0,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xfe, 0xe0, 0xe0,
-  0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xbe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xd5, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0xfe, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xfb, 0xbe, 0xfa, 0xe0,
-  0x10, 0x10, 0x10, 0x00, 0x00, 0x01, 0xd7, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0xa8, 0x00, 0xa8, 0x01, 0xfe, 0xff, 0xff, 0xbe, 0xee, 0xff, 0xef, 0xfe, 0xff, 0xfe, 0xff, 0xe0,
-  0x11, 0x10, 0x04, 0x00, 0x40, 0x01, 0xd7, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xdc, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0xfe, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff, 0xff, 0xbf, 0xfe, 0xfc, 0xe0,
-  0x11, 0x10, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xdc, 0xe0, 0xe0,
-  0x22, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xe0,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xdf, 0x77, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x22, 0x20, 0x00, 0x20, 0x00, 0x0e, 0x0f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xe0,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x03, 0x7f, 0xff, 0x7f, 0x77, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xe0, 0xe0,
-  0x00, 0x20, 0x00, 0x00, 0x00, 0x30, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x01, 0x7f, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xe0, 0xe0,
-  0x20, 0x20, 0x20, 0x00, 0x00, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x10, 0x00, 0x00, 0x14, 0x01, 0x40, 0x00, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xf6, 0xee, 0xe0,
-  0x00, 0x20, 0x20, 0x28, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe0, 0xe0,
-  0x00, 0x22, 0x20, 0x20, 0x00, 0x00, 0x00, 0xf0, 0x07, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xef, 0xee, 0xfa, 0xe0,
-  0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x40, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x01, 0xc0, 0x01, 0xb8, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe0,
-  0x00, 0x00, 0x40, 0x00, 0x00, 0x14, 0x03, 0x80, 0x00, 0xd0, 0x1f, 0xff, 0xf9, 0xff, 0xfd, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x0c, 0x00, 0x20, 0xe0, 0x0b, 0xff, 0xfc, 0x1f, 0xfb, 0xfe, 0xea, 0xe0,
-  0x00, 0x44, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0f, 0xf1, 0xfe, 0x03, 0xff, 0xde, 0xe4, 0xe0,
-  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe0, 0xfa, 0x80, 0x3b, 0xfe, 0xff, 0xe0,
-  0x01, 0x44, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x0c, 0x00, 0xff, 0xc0, 0x03, 0xde, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0xbe, 0xea, 0xe0,
-  0x00, 0x41, 0x51, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x80, 0x07, 0xfe, 0xee, 0xe0,
-  0x02, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x28, 0x00, 0x7e, 0xe0, 0x1f, 0xae, 0xff, 0xe0,
-  0x04, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x70, 0x05, 0xff, 0xc0, 0xf7, 0xfe, 0xe0, 0xe0,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x07, 0xff, 0x87, 0xef, 0xae, 0xfa, 0xe0,
-  0x10, 0x10, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xf4, 0x47, 0xfe, 0x1f, 0xff, 0x7e, 0xe0, 0xe0,
-  0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x2b, 0xc7, 0xfa, 0x8f, 0xfc, 0xff, 0xef, 0xfe, 0xff, 0xe0,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x1f, 0xff, 0xfc, 0x1f, 0xff, 0x7f, 0xff, 0x76, 0xe0, 0xe0,
-  0x02, 0x20, 0x00, 0x08, 0x00, 0x00, 0x08, 0xa9, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdf, 0xf7, 0x60, 0xe0,
-  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0xe0,
-  0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x40, 0x03, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbf, 0xe0,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x80, 0x03, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xbe, 0xff, 0x8f, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x07, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xf0, 0xa0,
-  0x00, 0x02, 0x08, 0x00, 0x00, 0x08, 0x00, 0x8f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xfb, 0xfe, 0xe0,
-  0x00, 0x01, 0x50, 0x00, 0x00, 0x04, 0x01, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xdf, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x3f, 0xfe, 0xff, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xbb, 0xfe, 0xe0,
-  0x00, 0x00, 0x00, 0x10, 0x40, 0x13, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7d, 0xff, 0xdf, 0xe0,
-  0x00, 0x00, 0x00, 0x0a, 0x80, 0x03, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfb, 0xbb, 0xfe, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfd, 0x57, 0xff, 0xff, 0xd5, 0x7f, 0x7f, 0xff, 0xdf, 0xe0,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xff, 0xeb, 0xfa, 0xff, 0xfe, 0xff, 0xee, 0xfb, 0xbb, 0xfe, 0xe0,
-  0x00, 0x00, 0x04, 0x00, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xfd, 0xff, 0x7f, 0xff, 0xe0,
-  0x00, 0x02, 0x00, 0x00, 0x2a, 0x03, 0xbe, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe0,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x7d, 0xff, 0x60,
-  0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xef, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0x60,
-  0x00, 0x08, 0x80, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xef, 0xe0,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x3f, 0xdf, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0x60,
-  0x00, 0x20, 0x00, 0x28, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xef, 0xe0,
-  0x00, 0x41, 0x00, 0x05, 0x7f, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0x60,
-  0x82, 0x00, 0x00, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xd0,
-  0x94, 0x00, 0x00, 0x44, 0x3f, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x50,
-  0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xb0,
-  0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam21 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam21_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM22
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM22
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM22 uint8_t hammerbeam22_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x00, 0x00, 0x01, 0xfa, 0xfe, 0xaa, 0xaa, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xc0, 0x00, 0x00, 0x03, 0xf5, 0xf5, 0x55, 0x55, 0x45, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xb0,
-  0x80, 0x00, 0x00, 0x03, 0xeb, 0xaa, 0xaa, 0xaa, 0xa2, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xd0,
-  0x80, 0x00, 0x00, 0x07, 0xd5, 0x55, 0x55, 0x55, 0x51, 0x7f, 0xff, 0xff, 0x43, 0xff, 0xff, 0xfe, 0xe0, 0xd0,
-  0x00, 0x00, 0x00, 0x0f, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xff, 0xff, 0xfe, 0x81, 0xff, 0xff, 0xfe, 0xfb, 0xe0,
-  0x00, 0x00, 0x00, 0x1f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7f, 0xff, 0xfd, 0x00, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x2e, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xea, 0x80, 0x7f, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x5d, 0x75, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xd5, 0x40, 0x1f, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x3e, 0xea, 0xaa, 0xaa, 0xaa, 0xab, 0xff, 0xff, 0xaa, 0x80, 0x2f, 0xff, 0xfe, 0xfa, 0xe0,
-  0x00, 0x00, 0x00, 0x7d, 0xd5, 0x55, 0x55, 0x55, 0x7f, 0xff, 0xff, 0xf5, 0x40, 0x17, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0xbf, 0xaa, 0xaa, 0xaa, 0xaf, 0xff, 0xff, 0xf8, 0x0a, 0xa0, 0x2a, 0xbf, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x01, 0x7f, 0x55, 0x55, 0x55, 0x7f, 0xff, 0xff, 0xe7, 0xff, 0x50, 0x15, 0x57, 0xfe, 0xe0, 0xe0,
-  0x00, 0x08, 0x02, 0xfe, 0xaa, 0xaa, 0xaf, 0xff, 0xff, 0xfe, 0xce, 0xa1, 0x20, 0x2a, 0xa7, 0xfe, 0xfc, 0xe0,
-  0x00, 0x10, 0x01, 0xfd, 0x55, 0x55, 0x5f, 0xff, 0xff, 0xdd, 0x7d, 0x50, 0x10, 0x15, 0x47, 0xfe, 0xe0, 0xe0,
-  0x00, 0x28, 0x02, 0xfe, 0xaa, 0xaa, 0xbf, 0x7f, 0xfe, 0xaa, 0xc2, 0xaa, 0x08, 0x0a, 0x83, 0xfe, 0xff, 0xe0,
-  0x40, 0x14, 0x05, 0xfd, 0xd5, 0x55, 0xf0, 0xff, 0xfd, 0x57, 0x01, 0xd5, 0x04, 0x15, 0x41, 0xfe, 0xe0, 0xe0,
-  0x60, 0xa8, 0x0b, 0xfb, 0xaa, 0xab, 0xe0, 0xff, 0xfb, 0xec, 0x00, 0x2e, 0xa2, 0x0a, 0xa0, 0xfe, 0xfc, 0xe0,
-  0x55, 0x54, 0x57, 0xff, 0x55, 0x57, 0xc1, 0xff, 0xd7, 0xd0, 0x00, 0x01, 0x55, 0x05, 0x41, 0xfe, 0xe0, 0xe0,
-  0x2a, 0xb8, 0xab, 0xfe, 0xaa, 0xaf, 0x03, 0xff, 0xad, 0xe0, 0x38, 0x00, 0xaa, 0x82, 0xa0, 0xfe, 0xff, 0xe0,
-  0x75, 0xfd, 0x57, 0xfd, 0x55, 0x5f, 0x07, 0xff, 0x51, 0x80, 0x60, 0x00, 0x75, 0x51, 0x50, 0x7e, 0xe0, 0xe0,
-  0x3a, 0xfe, 0xaf, 0xfe, 0xaa, 0xba, 0x07, 0xfe, 0xa3, 0x01, 0x80, 0x00, 0x0a, 0xa8, 0xa0, 0x3e, 0xea, 0xe0,
-  0x15, 0xf5, 0x57, 0xfd, 0x55, 0xf4, 0x07, 0xfd, 0xc6, 0x01, 0x00, 0x00, 0x01, 0x74, 0x50, 0x7e, 0xee, 0xe0,
-  0x2a, 0xfb, 0xaf, 0xfa, 0xab, 0xe8, 0x0f, 0xfb, 0x88, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x28, 0x3e, 0xff, 0xe0,
-  0x15, 0xf5, 0xdf, 0xf5, 0x57, 0xd0, 0x1f, 0xff, 0x30, 0x00, 0x00, 0x01, 0x00, 0x45, 0x04, 0x1e, 0xe0, 0xe0,
-  0x0f, 0xea, 0xef, 0xea, 0xae, 0x88, 0xbf, 0xfe, 0x60, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x1e, 0xfa, 0xe0,
-  0x07, 0xd1, 0xdf, 0xfd, 0x7c, 0x01, 0x77, 0xfe, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x47, 0x00, 0x1e, 0xe4, 0xe0,
-  0x0f, 0xa8, 0xff, 0xfb, 0xf8, 0x0a, 0xef, 0xfe, 0x80, 0x10, 0x00, 0x4a, 0x80, 0x22, 0x80, 0x0e, 0xff, 0xe0,
-  0x07, 0x51, 0xff, 0xff, 0xd4, 0x15, 0xff, 0xff, 0x00, 0x20, 0x00, 0x1d, 0xc0, 0x17, 0x41, 0x0e, 0xe0, 0xe0,
-  0x0f, 0xa0, 0xff, 0xff, 0xa8, 0x2b, 0xef, 0xfe, 0x00, 0x60, 0x00, 0x3a, 0x80, 0x0a, 0xa0, 0x8e, 0xea, 0xe0,
-  0x57, 0x51, 0xff, 0xff, 0x10, 0x17, 0xdf, 0xff, 0x00, 0xe0, 0x00, 0xbd, 0xc0, 0x07, 0x40, 0x06, 0xe4, 0xe0,
-  0x0e, 0xa0, 0xff, 0xfe, 0x28, 0x2f, 0xef, 0xff, 0x01, 0xe0, 0x00, 0xaf, 0x80, 0x0a, 0xa0, 0x0e, 0xff, 0xe0,
-  0x5f, 0x51, 0xff, 0xfc, 0x50, 0x5d, 0x5f, 0xfd, 0x05, 0x40, 0x80, 0x25, 0x80, 0x04, 0x50, 0x06, 0xe0, 0xe0,
-  0x0e, 0xaa, 0xef, 0xf8, 0xa0, 0xff, 0xef, 0xfe, 0x82, 0xc1, 0x00, 0x1b, 0x80, 0x02, 0x20, 0x06, 0xea, 0xe0,
-  0x5d, 0x51, 0xd7, 0xf5, 0x41, 0x9f, 0x7f, 0xff, 0x07, 0xd1, 0x00, 0x05, 0x00, 0x01, 0x10, 0x06, 0xee, 0xe0,
-  0x2e, 0xab, 0xee, 0xea, 0xa3, 0x0f, 0xaf, 0xfe, 0x8a, 0xc9, 0x00, 0x03, 0x00, 0x02, 0x88, 0x0a, 0xff, 0xe0,
-  0x5d, 0x51, 0xdd, 0xff, 0xd7, 0x07, 0xf7, 0xff, 0x57, 0x94, 0x00, 0x02, 0x00, 0x00, 0x44, 0x16, 0xe0, 0xe0,
-  0x2a, 0xab, 0xea, 0xff, 0xfa, 0x83, 0xef, 0xff, 0xab, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0a, 0xfa, 0xe0,
-  0x55, 0x55, 0xd5, 0xdf, 0xfd, 0x41, 0xf7, 0xff, 0x55, 0x04, 0x00, 0x00, 0x00, 0x15, 0x40, 0x12, 0xe0, 0xe0,
-  0x6a, 0xab, 0xab, 0xaf, 0xff, 0xa8, 0xff, 0xff, 0xaa, 0x82, 0x00, 0x00, 0x00, 0x2a, 0x80, 0x06, 0xff, 0xe0,
-  0x75, 0x55, 0x57, 0xd7, 0xff, 0xd4, 0x7d, 0xff, 0xf5, 0x55, 0xff, 0xe0, 0x00, 0x54, 0x00, 0x06, 0xe0, 0xe0,
-  0x7a, 0xaa, 0xaf, 0xeb, 0xff, 0xfa, 0xff, 0xff, 0xda, 0x8a, 0xaa, 0xb0, 0x00, 0x68, 0x02, 0x0e, 0xfc, 0xe0,
-  0x7d, 0x55, 0x5f, 0xfd, 0xff, 0xff, 0x5d, 0xff, 0xed, 0x41, 0x02, 0x70, 0x00, 0xd0, 0x04, 0x1f, 0x60, 0xe0,
-  0x3e, 0xaa, 0xbf, 0xfe, 0xff, 0xfa, 0xaf, 0xff, 0xfe, 0xa0, 0x04, 0xea, 0x00, 0xa0, 0x08, 0x3f, 0x7f, 0xe0,
-  0x5f, 0x55, 0x7f, 0xff, 0x7f, 0xf5, 0x1f, 0xfc, 0x17, 0x50, 0x01, 0xf6, 0x01, 0x00, 0x00, 0x1f, 0xbf, 0xe0,
-  0x3e, 0xaa, 0xff, 0xfa, 0xbf, 0xe8, 0x0f, 0xf8, 0x02, 0xac, 0x03, 0x7a, 0x0b, 0x00, 0x00, 0x3f, 0xcf, 0xe0,
-  0x1f, 0x55, 0x7f, 0xf5, 0x5f, 0xf5, 0x07, 0xd4, 0x01, 0x57, 0x01, 0x34, 0x1e, 0x00, 0x00, 0x7f, 0xf0, 0xa0,
-  0x0f, 0xab, 0xef, 0xaa, 0xbb, 0xea, 0x8b, 0xa2, 0x00, 0xfa, 0x00, 0xec, 0x08, 0x00, 0x00, 0xff, 0xff, 0xe0,
-  0x07, 0xd7, 0x57, 0xd7, 0xdd, 0xd5, 0x55, 0xc0, 0x07, 0x0d, 0x14, 0x5c, 0x10, 0x40, 0x01, 0xff, 0xff, 0xe0,
-  0x07, 0xfa, 0xab, 0xae, 0xaa, 0xea, 0xaa, 0xe0, 0x04, 0x03, 0xae, 0x3a, 0xb8, 0x80, 0x02, 0xff, 0xff, 0xe0,
-  0x03, 0xd4, 0x17, 0xdd, 0x5d, 0xd5, 0x55, 0x70, 0x18, 0x91, 0xf3, 0xd5, 0x55, 0x00, 0x15, 0x7f, 0xff, 0xe0,
-  0x00, 0x00, 0x0f, 0xea, 0x2e, 0xea, 0xaa, 0xb0, 0x0f, 0xf8, 0xf8, 0xfe, 0xba, 0x00, 0xba, 0xff, 0xff, 0xe0,
-  0x50, 0x00, 0x07, 0xd5, 0x17, 0x75, 0x55, 0x50, 0x05, 0x70, 0x5c, 0x57, 0xf4, 0x01, 0x75, 0xff, 0xff, 0xe0,
-  0x2a, 0x00, 0x0f, 0xee, 0x0b, 0xaa, 0xaa, 0xb8, 0x01, 0xe0, 0xaf, 0x0a, 0xa8, 0x02, 0xeb, 0xff, 0xff, 0xe0,
-  0x55, 0x41, 0x57, 0xd4, 0x07, 0x75, 0x55, 0xf8, 0x00, 0x81, 0x55, 0xc1, 0x50, 0x07, 0x57, 0xff, 0xff, 0xe0,
-  0x7a, 0xaa, 0x8f, 0xee, 0x03, 0xba, 0xab, 0xf8, 0x00, 0x02, 0xaa, 0xa8, 0x00, 0x2e, 0xbf, 0xff, 0xff, 0xe0,
-  0x7f, 0x55, 0x15, 0x3c, 0x07, 0xd5, 0x5f, 0xfc, 0x00, 0x07, 0x55, 0x55, 0x00, 0x55, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xea, 0x2e, 0x06, 0x0e, 0xea, 0xbf, 0xff, 0x80, 0x0f, 0xfe, 0xaa, 0xc2, 0xaf, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xd0, 0x18, 0x00, 0x14, 0xf5, 0xff, 0xff, 0xf4, 0x5d, 0x7f, 0x55, 0x75, 0xdf, 0xff, 0xff, 0xff, 0xe0,
-  0x7f, 0xa0, 0x30, 0x02, 0x18, 0x7b, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x7d, 0x40, 0x60, 0x03, 0x14, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x7a, 0x80, 0xc0, 0x40, 0x18, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x75, 0x60, 0x40, 0x41, 0x14, 0x3f, 0x5f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0xaa, 0xc0, 0x00, 0xc0, 0x0e, 0x1f, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-  0x95, 0x80, 0x01, 0x40, 0x03, 0x1f, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-  0xcb, 0x00, 0x02, 0xc0, 0x00, 0xee, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-  0xe7, 0x00, 0x01, 0x40, 0x00, 0x77, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam22 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam22_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM23
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM23
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM23 uint8_t hammerbeam23_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x14, 0x51, 0x1d, 0x37, 0x7d, 0xdf, 0xd7, 0x7d, 0x74, 0xd5, 0xd5, 0x7f, 0xff, 0xef, 0xff, 0xfe, 0x70,
-  0xc0, 0x2a, 0x22, 0x9f, 0x2e, 0xfe, 0xeb, 0xbb, 0xfe, 0xaa, 0xbf, 0xff, 0xaa, 0xff, 0xd7, 0xfe, 0xff, 0xb0,
-  0x80, 0x55, 0x51, 0x1d, 0xf7, 0x7f, 0xfd, 0x7d, 0xff, 0xf7, 0xdf, 0xdf, 0xdf, 0xff, 0xef, 0xff, 0xff, 0xd0,
-  0x80, 0xaa, 0xa2, 0xbe, 0x0e, 0xbf, 0xfe, 0xbf, 0xff, 0xfa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xd0,
-  0x01, 0x55, 0x45, 0x3e, 0x1c, 0x7f, 0xef, 0x5f, 0xff, 0xfd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xe0,
-  0x00, 0xaa, 0xaa, 0xbe, 0x68, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x11, 0x55, 0x55, 0x28, 0x03, 0xfe, 0xef, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x02, 0xaa, 0xaa, 0x07, 0xb8, 0xb1, 0xfe, 0x7c, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x01, 0x55, 0x54, 0x7c, 0xfd, 0x3b, 0xfc, 0x58, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x02, 0xaa, 0xaa, 0x78, 0xe6, 0x8f, 0xf9, 0xf0, 0x0b, 0xff, 0xff, 0xff, 0x67, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x05, 0x15, 0x54, 0xf5, 0x45, 0xa6, 0xdf, 0x07, 0xe1, 0xdf, 0xff, 0xff, 0x77, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x02, 0x2a, 0xa8, 0xea, 0xea, 0x70, 0x00, 0x5e, 0x3c, 0x07, 0x7f, 0xff, 0x77, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x05, 0x15, 0x55, 0xd7, 0x37, 0x38, 0x7b, 0xff, 0x1f, 0xf0, 0x01, 0xff, 0x8f, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x0a, 0x0a, 0xa9, 0xfe, 0x1b, 0xbe, 0x1f, 0xff, 0xef, 0x7f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x04, 0x15, 0x53, 0xe0, 0x15, 0x5f, 0x0f, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x08, 0x2a, 0xa3, 0x82, 0x1a, 0x9f, 0xef, 0xff, 0xc7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x55, 0x43, 0xc1, 0x0d, 0xbf, 0xf7, 0xf7, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xe0,
-  0x00, 0x2a, 0xa7, 0x00, 0x0a, 0x9d, 0xff, 0xcf, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x55, 0x47, 0x41, 0x0d, 0x4f, 0xff, 0x3f, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0xaa, 0x86, 0x20, 0x0a, 0xc7, 0xfe, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x01, 0x55, 0x46, 0x00, 0x05, 0x73, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x00, 0xa2, 0x8c, 0x20, 0x1e, 0xa1, 0xe7, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x01, 0x45, 0x4c, 0x01, 0xf5, 0x50, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x40, 0xa2, 0x9c, 0x0e, 0xaa, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x21, 0x45, 0x1c, 0x75, 0x57, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x22, 0x0a, 0x9f, 0xaa, 0xbf, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x20, 0x05, 0x3d, 0x55, 0xff, 0xf5, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x42, 0x0a, 0x7a, 0xaf, 0xff, 0xf2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x14, 0x7d, 0x7f, 0xff, 0x75, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x00, 0x0a, 0x7f, 0xff, 0xfa, 0xb0, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe4, 0xe0,
-  0x00, 0x14, 0xff, 0xff, 0xd7, 0x71, 0x7f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x02, 0x08, 0xff, 0xfe, 0xeb, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xfe, 0xe0, 0xe0,
-  0x05, 0x01, 0xff, 0xf5, 0x57, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x02, 0x09, 0xbf, 0xba, 0xeb, 0xf3, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xe0,
-  0x00, 0x01, 0x3f, 0x55, 0x57, 0xf5, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x00, 0x03, 0x3a, 0xba, 0xeb, 0xfa, 0x3f, 0xdf, 0xfe, 0xff, 0xec, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xe0, 0xe0,
-  0x00, 0x02, 0x3f, 0x55, 0x57, 0xf4, 0x3f, 0xff, 0xfd, 0x7f, 0xee, 0xbf, 0xff, 0xff, 0xff, 0xfe, 0xfa, 0xe0,
-  0x08, 0x02, 0x3a, 0xba, 0xeb, 0xf2, 0xb7, 0xff, 0xfe, 0xff, 0xef, 0xbf, 0xff, 0xfc, 0x7f, 0xfe, 0xe0, 0xe0,
-  0x10, 0x06, 0x3f, 0x55, 0x57, 0x75, 0x79, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xfb, 0xbf, 0xfe, 0xff, 0xe0,
-  0x28, 0x84, 0x3a, 0xba, 0xf8, 0x72, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf6, 0x5f, 0xfe, 0xe0, 0xe0,
-  0x51, 0x04, 0x1f, 0x55, 0xc3, 0x61, 0x7f, 0xbf, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xfe, 0xfc, 0xe0,
-  0x22, 0x08, 0x1e, 0xba, 0x97, 0x6a, 0xff, 0xff, 0xef, 0xbf, 0xff, 0xfe, 0xff, 0xf7, 0xdf, 0xff, 0x60, 0xe0,
-  0x55, 0x00, 0x1f, 0x55, 0xb8, 0xed, 0xff, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0x7f, 0xe0,
-  0x2a, 0x00, 0x1e, 0xba, 0xa3, 0xeb, 0xff, 0xbf, 0xaa, 0xff, 0xbf, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xbf, 0xe0,
-  0x54, 0x00, 0x0f, 0x55, 0x8f, 0xe5, 0xf7, 0xdd, 0xf5, 0x77, 0x7f, 0x7f, 0xff, 0xff, 0xff, 0x7e, 0xcf, 0xe0,
-  0x2a, 0x21, 0xce, 0xba, 0xbf, 0xe7, 0xef, 0xbb, 0xff, 0xaa, 0xfa, 0xaa, 0xaf, 0xff, 0xff, 0xfd, 0x70, 0xa0,
-  0x54, 0x02, 0x6f, 0x55, 0xd7, 0xf7, 0x77, 0xd5, 0xff, 0xdd, 0x55, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x28, 0x02, 0x26, 0xaa, 0xaf, 0xe2, 0xaf, 0xbe, 0xff, 0xef, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x51, 0x02, 0x27, 0x55, 0xd7, 0xf1, 0x75, 0x7f, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x2a, 0x81, 0xc3, 0xa8, 0xaf, 0xe1, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x55, 0x04, 0x03, 0xd0, 0x57, 0xf5, 0xf9, 0xf3, 0xff, 0xff, 0xff, 0xf5, 0xf5, 0xdf, 0xdf, 0xdd, 0xff, 0xe0,
-  0x2a, 0x08, 0x03, 0xa2, 0xad, 0xea, 0xf2, 0xc3, 0xfb, 0xff, 0xe1, 0xfb, 0xab, 0x8f, 0xea, 0xaa, 0xaf, 0xe0,
-  0x55, 0x14, 0x01, 0xc0, 0xd4, 0xfd, 0xf3, 0xe7, 0xf5, 0x5f, 0xc3, 0xf5, 0x5d, 0x4e, 0xf1, 0xf7, 0xff, 0xe0,
-  0x2a, 0x08, 0x01, 0x1a, 0x2c, 0xf8, 0xae, 0x2b, 0xea, 0xeb, 0x8f, 0xaa, 0xaf, 0x88, 0x62, 0xff, 0xff, 0xe0,
-  0x54, 0x14, 0x40, 0x75, 0xd8, 0xf1, 0x91, 0x87, 0x1f, 0x65, 0x06, 0x57, 0xd7, 0xf1, 0x0d, 0xff, 0xfe, 0xe0,
-  0x28, 0x28, 0x80, 0xfa, 0x61, 0xcb, 0x8a, 0xe2, 0xbf, 0xa4, 0x30, 0xaa, 0x3f, 0xcc, 0xa3, 0xff, 0xdd, 0xc0,
-  0x54, 0x51, 0x40, 0x7f, 0x33, 0xb4, 0x17, 0x40, 0x5f, 0x73, 0x54, 0x15, 0x7e, 0x9f, 0x58, 0xbb, 0xcd, 0x00,
-  0x28, 0xaa, 0x80, 0x7f, 0x79, 0xf0, 0xc3, 0xce, 0x06, 0xc7, 0x1b, 0xc1, 0xfe, 0x07, 0xbe, 0x73, 0xdc, 0x60,
-  0x50, 0x55, 0x40, 0x3f, 0xfe, 0x06, 0xe3, 0xdf, 0x00, 0x1f, 0x8f, 0xe8, 0xb4, 0x63, 0xfb, 0x33, 0xf1, 0x20,
-  0x28, 0xaa, 0x80, 0x1f, 0xfb, 0xbf, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xce, 0x19, 0xff, 0xf9, 0x97, 0xc7, 0x20,
-  0x51, 0x55, 0x10, 0x0f, 0x7d, 0xc7, 0xdf, 0xff, 0xe3, 0xe1, 0xff, 0xcf, 0x87, 0xff, 0xfb, 0xc2, 0x1f, 0xa0,
-  0x22, 0xaa, 0x20, 0x0e, 0xbf, 0xa3, 0xaf, 0xff, 0xe0, 0xeb, 0xff, 0xdf, 0xef, 0xf7, 0xff, 0xe8, 0xbf, 0xe0,
-  0x91, 0x55, 0x50, 0x87, 0x5f, 0xf7, 0xdf, 0xfd, 0xd5, 0x57, 0xff, 0xff, 0xff, 0xeb, 0xff, 0xff, 0x9f, 0xd0,
-  0xa2, 0xaa, 0xa1, 0x47, 0xaf, 0xfa, 0xbf, 0xbe, 0xae, 0xfa, 0xaa, 0xaf, 0xff, 0xf7, 0xff, 0xff, 0xcf, 0xd0,
-  0xd1, 0x55, 0x40, 0x87, 0xdf, 0xf7, 0x5f, 0x75, 0xff, 0x7f, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb0,
-  0xe2, 0xaa, 0x80, 0x03, 0xff, 0xfb, 0xea, 0xaa, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam23 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam23_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM24
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM24
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM24 uint8_t hammerbeam24_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe7, 0xb7, 0xe0, 0x0f, 0x00, 0x00, 0x04, 0x8f, 0xcb, 0x70, 0x0f, 0xa8, 0x37, 0xfe, 0xdc, 0x0f, 0xfe, 0x70,
-  0xdf, 0xb7, 0xf0, 0x1c, 0x00, 0x00, 0x34, 0x8f, 0xfb, 0x40, 0x1f, 0x56, 0x14, 0xfe, 0xdb, 0x7e, 0xff, 0xb0,
-  0xa0, 0x00, 0x09, 0x04, 0x81, 0x20, 0x04, 0xbf, 0x9b, 0x40, 0x38, 0xaf, 0x07, 0xfe, 0xdb, 0x7f, 0xff, 0xd0,
-  0x80, 0x60, 0x69, 0x74, 0xb1, 0x20, 0x64, 0xbf, 0xfb, 0x40, 0x09, 0x1f, 0x87, 0x9e, 0xdb, 0x4e, 0xe0, 0xd0,
-  0x00, 0x06, 0x09, 0x74, 0x81, 0x2c, 0x04, 0xbf, 0xfb, 0x43, 0x69, 0x7f, 0xc0, 0x90, 0xdb, 0x70, 0xfb, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x34, 0xbf, 0xfb, 0x40, 0x00, 0x1e, 0xe0, 0x96, 0xdf, 0xf2, 0xe0, 0xe0,
-  0x07, 0xff, 0xf6, 0xfb, 0x70, 0x00, 0x04, 0xbf, 0xfb, 0x7f, 0xf6, 0xfc, 0x70, 0x96, 0xd3, 0x06, 0xff, 0xe0,
-  0x43, 0xf3, 0x96, 0x8b, 0x7e, 0xdc, 0x64, 0xbf, 0xfb, 0x7f, 0x96, 0xfe, 0xf8, 0x00, 0xd4, 0x8e, 0xe0, 0xe0,
-  0x61, 0xff, 0xf6, 0x8b, 0x4e, 0xdc, 0x04, 0xbf, 0xff, 0xf9, 0xf6, 0x9f, 0xfc, 0x2e, 0xd4, 0x8e, 0xfa, 0xe0,
-  0x10, 0xfe, 0x76, 0xfb, 0x7e, 0xd0, 0x04, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0xd0, 0xbc, 0xe0, 0xe0,
-  0x18, 0x7f, 0xff, 0xfb, 0x7e, 0xd0, 0x00, 0x00, 0x00, 0x3e, 0xaf, 0xff, 0xf7, 0x0e, 0xd0, 0xb8, 0xff, 0xe0,
-  0x7c, 0x3f, 0x9c, 0xfc, 0x3e, 0xdf, 0xfb, 0x70, 0x00, 0x7d, 0x5f, 0xff, 0xff, 0x86, 0xdc, 0xb0, 0xe0, 0xe0,
-  0x00, 0x00, 0x90, 0xfe, 0x1e, 0xd3, 0xfb, 0x78, 0x00, 0xfa, 0xfe, 0x39, 0xff, 0xc3, 0xfc, 0x80, 0xfc, 0xe0,
-  0x00, 0x06, 0x91, 0xff, 0x0e, 0xdf, 0xcb, 0x7c, 0x01, 0xf5, 0xf0, 0x70, 0x7f, 0xe0, 0xc0, 0x00, 0xe0, 0xe0,
-  0x00, 0x00, 0x97, 0xff, 0x86, 0xdf, 0xfb, 0x7e, 0x03, 0x8f, 0xb2, 0x62, 0x0f, 0xf0, 0xf9, 0x10, 0xff, 0xe0,
-  0x00, 0x0c, 0x97, 0xcf, 0xc2, 0xdf, 0x9b, 0x40, 0x00, 0x91, 0x38, 0xc0, 0x03, 0xf8, 0x09, 0x60, 0xe0, 0xe0,
-  0x00, 0x00, 0x90, 0x48, 0xe0, 0xdf, 0xfb, 0x40, 0x66, 0x97, 0x9f, 0xcf, 0x89, 0xfc, 0x09, 0x70, 0xfc, 0xe0,
-  0x00, 0x00, 0x93, 0x48, 0xf0, 0xdf, 0xcb, 0x40, 0x00, 0x91, 0x87, 0x1f, 0xe0, 0xfe, 0x00, 0x00, 0xe0, 0xe0,
-  0x00, 0x00, 0x90, 0x4b, 0xf8, 0x5f, 0xfb, 0x40, 0x00, 0x00, 0xd0, 0x38, 0xf8, 0x7f, 0x06, 0xe0, 0xff, 0xe0,
-  0x00, 0x00, 0x96, 0x4b, 0xfc, 0x13, 0xfb, 0x7f, 0xff, 0x6e, 0x60, 0x70, 0x3e, 0x3f, 0x86, 0x80, 0xe0, 0xe0,
-  0x00, 0x00, 0x90, 0x48, 0xfe, 0x1f, 0xfb, 0x7f, 0x33, 0x69, 0x63, 0xe4, 0x1f, 0x1f, 0xc2, 0x80, 0xea, 0xe0,
-  0x00, 0x00, 0x90, 0x00, 0xff, 0x0f, 0xfb, 0x4f, 0xff, 0xfe, 0x3f, 0xce, 0x4f, 0x8f, 0xe0, 0xe0, 0xee, 0xe0,
-  0x00, 0x00, 0x97, 0xb7, 0xff, 0x87, 0xfb, 0x43, 0xeb, 0xfd, 0x1f, 0x1f, 0x07, 0xcf, 0xf0, 0xfe, 0xff, 0xe0,
-  0x00, 0x00, 0x94, 0xb7, 0xff, 0xc3, 0xfb, 0x77, 0xd7, 0x58, 0x00, 0x07, 0x8b, 0xe7, 0xf8, 0x7e, 0xe0, 0xe0,
-  0x00, 0x00, 0x97, 0xb4, 0x8f, 0xe1, 0xfb, 0x7f, 0xab, 0xb1, 0xf8, 0x03, 0x88, 0xf3, 0xdc, 0x3e, 0xfa, 0xe0,
-  0x30, 0x00, 0x91, 0xb4, 0x8f, 0xf0, 0x03, 0x1f, 0x57, 0x73, 0xfe, 0x01, 0x8c, 0x7b, 0xfe, 0x1e, 0xe4, 0xe0,
-  0x00, 0x00, 0x97, 0xb4, 0xbf, 0xf8, 0x00, 0x3e, 0xae, 0xef, 0x87, 0x11, 0xdd, 0x3d, 0xff, 0x0e, 0xff, 0xe0,
-  0x18, 0x00, 0x97, 0xb7, 0xbf, 0xfc, 0x00, 0x7d, 0x57, 0x7e, 0x01, 0x81, 0xdc, 0x3f, 0xff, 0x86, 0xe0, 0xe0,
-  0x00, 0x00, 0x97, 0xff, 0xbf, 0xfe, 0x00, 0xfa, 0xae, 0xec, 0x40, 0xc4, 0xdc, 0x1f, 0xff, 0xc2, 0xea, 0xe0,
-  0x00, 0x00, 0x90, 0x34, 0xbc, 0xff, 0x01, 0xf5, 0x5d, 0xdc, 0x00, 0x6e, 0xdc, 0x43, 0xfd, 0xe0, 0xe4, 0xe0,
-  0x00, 0x00, 0x90, 0x04, 0x84, 0x8f, 0x83, 0xea, 0xae, 0xf8, 0x84, 0x64, 0xdc, 0x69, 0xf8, 0xf0, 0xff, 0xe0,
-  0x00, 0x00, 0x90, 0x64, 0xb4, 0x8f, 0xc3, 0xd5, 0x5d, 0xdc, 0xce, 0x71, 0xdc, 0x61, 0xfd, 0xf8, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x04, 0x84, 0xbf, 0xe1, 0xaa, 0xaf, 0xba, 0x44, 0x61, 0x9c, 0x64, 0xff, 0xfc, 0xea, 0xe0,
-  0x7f, 0xff, 0x6f, 0x34, 0xa4, 0xb0, 0x09, 0x15, 0x5d, 0xfd, 0x60, 0xe3, 0x9c, 0xe6, 0xc0, 0x02, 0xee, 0xe0,
-  0x7f, 0xf9, 0x6e, 0x04, 0x84, 0x80, 0x69, 0x6b, 0xaf, 0xbe, 0xbf, 0xc3, 0x3c, 0xee, 0xc0, 0x46, 0xff, 0xe0,
-  0x7f, 0xff, 0x68, 0x04, 0x84, 0x80, 0x09, 0x15, 0x5d, 0xdd, 0x5f, 0x87, 0x38, 0xec, 0xc0, 0x0e, 0xe0, 0xe0,
-  0x7f, 0xf3, 0x68, 0x04, 0x84, 0x83, 0x09, 0x0a, 0xae, 0xfe, 0xee, 0x0e, 0x79, 0xcc, 0xc0, 0x1e, 0xfa, 0xe0,
-  0x7f, 0xff, 0x68, 0x04, 0x84, 0x80, 0x00, 0x05, 0x5f, 0xdf, 0x50, 0x9c, 0x71, 0x8d, 0xc8, 0x3c, 0xe0, 0xe0,
-  0x7f, 0xff, 0x68, 0x00, 0x04, 0xbf, 0xf6, 0xe2, 0xae, 0xef, 0xa8, 0x38, 0xe3, 0x99, 0x80, 0x78, 0xff, 0xe0,
-  0x7f, 0xff, 0x6f, 0xfb, 0x74, 0x8e, 0x76, 0xc1, 0x57, 0x77, 0xd6, 0x71, 0xc7, 0x19, 0x80, 0xf0, 0xe0, 0xe0,
-  0x7f, 0xff, 0x6f, 0x9b, 0x70, 0x0f, 0xf6, 0x80, 0xaf, 0xef, 0xeb, 0xe3, 0x8e, 0x3b, 0x81, 0xe6, 0xfc, 0xe0,
-  0x7f, 0xff, 0x6f, 0xfb, 0x7b, 0x7f, 0xcf, 0xf0, 0x57, 0xf7, 0xff, 0xc7, 0x1e, 0x9b, 0x03, 0xc0, 0x60, 0xe0,
-  0x7f, 0xff, 0x6f, 0xcb, 0x4b, 0x70, 0x4e, 0xf8, 0x2b, 0xfa, 0xff, 0x9f, 0x3c, 0xc3, 0x07, 0x8c, 0x7f, 0xe0,
-  0x7f, 0xff, 0x6e, 0x7b, 0x7b, 0x43, 0x48, 0xfc, 0x17, 0xfd, 0x5d, 0x7c, 0x79, 0xe7, 0x0f, 0x00, 0xbf, 0xe0,
-  0x7f, 0xff, 0x6a, 0x43, 0x5b, 0x40, 0x4b, 0x7e, 0x0b, 0xfe, 0xaa, 0xf8, 0xf0, 0x2e, 0x1e, 0x00, 0x0f, 0xe0,
-  0x7f, 0xff, 0x6a, 0x43, 0x7b, 0x46, 0x4b, 0x47, 0x05, 0xff, 0xff, 0xf7, 0xe7, 0x0c, 0x3f, 0xff, 0x60, 0xa0,
-  0x7f, 0xff, 0x6a, 0x5b, 0x4b, 0x40, 0x4a, 0x47, 0x82, 0xff, 0xff, 0xef, 0xad, 0x9c, 0x7f, 0xf9, 0x6f, 0xe0,
-  0x7f, 0xff, 0x6a, 0x5b, 0x4b, 0x43, 0x4a, 0x5f, 0xc1, 0x7f, 0xff, 0x5f, 0x7d, 0xf8, 0xf9, 0xff, 0x6f, 0xe0,
-  0x4f, 0xff, 0x6a, 0x5b, 0x7b, 0x70, 0x4a, 0x5f, 0xe0, 0xbf, 0xaa, 0xbe, 0xea, 0xf1, 0xe9, 0x13, 0x6f, 0xe0,
-  0x7f, 0xff, 0x6a, 0x43, 0x7f, 0xf6, 0x4a, 0x47, 0xf0, 0x5f, 0xf5, 0xfd, 0x7d, 0xe3, 0xc9, 0x1f, 0x6f, 0xe0,
-  0x67, 0xff, 0x68, 0x03, 0x43, 0x00, 0x48, 0x07, 0xf8, 0x2f, 0xff, 0xeb, 0xbb, 0xc7, 0x89, 0x7f, 0x68, 0x60,
-  0x7f, 0xff, 0x68, 0xbb, 0x40, 0x03, 0x49, 0xbf, 0xfc, 0x17, 0xff, 0x57, 0xd7, 0x8f, 0x69, 0x7f, 0x68, 0x60,
-  0x7f, 0xff, 0x6e, 0xbb, 0x40, 0x00, 0x49, 0xbf, 0xfe, 0x0b, 0xff, 0xfe, 0xfe, 0x1e, 0x09, 0x7f, 0x6e, 0x60,
-  0x7f, 0xff, 0x6f, 0xbb, 0x40, 0x06, 0x49, 0xb9, 0xff, 0x05, 0xff, 0xff, 0xfc, 0x3c, 0xc9, 0x7f, 0xfe, 0x20,
-  0x40, 0x48, 0xff, 0xbb, 0x40, 0x00, 0x48, 0xa9, 0x1f, 0x82, 0xbf, 0xff, 0xe0, 0x78, 0x09, 0x12, 0xff, 0xa0,
-  0x60, 0x00, 0xfd, 0xbb, 0x40, 0x00, 0x00, 0xa1, 0x1f, 0xc1, 0x57, 0xff, 0x00, 0xf0, 0x00, 0x12, 0xfc, 0xa0,
-  0x7f, 0xb7, 0xfd, 0x3b, 0x47, 0xff, 0xb7, 0xa1, 0x7f, 0xe0, 0xaa, 0x00, 0x09, 0xff, 0xf6, 0xf2, 0xe7, 0xa0,
-  0x78, 0x00, 0x01, 0x23, 0x43, 0xfc, 0xb7, 0xb9, 0x7f, 0xf0, 0x55, 0x00, 0x03, 0xff, 0x36, 0xf2, 0xff, 0xe0,
-  0x7c, 0x03, 0x0d, 0x2f, 0x61, 0xff, 0xb7, 0xf9, 0x7f, 0xf8, 0x2a, 0x80, 0x07, 0xff, 0xf6, 0x92, 0x07, 0x20,
-  0x7e, 0x00, 0x01, 0x2b, 0x70, 0xf9, 0xb5, 0x89, 0x00, 0x02, 0x45, 0x42, 0x0f, 0xfe, 0x76, 0x80, 0x0e, 0x20,
-  0x4f, 0x06, 0x19, 0x2a, 0x78, 0x7f, 0xb4, 0x09, 0x00, 0x1a, 0x5a, 0x87, 0x1f, 0xe7, 0xf6, 0x8d, 0xdf, 0xe0,
-  0x48, 0x80, 0x00, 0x02, 0x44, 0x3f, 0xb4, 0x09, 0x00, 0x02, 0x45, 0x42, 0x3c, 0x24, 0x76, 0x85, 0xff, 0xe0,
-  0x88, 0xc3, 0xfe, 0xde, 0x46, 0x1f, 0xb4, 0x00, 0x00, 0xc2, 0x42, 0xa0, 0x79, 0xa4, 0x76, 0x81, 0x7f, 0xd0,
-  0x8b, 0xe0, 0xfe, 0xd2, 0x5f, 0x0c, 0xb7, 0xf6, 0xe0, 0x00, 0x01, 0x50, 0xf0, 0x25, 0xf6, 0x81, 0xff, 0xd0,
-  0xc8, 0x04, 0x8e, 0xd2, 0x58, 0x04, 0x87, 0xf6, 0xff, 0xfd, 0xb8, 0xa9, 0xe3, 0x25, 0xf6, 0xf0, 0x00, 0x30,
-  0xe0, 0x34, 0x8e, 0xd2, 0x40, 0x34, 0x85, 0xf6, 0xff, 0xcd, 0xb0, 0x57, 0xc0, 0x25, 0xff, 0xf8, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam24 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam24_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM25
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM25
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM25 uint8_t hammerbeam25_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x54, 0x15, 0x41, 0x3f, 0xf5, 0xf7, 0xf5, 0x55, 0x15, 0x7f, 0xff, 0xf5, 0xd5, 0xff, 0xd5, 0xfe, 0x70,
-  0xca, 0xa8, 0x2a, 0xa0, 0x0f, 0xdf, 0xde, 0xaa, 0xaa, 0x2a, 0xef, 0xff, 0xfb, 0xab, 0xff, 0xaa, 0xff, 0xb0,
-  0x95, 0x54, 0x15, 0xc5, 0x20, 0x77, 0x75, 0x55, 0x50, 0x55, 0xdf, 0xff, 0xf7, 0xd7, 0xff, 0x57, 0xff, 0xd0,
-  0xaa, 0xaa, 0x2f, 0xa0, 0x0f, 0xdf, 0xea, 0xaa, 0x80, 0x2b, 0xaf, 0xff, 0xef, 0xbf, 0xbf, 0xae, 0xe0, 0xd0,
-  0x55, 0x54, 0x35, 0x45, 0x3f, 0xf5, 0x55, 0x50, 0x00, 0x55, 0x5f, 0xf7, 0xdf, 0x5f, 0x7f, 0x5c, 0xfb, 0xe0,
-  0x2a, 0xa0, 0x2a, 0xa0, 0x7c, 0x2a, 0xaa, 0x0a, 0x00, 0x8f, 0xff, 0xef, 0xfe, 0xbe, 0xbe, 0xbe, 0xe0, 0xe0,
-  0x50, 0x14, 0x11, 0x0f, 0xde, 0xfd, 0x55, 0x54, 0x01, 0x45, 0x57, 0xdf, 0xdf, 0x7d, 0x5d, 0x7c, 0xff, 0xe0,
-  0x2a, 0xa8, 0xab, 0xff, 0xfc, 0x07, 0xea, 0xa8, 0x02, 0x0a, 0xeb, 0xef, 0xbe, 0xfa, 0xbe, 0xbe, 0xe0, 0xe0,
-  0x55, 0x50, 0x13, 0xd5, 0xd7, 0x05, 0x55, 0x50, 0x04, 0x0f, 0x55, 0xdf, 0x7d, 0xf5, 0x5d, 0x7c, 0xfa, 0xe0,
-  0x2a, 0xaa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x08, 0x70, 0xaa, 0xbf, 0xfe, 0xe0, 0x3a, 0xfa, 0xe0, 0xe0,
-  0x55, 0x50, 0x7f, 0xfd, 0xd7, 0x5f, 0xd7, 0x7c, 0x10, 0x00, 0x55, 0x7f, 0x00, 0x15, 0x7d, 0xf4, 0xff, 0xe0,
-  0x28, 0xa8, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x02, 0xaa, 0x80, 0xfb, 0xee, 0xfb, 0xaa, 0xe0, 0xe0,
-  0x51, 0x40, 0x40, 0x3f, 0xfd, 0xd7, 0x75, 0x7f, 0xc0, 0x01, 0x55, 0x5f, 0xff, 0xdf, 0xf5, 0x56, 0xfc, 0xe0,
-  0x2a, 0x8a, 0xaa, 0x80, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x02, 0xaa, 0xbf, 0xbb, 0xff, 0xfa, 0xae, 0xe0, 0xe0,
-  0x51, 0x00, 0x00, 0x3f, 0xfd, 0x5d, 0x5d, 0x40, 0x00, 0x05, 0x45, 0x5f, 0x7f, 0xdf, 0xf5, 0x56, 0xff, 0xe0,
-  0x28, 0x28, 0xa8, 0x83, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0a, 0x8a, 0xaf, 0xff, 0xbf, 0xfa, 0xaa, 0xe0, 0xe0,
-  0x50, 0x00, 0x00, 0x3f, 0xfd, 0xf5, 0x02, 0x03, 0x00, 0x04, 0x55, 0x5f, 0x7f, 0x7f, 0x7d, 0x54, 0xfc, 0xe0,
-  0x20, 0xaa, 0x8a, 0x3e, 0xbf, 0xff, 0x3e, 0x0c, 0x07, 0x08, 0x0a, 0xae, 0xff, 0xfe, 0xfa, 0xea, 0xe0, 0xe0,
-  0x50, 0x00, 0x40, 0x3f, 0xf5, 0x54, 0x08, 0x00, 0x38, 0x10, 0x15, 0x55, 0xff, 0xff, 0xf5, 0xd4, 0xff, 0xe0,
-  0x20, 0xa8, 0x82, 0xba, 0xbf, 0xff, 0xdf, 0xc0, 0x00, 0x20, 0x3e, 0xaa, 0xff, 0xff, 0xeb, 0xa8, 0xe0, 0xe0,
-  0x40, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x70, 0x00, 0x47, 0xd5, 0x55, 0xff, 0xfd, 0xf0, 0x00, 0xea, 0xe0,
-  0x38, 0x28, 0x1f, 0xff, 0xaa, 0xea, 0x00, 0x18, 0x00, 0x00, 0x0a, 0xab, 0xef, 0xfa, 0x03, 0xaa, 0xee, 0xe0,
-  0x44, 0x01, 0x40, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x15, 0x55, 0xdf, 0xfd, 0xf7, 0x56, 0xff, 0xe0,
-  0x0a, 0x08, 0x1f, 0xfc, 0x7e, 0xab, 0xab, 0xab, 0xef, 0xc0, 0x0a, 0xaa, 0xbf, 0xfa, 0xef, 0xae, 0xe0, 0xe0,
-  0x55, 0x07, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x05, 0x55, 0x5f, 0xf5, 0xdf, 0x5e, 0xfa, 0xe0,
-  0x2a, 0xd9, 0xff, 0xff, 0xea, 0xee, 0xae, 0xba, 0xaf, 0xd8, 0x0a, 0xaa, 0xbf, 0xeb, 0xff, 0xfa, 0xe4, 0xe0,
-  0x5f, 0x14, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x05, 0x57, 0x5f, 0xff, 0xff, 0x54, 0xff, 0xe0,
-  0x7a, 0x89, 0x40, 0x7f, 0xff, 0xff, 0xfa, 0xbb, 0xaf, 0xdb, 0xfa, 0xae, 0xbf, 0xef, 0xff, 0xaa, 0xe0, 0xe0,
-  0x55, 0x50, 0x01, 0x1f, 0xdd, 0x7d, 0x7f, 0xff, 0xfd, 0xfe, 0x00, 0x5d, 0x5f, 0xdf, 0xff, 0x54, 0xea, 0xe0,
-  0x2a, 0x8c, 0x50, 0x40, 0x7f, 0xff, 0xee, 0xee, 0xbf, 0xd8, 0x00, 0xbe, 0xaf, 0xbf, 0x00, 0xaa, 0xe4, 0xe0,
-  0x55, 0x40, 0x05, 0x1f, 0xfd, 0x75, 0x7f, 0xff, 0xfd, 0x70, 0x00, 0x7d, 0x60, 0x00, 0xff, 0x56, 0xff, 0xe0,
-  0x2a, 0x99, 0x10, 0x7f, 0xff, 0xff, 0xeb, 0xba, 0xef, 0xc0, 0x00, 0xe0, 0x0f, 0xff, 0xbe, 0xaa, 0xe0, 0xe0,
-  0x55, 0x00, 0x07, 0xff, 0xd5, 0xdf, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x55, 0xd7, 0xff, 0x7d, 0x54, 0xea, 0xe0,
-  0x2a, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x40, 0x00, 0x01, 0xf0, 0xaa, 0xaf, 0xbf, 0xfa, 0xaa, 0xee, 0xe0,
-  0x51, 0x7f, 0xff, 0x5f, 0x7d, 0x5f, 0x6f, 0xf0, 0x00, 0x3e, 0x00, 0x55, 0xd7, 0x7f, 0x7d, 0x54, 0xff, 0xe0,
-  0x2c, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x02, 0xab, 0xeb, 0xfe, 0xfa, 0xaa, 0xe0, 0xe0,
-  0x54, 0x00, 0x7f, 0xf5, 0x7d, 0xf5, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x57, 0xd5, 0x7d, 0xfd, 0xc0, 0xfa, 0xe0,
-  0x29, 0x45, 0x07, 0xff, 0xff, 0xff, 0xef, 0xef, 0xff, 0xc0, 0x02, 0x2f, 0xea, 0xfb, 0xc0, 0x2a, 0xe0, 0xe0,
-  0x54, 0x00, 0x11, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0x57, 0x78, 0x01, 0x5f, 0xd5, 0x74, 0x35, 0x56, 0xff, 0xe0,
-  0x03, 0x55, 0x04, 0x03, 0xff, 0xff, 0xeb, 0xaf, 0xff, 0xec, 0x02, 0xbf, 0xaa, 0xff, 0xeb, 0xae, 0xe0, 0xe0,
-  0x15, 0x00, 0x51, 0xff, 0x5d, 0x77, 0x7f, 0xfd, 0x75, 0x7f, 0x05, 0x7d, 0x7d, 0x7f, 0xf7, 0xfe, 0xfc, 0xe0,
-  0x2a, 0x41, 0x07, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xef, 0xa2, 0xab, 0xea, 0xff, 0xef, 0xff, 0x60, 0xe0,
-  0x55, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0x7f, 0xe5, 0x5d, 0x5d, 0x7f, 0xdf, 0xff, 0x7f, 0xe0,
-  0x2a, 0x2f, 0xff, 0xff, 0xee, 0xbf, 0xef, 0xbf, 0xff, 0xed, 0xbf, 0xea, 0xfa, 0xbf, 0xef, 0xff, 0xbf, 0xe0,
-  0x7f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x5f, 0xff, 0xe5, 0x55, 0xf5, 0x7f, 0xdf, 0xdf, 0xcf, 0xe0,
-  0x2b, 0x73, 0xff, 0xff, 0xaa, 0xbe, 0xae, 0xef, 0xff, 0xfd, 0x8a, 0xab, 0xea, 0xbf, 0xff, 0xff, 0xb0, 0xa0,
-  0x14, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0x7f, 0x45, 0x57, 0xf5, 0x7f, 0xff, 0xdf, 0x7f, 0xc0,
-  0x09, 0x65, 0x10, 0xfe, 0xef, 0xaf, 0xab, 0xaf, 0xff, 0xee, 0xbe, 0xaf, 0xfa, 0xff, 0xff, 0xbe, 0xff, 0xa0,
-  0x50, 0x10, 0x02, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x7d, 0xf5, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x60,
-  0x14, 0xe9, 0x50, 0x80, 0xab, 0xea, 0xee, 0xef, 0xff, 0xca, 0xaa, 0xbf, 0xfa, 0xf0, 0x7f, 0xff, 0xfe, 0xe0,
-  0x41, 0x10, 0x02, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x15, 0x5d, 0x7f, 0x40, 0x07, 0xfd, 0xff, 0xff, 0xe0,
-  0x24, 0x64, 0x50, 0xff, 0xfe, 0xa0, 0x00, 0x80, 0x00, 0x0a, 0xba, 0xf8, 0x2b, 0xab, 0xfb, 0xff, 0xff, 0xe0,
-  0x41, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x3f, 0xe0, 0x00, 0x15, 0x75, 0xff, 0xd7, 0x5f, 0xf7, 0xfd, 0xff, 0xe0,
-  0x20, 0x63, 0xff, 0x87, 0xfd, 0x40, 0x04, 0x00, 0x00, 0x2a, 0xeb, 0xff, 0xea, 0xbe, 0xef, 0xfb, 0xef, 0xe0,
-  0x01, 0x1f, 0xf8, 0x7f, 0xff, 0xf1, 0xfc, 0x00, 0x7c, 0x15, 0xf7, 0xff, 0xf5, 0x7d, 0xff, 0xf7, 0xdf, 0xc0,
-  0x74, 0xa7, 0xff, 0xff, 0x55, 0x50, 0x40, 0x0f, 0x80, 0x2b, 0xff, 0xff, 0xfa, 0xfb, 0xef, 0xef, 0xaf, 0xa0,
-  0x01, 0x10, 0x7f, 0xff, 0xff, 0xf3, 0xf0, 0x00, 0x00, 0x5f, 0xf7, 0xff, 0xf5, 0xff, 0xdf, 0xff, 0x5f, 0xc0,
-  0x00, 0x65, 0x0f, 0xfd, 0x75, 0xc0, 0x1e, 0x00, 0x00, 0xea, 0xaf, 0xff, 0xfa, 0xfb, 0xaf, 0xf0, 0x3f, 0xa0,
-  0x40, 0x10, 0x7f, 0xff, 0xff, 0x01, 0xf0, 0x00, 0x00, 0x55, 0x5f, 0xff, 0xf5, 0xf7, 0x40, 0x0f, 0x7f, 0x40,
-  0x20, 0x70, 0x01, 0xff, 0xff, 0xff, 0x80, 0x03, 0xe0, 0xaa, 0xaf, 0xff, 0xfb, 0xc0, 0x0b, 0xfe, 0xbe, 0xa0,
-  0x54, 0x05, 0x44, 0x0f, 0x5d, 0xd7, 0xfc, 0x00, 0x01, 0x45, 0x5f, 0x7f, 0xf0, 0x3f, 0x57, 0xfd, 0x7d, 0x60,
-  0x22, 0x80, 0x00, 0xa1, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x80, 0xbe, 0xff, 0xeb, 0xfe, 0xaf, 0xfb, 0xfb, 0xe0,
-  0x95, 0x55, 0x14, 0x04, 0x7d, 0x75, 0xfd, 0x80, 0x01, 0x01, 0x7d, 0xff, 0xd7, 0xfd, 0x5f, 0x77, 0xfd, 0xd0,
-  0xa2, 0xa8, 0x00, 0x80, 0x1f, 0xff, 0xd7, 0xfe, 0x02, 0x02, 0xfe, 0xff, 0xab, 0xfa, 0xbe, 0xff, 0xfb, 0xd0,
-  0xd5, 0x55, 0x14, 0x00, 0x40, 0x7d, 0xfd, 0x80, 0x00, 0x01, 0xff, 0x7f, 0x57, 0xfd, 0x7d, 0xff, 0xf7, 0x30,
-  0xe2, 0xa8, 0x00, 0xa1, 0x1f, 0xff, 0x77, 0x00, 0x00, 0x03, 0xfe, 0xaa, 0xff, 0xfa, 0xfe, 0xff, 0xfe, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam25 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam25_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM26
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM26
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM26 uint8_t hammerbeam26_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0x07, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x70,
-  0xc0, 0x03, 0xe0, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x02, 0xba, 0x01, 0x00, 0x30,
-  0x90, 0x0f, 0xf5, 0x55, 0x51, 0x00, 0x00, 0x00, 0x04, 0x07, 0x80, 0x00, 0x00, 0x7d, 0x45, 0x02, 0x00, 0x10,
-  0xa0, 0x0b, 0xaa, 0xa2, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x3e, 0x87, 0x82, 0xc6, 0x81, 0x1f, 0x10,
-  0x00, 0x11, 0x44, 0x15, 0x51, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x63, 0xf8, 0x05, 0x83, 0x41, 0x04, 0x00,
-  0x00, 0x0a, 0x28, 0xa0, 0x8a, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x01, 0x62, 0xb0, 0x0a, 0x82, 0xa1, 0x1f, 0x00,
-  0x41, 0x55, 0x55, 0x15, 0x51, 0x00, 0x41, 0x00, 0x80, 0x1b, 0x01, 0x7f, 0xe8, 0x0d, 0x83, 0x61, 0x00, 0x00,
-  0x77, 0xff, 0xff, 0xba, 0x0a, 0x80, 0x80, 0x01, 0x00, 0x19, 0x83, 0x62, 0x98, 0x1a, 0x82, 0xb1, 0x1f, 0x00,
-  0x55, 0x55, 0x5d, 0xf5, 0x51, 0x00, 0x40, 0x00, 0x80, 0x31, 0x87, 0x63, 0xd4, 0x15, 0x01, 0x51, 0x05, 0x00,
-  0x08, 0x0b, 0xaf, 0xb8, 0x8a, 0xe0, 0x00, 0x00, 0x88, 0x50, 0xd7, 0x7e, 0x92, 0x2b, 0x01, 0xa9, 0x1f, 0x00,
-  0x00, 0x47, 0x5d, 0xf5, 0x51, 0xfc, 0x00, 0x00, 0x00, 0x10, 0x44, 0x63, 0xd1, 0x35, 0x01, 0x59, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xba, 0x0b, 0xec, 0x00, 0x00, 0x08, 0x20, 0x14, 0xe2, 0x91, 0x3f, 0xff, 0xf9, 0x1f, 0x00,
-  0x00, 0x1f, 0x55, 0x75, 0x51, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1f, 0xff, 0xc8, 0x41, 0x01, 0x05, 0x03, 0x00,
-  0x00, 0x3e, 0xaa, 0xaa, 0xaa, 0x80, 0x00, 0x00, 0x08, 0x00, 0x17, 0xfe, 0x88, 0xff, 0xff, 0xfd, 0x1f, 0x00,
-  0x04, 0x7f, 0xff, 0x7f, 0xdf, 0x80, 0x00, 0x00, 0x04, 0x00, 0x1c, 0xf8, 0x09, 0x56, 0x00, 0xd5, 0x00, 0x00,
-  0x08, 0xff, 0xff, 0xee, 0xfa, 0x00, 0x02, 0x00, 0x08, 0x00, 0x1c, 0xfe, 0x4a, 0xea, 0x00, 0xad, 0x1f, 0x00,
-  0x15, 0xff, 0xf5, 0x7f, 0xdf, 0x00, 0x01, 0x00, 0x00, 0x01, 0x3f, 0xff, 0xec, 0xd6, 0x00, 0xd5, 0x03, 0x00,
-  0x28, 0xff, 0xfb, 0xee, 0xfb, 0x80, 0x05, 0x00, 0x08, 0x01, 0x1f, 0xfe, 0xed, 0xaa, 0x00, 0xab, 0x1f, 0x00,
-  0x51, 0xff, 0xd5, 0x7f, 0xdf, 0xf8, 0x03, 0x02, 0x00, 0x02, 0x3c, 0xf6, 0x55, 0xd6, 0x00, 0xd7, 0x00, 0x00,
-  0x09, 0xfe, 0xff, 0xee, 0xfa, 0xff, 0x03, 0x0c, 0x08, 0x01, 0x3c, 0xfa, 0x16, 0xaa, 0x00, 0xab, 0x1f, 0x00,
-  0x52, 0xff, 0xff, 0x7f, 0xdf, 0xfb, 0x03, 0xb8, 0x04, 0x01, 0x3f, 0xf3, 0x26, 0xd6, 0x00, 0xd7, 0x15, 0x00,
-  0x0b, 0xfa, 0xff, 0xee, 0xfa, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x3f, 0xf9, 0x44, 0xaa, 0x00, 0xab, 0x11, 0x00,
-  0x53, 0xfd, 0xff, 0x7f, 0xdf, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x1c, 0xd1, 0x06, 0xd6, 0x00, 0xd7, 0x00, 0x00,
-  0x2a, 0x4a, 0xeb, 0xee, 0xfb, 0x80, 0x01, 0xc0, 0x00, 0x00, 0x3c, 0xf9, 0x0a, 0xaa, 0x00, 0xab, 0x1f, 0x00,
-  0x5e, 0x0f, 0xfd, 0x7f, 0xdf, 0xf0, 0x01, 0xc0, 0x01, 0x00, 0x1f, 0xd0, 0x0a, 0xd6, 0x00, 0xd7, 0x05, 0x00,
-  0x7a, 0x7f, 0xeb, 0xee, 0xfa, 0xfe, 0x03, 0xb0, 0x00, 0x00, 0x1f, 0xfc, 0x12, 0xaa, 0x00, 0xab, 0x1b, 0x00,
-  0x4f, 0xfd, 0xff, 0x7f, 0xdf, 0xf6, 0x03, 0x30, 0x00, 0x00, 0x1c, 0xd2, 0x12, 0xd6, 0x00, 0xd7, 0x00, 0x00,
-  0x5b, 0xa2, 0xbf, 0xfe, 0xfa, 0x00, 0x01, 0x00, 0x20, 0x00, 0x14, 0xf9, 0x91, 0xaa, 0x00, 0xab, 0x1f, 0x00,
-  0x5f, 0x14, 0x55, 0x77, 0xdf, 0x00, 0x00, 0x80, 0x40, 0x40, 0x1f, 0xd0, 0x61, 0xd6, 0x00, 0xd7, 0x15, 0x00,
-  0x5b, 0xa2, 0xea, 0xaa, 0xfb, 0x80, 0x40, 0x00, 0x20, 0x80, 0x17, 0xf8, 0x21, 0xaa, 0x00, 0xab, 0x1b, 0x00,
-  0x4f, 0x14, 0x70, 0x5d, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd0, 0x59, 0x56, 0x00, 0xd5, 0x00, 0x00,
-  0x0f, 0xa2, 0xa8, 0xba, 0xfa, 0x80, 0x00, 0x00, 0x00, 0x80, 0x14, 0xf8, 0x45, 0x6a, 0x00, 0xad, 0x1f, 0x00,
-  0x55, 0x54, 0x51, 0x7f, 0xdf, 0x80, 0x00, 0x00, 0x00, 0x49, 0x07, 0xd0, 0x82, 0xd6, 0x00, 0xd5, 0x15, 0x00,
-  0x00, 0x22, 0xea, 0xff, 0xfe, 0x00, 0x08, 0x02, 0x00, 0x8b, 0x17, 0xf8, 0x80, 0xff, 0xff, 0xfd, 0x11, 0x00,
-  0x50, 0x14, 0x75, 0xf5, 0x5d, 0x55, 0x45, 0x54, 0x00, 0x06, 0x04, 0xd1, 0x01, 0xc1, 0x01, 0x05, 0x00, 0x00,
-  0x40, 0x22, 0xab, 0xea, 0x2a, 0x8a, 0xa8, 0x02, 0x80, 0x82, 0x04, 0xf9, 0x06, 0x3f, 0xff, 0xf9, 0x1f, 0x00,
-  0x55, 0x54, 0x57, 0xc1, 0x15, 0x50, 0x05, 0x14, 0x40, 0x05, 0x07, 0xf2, 0x18, 0x35, 0x01, 0x59, 0x05, 0x00,
-  0x0a, 0xaa, 0xaf, 0xa2, 0x0a, 0x08, 0xa8, 0xa2, 0xa8, 0x04, 0x07, 0xba, 0x60, 0x2b, 0x01, 0xa9, 0x1f, 0x00,
-  0x5f, 0xf7, 0xff, 0x41, 0x44, 0x54, 0x45, 0x14, 0x54, 0x00, 0x03, 0xb5, 0x80, 0x15, 0x01, 0x51, 0x00, 0x00,
-  0x6e, 0xbe, 0xfe, 0xaa, 0x8a, 0x2a, 0xa8, 0x02, 0xaa, 0x00, 0x00, 0xbe, 0x00, 0x1a, 0x82, 0xb1, 0x1f, 0x00,
-  0x3f, 0xf7, 0xfd, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0x00, 0x31, 0xc0, 0x0d, 0x83, 0x61, 0x03, 0x00,
-  0x0b, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfe, 0xff, 0x0a, 0x08, 0x30, 0x38, 0x0a, 0x82, 0xa0, 0x9f, 0x00,
-  0x1f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x57, 0xfe, 0x0e, 0x10, 0x30, 0x07, 0x85, 0x83, 0x40, 0x80, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xef, 0xbe, 0xf8, 0x1c, 0x08, 0x30, 0x00, 0x72, 0xc6, 0x80, 0x40, 0x00,
-  0x3f, 0xff, 0x7f, 0xdf, 0xdf, 0xfd, 0x7d, 0xf7, 0xf0, 0x18, 0x00, 0x30, 0x00, 0x0b, 0x45, 0x00, 0x30, 0x00,
-  0x2a, 0xa8, 0xaa, 0x2b, 0xab, 0xbe, 0xef, 0xbe, 0xe0, 0x18, 0x00, 0x10, 0x00, 0x01, 0xba, 0x00, 0x0f, 0x40,
-  0x41, 0x55, 0x11, 0x47, 0xff, 0xfd, 0x7d, 0x57, 0x80, 0x10, 0x00, 0x10, 0x00, 0x00, 0x7c, 0x00, 0x80, 0x00,
-  0x22, 0x00, 0xaa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x20, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80,
-  0x41, 0x15, 0x11, 0x44, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0x0a, 0x08, 0xaa, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80,
-  0x45, 0x55, 0x05, 0x47, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40,
-  0x2a, 0xaa, 0xaa, 0xab, 0xf0, 0x10, 0x10, 0x00, 0x80, 0x00, 0x01, 0x04, 0x02, 0x00, 0x40, 0x0a, 0x00, 0xa0,
-  0x7f, 0xfd, 0xff, 0x7f, 0x80, 0x30, 0x20, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x09, 0x01, 0x40,
-  0x7f, 0xbf, 0xbb, 0xe8, 0x00, 0x30, 0x10, 0x00, 0x80, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x10, 0x00, 0x80,
-  0x75, 0x55, 0xff, 0x7e, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x7b, 0xff, 0xbb, 0xe8, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xdf, 0xff, 0xfe, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfb, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x2a, 0x2b, 0x80, 0x60, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x51, 0x46, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x00, 0x20, 0x03, 0xf8, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x0a, 0x28, 0x00, 0x00, 0x00, 0xde, 0x00, 0x20, 0x00, 0x80, 0x02, 0x04, 0x78, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x55, 0x54, 0x00, 0x00, 0x00, 0x83, 0x08, 0x41, 0x00, 0x80, 0x04, 0x00, 0x38, 0x08, 0x04, 0x00, 0x00, 0x00,
-  0x7f, 0xee, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x02, 0x00, 0x38, 0x04, 0x02, 0x00, 0x00, 0x00,
-  0xbd, 0x78, 0x40, 0x00, 0x40, 0x00, 0x00, 0x41, 0x00, 0x80, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x00, 0x10,
-  0xaf, 0xea, 0x80, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x30,
-  0xe0, 0x60, 0x80, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam26 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam26_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM27
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM27
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM27 uint8_t hammerbeam27_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe0, 0xff, 0xed, 0xc0, 0x91, 0xe1, 0x55, 0x55, 0x55, 0x50, 0x00, 0x7d, 0xff, 0x7f, 0xef, 0x7f, 0xfe, 0x70,
-  0xc1, 0xff, 0xff, 0xcc, 0x97, 0xf0, 0xaa, 0xaa, 0xa8, 0x80, 0x10, 0xfe, 0xfe, 0xfb, 0xff, 0xfe, 0xff, 0xb0,
-  0x83, 0xc0, 0x0c, 0x00, 0x96, 0x78, 0x45, 0x55, 0x54, 0x00, 0x0f, 0xff, 0xff, 0xf7, 0xff, 0xe3, 0xff, 0xd0,
-  0x87, 0x85, 0x01, 0x46, 0x90, 0x40, 0x48, 0xaa, 0xaa, 0x80, 0x03, 0xff, 0xfe, 0xff, 0xff, 0xc2, 0xe0, 0xd0,
-  0x0f, 0x07, 0x45, 0xc0, 0x90, 0x4f, 0x48, 0x55, 0x55, 0x40, 0x03, 0x7f, 0xf7, 0xf7, 0xff, 0xb6, 0xfb, 0xe0,
-  0x1f, 0x05, 0xcd, 0x4c, 0x90, 0x4f, 0x4b, 0xaa, 0xaa, 0x80, 0x03, 0x7f, 0xee, 0xef, 0xff, 0xf6, 0xe0, 0xe0,
-  0x3f, 0x81, 0x47, 0x60, 0x96, 0x40, 0x49, 0x55, 0x55, 0x40, 0x03, 0x7f, 0xf7, 0x75, 0xff, 0xf2, 0xff, 0xe0,
-  0x7f, 0xc0, 0x65, 0x46, 0x92, 0x40, 0x48, 0xaa, 0xaa, 0xa0, 0x03, 0x3f, 0xea, 0xea, 0xfe, 0xf2, 0xe0, 0xe0,
-  0x7f, 0xe0, 0x44, 0x40, 0x90, 0x4f, 0x48, 0x55, 0x55, 0x40, 0x06, 0x3f, 0xf7, 0x75, 0x7c, 0x32, 0xfa, 0xe0,
-  0x7e, 0xf0, 0x00, 0x00, 0x00, 0x4f, 0x4b, 0xaa, 0xaa, 0x80, 0x06, 0x7f, 0xee, 0xea, 0xbc, 0x84, 0xe0, 0xe0,
-  0x7e, 0xb8, 0xff, 0xff, 0x6e, 0x40, 0x49, 0x55, 0x51, 0x00, 0x0e, 0x7f, 0xff, 0x75, 0xff, 0x80, 0xff, 0xe0,
-  0x7e, 0x2c, 0x7d, 0xff, 0x6e, 0x40, 0x48, 0xaa, 0xa2, 0x80, 0x07, 0x7f, 0xee, 0xaa, 0xff, 0x50, 0xe0, 0xe0,
-  0x7a, 0x8e, 0x39, 0x75, 0x6a, 0x4f, 0x48, 0x00, 0x12, 0x02, 0x43, 0x7f, 0xf7, 0x75, 0x7f, 0x58, 0xfc, 0xe0,
-  0x78, 0xaf, 0x1c, 0x51, 0x68, 0x4f, 0x4b, 0x31, 0x92, 0xda, 0x59, 0xbb, 0xee, 0xea, 0xff, 0x38, 0xe0, 0xe0,
-  0x72, 0xff, 0x8f, 0x45, 0x6e, 0x40, 0x48, 0x20, 0x12, 0x02, 0x40, 0xfd, 0xd7, 0x75, 0xfe, 0xb8, 0xff, 0xe0,
-  0x7f, 0xcf, 0xc7, 0xd5, 0x6e, 0x40, 0x48, 0x0c, 0x12, 0x62, 0x40, 0xfb, 0xee, 0xeb, 0xee, 0xbc, 0xe0, 0xe0,
-  0x00, 0x48, 0x24, 0x5d, 0x6a, 0x4f, 0x48, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x77, 0xde, 0xbc, 0xfc, 0xe0,
-  0x13, 0x49, 0xa4, 0x4f, 0x68, 0x4f, 0x48, 0xff, 0xed, 0xfd, 0xb8, 0x7b, 0xef, 0xeb, 0xfe, 0xbc, 0xe0, 0xe0,
-  0x10, 0x48, 0x25, 0xdf, 0x6e, 0x4f, 0x4b, 0x00, 0x6d, 0x25, 0xa0, 0x3f, 0xff, 0x77, 0xde, 0xbc, 0xff, 0xe0,
-  0x56, 0x4b, 0x24, 0x7f, 0xfe, 0x4f, 0x48, 0x10, 0x2d, 0xfd, 0xa0, 0x3b, 0xef, 0xfb, 0xfe, 0xbe, 0xe0, 0xe0,
-  0x50, 0x48, 0x24, 0x00, 0x62, 0x4f, 0x48, 0x30, 0x6d, 0x9d, 0xa0, 0x3f, 0xff, 0x77, 0xde, 0xde, 0xea, 0xe0,
-  0x73, 0x49, 0xa4, 0x00, 0x02, 0x40, 0x48, 0x7f, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xbb, 0xee, 0xde, 0xee, 0xe0,
-  0x50, 0x48, 0x25, 0x81, 0x9a, 0x40, 0x4b, 0xf5, 0x5d, 0x51, 0x90, 0x3f, 0xff, 0xfd, 0xde, 0xde, 0xff, 0xe0,
-  0x46, 0x4b, 0x24, 0x40, 0x02, 0x4f, 0x49, 0xea, 0xaa, 0xa0, 0x28, 0x3b, 0xff, 0xff, 0xee, 0xde, 0xe0, 0xe0,
-  0x00, 0x00, 0x00, 0x60, 0x62, 0x4f, 0x48, 0xd5, 0x55, 0x50, 0x10, 0x37, 0xff, 0xff, 0xd6, 0xee, 0xfa, 0xe0,
-  0x24, 0x37, 0xdb, 0xf0, 0x02, 0x40, 0x48, 0xaa, 0xaa, 0xa0, 0x28, 0x77, 0xff, 0xff, 0xaf, 0x7e, 0xe4, 0xe0,
-  0x24, 0x36, 0x5b, 0xf8, 0xf2, 0x40, 0x4b, 0x55, 0x55, 0x40, 0x14, 0x77, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xe0,
-  0x25, 0xb7, 0xdb, 0xfc, 0xfa, 0x4f, 0x4a, 0xaa, 0xaa, 0xa0, 0x2a, 0xf7, 0xff, 0xff, 0xbf, 0xf6, 0xe0, 0xe0,
-  0x24, 0xf4, 0xda, 0x7e, 0xf2, 0x4f, 0x48, 0x55, 0x55, 0x40, 0x55, 0xf3, 0xff, 0xc7, 0xdf, 0xf8, 0xea, 0xe0,
-  0x24, 0x77, 0xdb, 0xff, 0x02, 0x40, 0x48, 0xaa, 0xaa, 0x80, 0x2a, 0xf3, 0xff, 0x23, 0xaf, 0xfc, 0xe4, 0xe0,
-  0x24, 0x36, 0x5b, 0x80, 0x02, 0x40, 0x4b, 0x55, 0x54, 0x00, 0x54, 0x77, 0xf0, 0x01, 0xdf, 0xfa, 0xff, 0xe0,
-  0x25, 0x9f, 0xda, 0x18, 0x1a, 0x4f, 0x4a, 0xaa, 0xa8, 0x80, 0x28, 0x77, 0xf3, 0x79, 0xff, 0xfe, 0xe0, 0xe0,
-  0x24, 0x0c, 0xda, 0x01, 0x82, 0x4f, 0x48, 0x55, 0x55, 0x40, 0x10, 0x36, 0xf0, 0x01, 0xdf, 0xfe, 0xea, 0xe0,
-  0x24, 0x07, 0xdb, 0x80, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xa0, 0x28, 0x3d, 0xff, 0x3b, 0xff, 0x7e, 0xee, 0xe0,
-  0x24, 0x03, 0xdb, 0xff, 0xfd, 0xbf, 0xb7, 0x55, 0x55, 0x50, 0x10, 0x1d, 0xff, 0xc7, 0xff, 0x8c, 0xff, 0xe0,
-  0x25, 0x81, 0xdb, 0xf3, 0xfd, 0xb9, 0xb7, 0xaa, 0xaa, 0xa8, 0x20, 0x1d, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0,
-  0x25, 0xc0, 0xda, 0x7f, 0xcd, 0xbf, 0xb5, 0x55, 0x55, 0x54, 0x10, 0x19, 0xff, 0xff, 0xff, 0x62, 0xfa, 0xe0,
-  0x24, 0x60, 0x7b, 0xff, 0xff, 0xff, 0xb4, 0xaa, 0xaa, 0xa8, 0x20, 0x19, 0xfd, 0xff, 0xff, 0x8e, 0xe0, 0xe0,
-  0x24, 0x70, 0x3b, 0x80, 0x01, 0xff, 0xb7, 0x55, 0x55, 0x54, 0x10, 0x11, 0xf8, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x25, 0xf8, 0x1a, 0x06, 0x0c, 0x81, 0xb7, 0xaa, 0xaa, 0xaa, 0x00, 0x11, 0xfd, 0xff, 0xef, 0xfe, 0xe0, 0xe0,
-  0x25, 0xfc, 0x0e, 0x00, 0x01, 0x80, 0xb5, 0x55, 0x55, 0x54, 0x10, 0x11, 0x7f, 0xff, 0xff, 0xf6, 0xfc, 0xe0,
-  0x24, 0x7e, 0x07, 0xe0, 0x03, 0x80, 0xb4, 0xaa, 0xaa, 0xaa, 0x08, 0x21, 0x1f, 0xfe, 0xef, 0xef, 0x60, 0xe0,
-  0x00, 0x6f, 0x03, 0x81, 0x87, 0x81, 0xb7, 0x55, 0x55, 0x55, 0x40, 0x01, 0x0f, 0xdd, 0xf5, 0xff, 0x7f, 0xe0,
-  0x5b, 0xeb, 0x80, 0x00, 0x0f, 0xff, 0xb7, 0xaa, 0xaa, 0xaa, 0x28, 0x01, 0x07, 0xbd, 0xee, 0xef, 0xbf, 0xe0,
-  0x5b, 0xe2, 0xc1, 0xf8, 0x1f, 0xbf, 0xb5, 0x55, 0x55, 0x55, 0x55, 0x00, 0x87, 0xbd, 0xfd, 0x77, 0x4f, 0xe0,
-  0x5b, 0xc8, 0xe1, 0xfc, 0x3f, 0xb3, 0xb4, 0xaa, 0xaa, 0xaa, 0x2a, 0x80, 0x03, 0xb9, 0xee, 0xeb, 0xf0, 0xa0,
-  0x5a, 0x6a, 0xb1, 0xfc, 0x7d, 0xbf, 0xff, 0x15, 0x45, 0x51, 0x15, 0x40, 0x01, 0xb9, 0xfd, 0xf7, 0x7e, 0x00,
-  0x5b, 0xee, 0x39, 0xf8, 0xf9, 0x80, 0x00, 0x90, 0x24, 0x12, 0xaa, 0xa0, 0x01, 0x99, 0xff, 0xee, 0xff, 0x00,
-  0x5b, 0xff, 0xbc, 0x01, 0xf0, 0x26, 0x8a, 0x91, 0xa5, 0xd2, 0x15, 0x40, 0x01, 0x98, 0xfd, 0xff, 0x7f, 0x80,
-  0x5b, 0xe7, 0xfe, 0x03, 0xe2, 0xe0, 0xca, 0x90, 0x25, 0xd2, 0x0a, 0xa0, 0x00, 0xb0, 0x7e, 0xee, 0xaf, 0xc0,
-  0x00, 0x24, 0x6e, 0x67, 0xca, 0xac, 0x8e, 0x93, 0x24, 0x12, 0x01, 0x50, 0x00, 0xb0, 0x7d, 0xf7, 0x57, 0xe0,
-  0x09, 0xa4, 0x6a, 0x0f, 0x8b, 0x81, 0xaa, 0x90, 0x24, 0x12, 0x00, 0xa0, 0x00, 0xb0, 0x7f, 0xee, 0xab, 0xe0,
-  0x28, 0x25, 0xea, 0x1f, 0x0e, 0x98, 0xb8, 0x96, 0x25, 0xd2, 0x00, 0x00, 0x00, 0xb8, 0x4f, 0xff, 0x57, 0xe0,
-  0x3b, 0x25, 0xe2, 0x3e, 0x08, 0x00, 0x28, 0x90, 0x25, 0xd2, 0x00, 0x0a, 0x00, 0xf8, 0x87, 0xee, 0xab, 0xe0,
-  0x28, 0x25, 0xea, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf8, 0x03, 0xf7, 0x57, 0xe0,
-  0x29, 0xa4, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xdb, 0xed, 0xff, 0xfc, 0x80, 0xf8, 0x03, 0xff, 0xaf, 0xe0,
-  0x28, 0x24, 0x7f, 0xff, 0xff, 0xf3, 0x7f, 0x6e, 0x5a, 0x2d, 0xff, 0xfd, 0x41, 0xf0, 0x0f, 0xff, 0x7f, 0xe0,
-  0x63, 0x24, 0x7f, 0xff, 0xff, 0xff, 0x15, 0x6f, 0xda, 0x2d, 0xff, 0xfa, 0xa1, 0xf8, 0x10, 0xff, 0xbf, 0xe0,
-  0x20, 0x24, 0x7f, 0xff, 0x3f, 0xe7, 0xd1, 0x6c, 0xdb, 0xed, 0xff, 0xd5, 0x51, 0xf0, 0x00, 0x7f, 0xdd, 0xc0,
-  0x21, 0xa5, 0x80, 0x01, 0x20, 0x24, 0x45, 0x6f, 0xdb, 0xed, 0xff, 0xaa, 0xa9, 0x80, 0x00, 0x3f, 0xbb, 0xe0,
-  0x00, 0x24, 0x00, 0x8d, 0x2f, 0xa4, 0x57, 0x69, 0xdb, 0xed, 0xfd, 0x55, 0x54, 0x10, 0x00, 0x1f, 0xff, 0xe0,
-  0x03, 0x24, 0x02, 0x81, 0x2f, 0xa5, 0xf7, 0x6f, 0xda, 0x2d, 0xfa, 0xaa, 0xa8, 0x20, 0x00, 0x1f, 0xbb, 0xe0,
-  0x80, 0x00, 0x02, 0x99, 0x20, 0x24, 0x7f, 0x6f, 0xda, 0x2d, 0xd5, 0x55, 0x54, 0x14, 0x00, 0x0f, 0xfd, 0xd0,
-  0xbf, 0xdb, 0x8b, 0x81, 0x20, 0x24, 0x7f, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xa8, 0x2a, 0x00, 0x0f, 0xfb, 0xd0,
-  0xda, 0xdb, 0x9a, 0x8d, 0x20, 0x24, 0x55, 0x75, 0x5d, 0x5d, 0x55, 0x55, 0x54, 0x55, 0x00, 0x0e, 0xff, 0xb0,
-  0xe0, 0xda, 0x0e, 0x01, 0x2f, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x2a, 0x00, 0x0d, 0xfa, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam27 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam27_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM28
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM28
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM28 uint8_t hammerbeam28_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x06, 0xe0, 0x0e, 0xff, 0xdf, 0x55, 0x7f, 0xf0, 0x57, 0xfe, 0x70,
-  0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0x82, 0xa0, 0x06, 0x60, 0x1e, 0xff, 0xee, 0xaa, 0xbb, 0xc0, 0x2a, 0xff, 0xb0,
-  0x95, 0x55, 0x55, 0x55, 0x55, 0x01, 0x44, 0x0e, 0x60, 0x7e, 0xf7, 0xd7, 0x5d, 0x7f, 0x0f, 0xd1, 0xff, 0xd0,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x80, 0x82, 0x0e, 0xe1, 0xfe, 0xef, 0xee, 0xaa, 0xfe, 0x3e, 0x28, 0xe0, 0xd0,
-  0x15, 0x55, 0x55, 0x55, 0x55, 0x01, 0x02, 0x1e, 0xe3, 0xff, 0x77, 0xdf, 0x55, 0xfc, 0x62, 0x5c, 0xfb, 0xe0,
-  0x0a, 0xaa, 0xaa, 0xaa, 0xaa, 0x80, 0x82, 0x3e, 0xf3, 0xff, 0xef, 0xee, 0xab, 0xf8, 0x80, 0xbe, 0xe0, 0xe0,
-  0x05, 0x55, 0x55, 0x55, 0x55, 0x01, 0x03, 0x3f, 0x73, 0xff, 0xf7, 0xdf, 0x55, 0xf8, 0x36, 0x56, 0xff, 0xe0,
-  0x42, 0xaa, 0xaa, 0xaa, 0xaa, 0x80, 0x83, 0x3f, 0xfb, 0xff, 0xeb, 0xef, 0xab, 0xf0, 0x37, 0x1e, 0xe0, 0xe0,
-  0x61, 0x55, 0x55, 0x55, 0x55, 0x00, 0x03, 0xbf, 0xfb, 0xff, 0xf7, 0xdf, 0x77, 0xf0, 0x87, 0x48, 0xfa, 0xe0,
-  0x30, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x87, 0xbf, 0xfb, 0xfd, 0xef, 0xff, 0xbf, 0xe0, 0x08, 0x20, 0xe0, 0xe0,
-  0x38, 0x55, 0x55, 0x55, 0x55, 0x00, 0x47, 0xbf, 0xfd, 0xf8, 0xff, 0xdf, 0x7f, 0x60, 0x22, 0xf6, 0xff, 0xe0,
-  0x3c, 0x2a, 0xaa, 0xaa, 0xaa, 0x00, 0x0f, 0xbf, 0xef, 0xfd, 0xef, 0xff, 0xbe, 0x21, 0x08, 0x22, 0xe0, 0xe0,
-  0x7e, 0x15, 0x55, 0x55, 0x10, 0x02, 0x1f, 0xdf, 0xdf, 0x7f, 0xff, 0xdf, 0xff, 0x64, 0x10, 0x0a, 0xfc, 0xe0,
-  0x4f, 0x08, 0xaa, 0xaa, 0x80, 0x01, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0x6f, 0xbf, 0xe0, 0x08, 0x42, 0xe0, 0xe0,
-  0x08, 0x09, 0x15, 0x55, 0x50, 0x00, 0x7f, 0xff, 0xdf, 0xff, 0xf8, 0x7f, 0xff, 0xe5, 0x14, 0x18, 0xff, 0xe0,
-  0x09, 0xe9, 0x0a, 0xaa, 0xa8, 0x00, 0x6f, 0xfe, 0xfe, 0xff, 0xf6, 0xff, 0xbf, 0xe0, 0x08, 0x1c, 0xe0, 0xe0,
-  0x09, 0xe9, 0x75, 0x55, 0x50, 0x00, 0x6f, 0xfd, 0xdd, 0xff, 0xfe, 0xff, 0xdf, 0xf4, 0x14, 0x1c, 0xfc, 0xe0,
-  0x48, 0x09, 0x2a, 0xaa, 0xa8, 0x00, 0x6f, 0xfe, 0xee, 0xbf, 0xfe, 0x7d, 0xff, 0xf0, 0x08, 0x00, 0xe0, 0xe0,
-  0x48, 0x09, 0x15, 0x55, 0x54, 0x00, 0x67, 0xfd, 0x5d, 0x5f, 0xde, 0x78, 0xff, 0xfc, 0x04, 0x58, 0xff, 0xe0,
-  0x09, 0xe9, 0x0a, 0xaa, 0xa8, 0x00, 0xc7, 0xfe, 0xee, 0xaf, 0x86, 0x7d, 0xff, 0xfa, 0x08, 0x1a, 0xe0, 0xe0,
-  0x09, 0xe9, 0x75, 0x55, 0x50, 0x00, 0xcf, 0xfd, 0xdd, 0x57, 0x90, 0xbf, 0xff, 0xfc, 0x02, 0x00, 0xea, 0xe0,
-  0x48, 0x09, 0x2a, 0xaa, 0x20, 0x01, 0xcf, 0xff, 0xee, 0xbf, 0xf0, 0x3f, 0xfe, 0xfa, 0x08, 0x20, 0xee, 0xe0,
-  0x48, 0x09, 0x15, 0x54, 0x50, 0x00, 0xef, 0xfd, 0xd5, 0x5f, 0xea, 0x3f, 0xff, 0xf5, 0x00, 0x00, 0xff, 0xe0,
-  0x49, 0xe9, 0x00, 0x02, 0x40, 0x48, 0x6f, 0xfe, 0xee, 0xaf, 0xeb, 0x3f, 0xfe, 0xfb, 0xc0, 0x06, 0xe0, 0xe0,
-  0x09, 0xe9, 0x66, 0x32, 0x5b, 0x4b, 0x37, 0x7d, 0xdd, 0x5f, 0xe7, 0x1f, 0xdd, 0xff, 0xf0, 0x1e, 0xfa, 0xe0,
-  0x48, 0x09, 0x04, 0x02, 0x40, 0x48, 0x1f, 0xba, 0xee, 0xbf, 0xd7, 0x1f, 0xfe, 0xfb, 0xff, 0xfe, 0xe4, 0xe0,
-  0x48, 0x09, 0x01, 0x82, 0x4c, 0x48, 0x1f, 0x7d, 0xdd, 0x7d, 0xd7, 0x9f, 0xdd, 0x5f, 0xff, 0xfe, 0xff, 0xe0,
-  0x49, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xee, 0xfb, 0xd7, 0x8f, 0xfe, 0xaf, 0xff, 0xfa, 0xe0, 0xe0,
-  0x09, 0xe9, 0x1f, 0xfd, 0xbf, 0xb7, 0x0f, 0x7d, 0xfd, 0x7f, 0xd7, 0x8f, 0xdd, 0x5f, 0xff, 0xfe, 0xea, 0xe0,
-  0x49, 0xe9, 0x60, 0x0d, 0xa4, 0xb4, 0x07, 0xff, 0xee, 0xfb, 0xd7, 0x8f, 0xea, 0xaf, 0xfb, 0xfa, 0xe4, 0xe0,
-  0x49, 0xe9, 0x02, 0x05, 0xbf, 0xb4, 0x07, 0x7d, 0xff, 0x7f, 0xd7, 0xc7, 0xdd, 0x5f, 0xfd, 0xf6, 0xff, 0xe0,
-  0x49, 0xe9, 0x06, 0x0d, 0xb3, 0xb4, 0x07, 0xff, 0xee, 0xfb, 0xdb, 0xc7, 0xfe, 0xbf, 0xfb, 0xfa, 0xe0, 0xe0,
-  0x48, 0x09, 0x0f, 0xff, 0xff, 0xff, 0x07, 0xff, 0xf7, 0x7d, 0xdb, 0xc7, 0xdd, 0x57, 0xff, 0xf4, 0xea, 0xe0,
-  0x48, 0x09, 0x7e, 0xab, 0xaa, 0x32, 0x07, 0xff, 0xff, 0xbb, 0xdb, 0xc7, 0xfa, 0xaa, 0xfa, 0xfa, 0xee, 0xe0,
-  0x49, 0xe9, 0x3d, 0x55, 0x54, 0x05, 0x07, 0x7f, 0xff, 0xfd, 0xdb, 0xe7, 0xdd, 0x55, 0x75, 0x74, 0xff, 0xe0,
-  0x49, 0xe9, 0x1a, 0xaa, 0xaa, 0x02, 0x06, 0xff, 0xff, 0xfa, 0xdd, 0xe3, 0xfa, 0xaa, 0xfa, 0xfa, 0xe0, 0xe0,
-  0x48, 0x09, 0x15, 0x55, 0x54, 0x05, 0x0e, 0xff, 0xff, 0xf5, 0xef, 0xe3, 0xdd, 0x55, 0x75, 0x76, 0xfa, 0xe0,
-  0x48, 0x09, 0x6a, 0xaa, 0xa8, 0x02, 0x8e, 0xff, 0xff, 0xfb, 0xff, 0xe3, 0xfa, 0xaa, 0xbb, 0xfa, 0xe0, 0xe0,
-  0x49, 0xe9, 0x55, 0x55, 0x54, 0x05, 0x5e, 0xff, 0xff, 0xf7, 0xfe, 0xc3, 0xfd, 0x55, 0x77, 0xfe, 0xff, 0xe0,
-  0x49, 0xe9, 0x0a, 0xaa, 0xa8, 0x0a, 0xbe, 0x7f, 0xf8, 0xfb, 0xff, 0x11, 0xfa, 0xaa, 0xbb, 0xfa, 0xe0, 0xe0,
-  0x48, 0x09, 0x15, 0x55, 0x50, 0x05, 0x5e, 0x7f, 0xe4, 0x75, 0xff, 0xb1, 0xdd, 0x55, 0x7d, 0xfe, 0xfc, 0xe0,
-  0x48, 0x09, 0x6a, 0xaa, 0x80, 0x0a, 0x8e, 0xfe, 0x00, 0x3b, 0xff, 0x71, 0xfe, 0xaa, 0xfb, 0xfb, 0x60, 0xe0,
-  0x49, 0xe9, 0x55, 0x55, 0x10, 0x05, 0x0e, 0xfe, 0x6f, 0x3f, 0xff, 0xe1, 0xdd, 0x75, 0x7f, 0xfd, 0x7f, 0xe0,
-  0x49, 0xe9, 0x0a, 0xaa, 0xa8, 0x02, 0x06, 0xde, 0x00, 0x3b, 0xff, 0xe8, 0xee, 0xba, 0xff, 0xff, 0xbf, 0xe0,
-  0x00, 0x00, 0x15, 0x55, 0x54, 0x05, 0x07, 0xbf, 0xe7, 0x7f, 0xef, 0xc8, 0xdd, 0x57, 0xff, 0xff, 0x4f, 0xe0,
-  0x37, 0xf6, 0xea, 0xaa, 0xaa, 0x02, 0x03, 0xbf, 0xf8, 0xff, 0xf1, 0x98, 0xee, 0xbf, 0xff, 0xdf, 0xb0, 0xa0,
-  0x37, 0x36, 0xf5, 0x55, 0x55, 0x04, 0x03, 0xbf, 0xff, 0xff, 0xfc, 0x38, 0xfd, 0x5f, 0xff, 0x8f, 0x7f, 0x80,
-  0x37, 0xf6, 0xaa, 0xaa, 0xaa, 0x82, 0x03, 0x3f, 0xff, 0xff, 0xec, 0x78, 0x7e, 0xbf, 0xff, 0xdf, 0xbf, 0x80,
-  0x7f, 0xf6, 0x95, 0x55, 0x55, 0x04, 0x03, 0x3f, 0xbf, 0xff, 0xf1, 0xfc, 0x7d, 0x5f, 0xff, 0xff, 0xff, 0x20,
-  0x3f, 0xf6, 0xea, 0xaa, 0xaa, 0x82, 0x02, 0x3f, 0x1f, 0xff, 0xff, 0xfc, 0x7e, 0xbf, 0xfb, 0xff, 0xbf, 0x20,
-  0x10, 0x36, 0xf5, 0x55, 0x55, 0x40, 0x02, 0x3f, 0xbf, 0xfd, 0xff, 0xfe, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x20,
-  0x30, 0x16, 0xaa, 0xaa, 0xaa, 0x82, 0x02, 0x2f, 0xff, 0xff, 0xfe, 0xfe, 0x3e, 0xff, 0xfb, 0xff, 0xfc, 0x60,
-  0x70, 0x16, 0x95, 0x55, 0x55, 0x41, 0x04, 0x23, 0xff, 0xdd, 0xfd, 0xff, 0x1f, 0xf7, 0xfd, 0xfb, 0xfc, 0x60,
-  0x70, 0x36, 0xea, 0xaa, 0xaa, 0xa8, 0x00, 0x21, 0xfb, 0xbe, 0xbf, 0xef, 0x1e, 0xef, 0xfb, 0xfb, 0xf8, 0xe0,
-  0x7f, 0xf6, 0xf5, 0x55, 0x55, 0x45, 0x00, 0x20, 0xf7, 0xbd, 0xdd, 0xf7, 0x8f, 0xf7, 0xf7, 0xf5, 0xf0, 0xe0,
-  0x77, 0xf6, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x10, 0xf7, 0xbf, 0xae, 0xef, 0x87, 0xeb, 0xfb, 0xf3, 0xe1, 0xe0,
-  0x76, 0x76, 0x95, 0x55, 0x55, 0x45, 0x50, 0x00, 0x77, 0x3d, 0xdd, 0x7f, 0xc7, 0xf7, 0xff, 0xef, 0xe3, 0xe0,
-  0x37, 0xff, 0xe2, 0xa8, 0xaa, 0x22, 0xa8, 0x00, 0x37, 0x3f, 0xbe, 0xef, 0xc3, 0xef, 0xfb, 0xed, 0xc7, 0xe0,
-  0x30, 0x00, 0x12, 0x04, 0x82, 0x55, 0x54, 0x00, 0x33, 0x3f, 0xfd, 0xdf, 0xe1, 0xf7, 0xfd, 0xec, 0x87, 0xe0,
-  0x04, 0xd1, 0x52, 0x34, 0xba, 0x42, 0xa8, 0x00, 0x33, 0x1f, 0xbf, 0xef, 0xf0, 0xff, 0xff, 0xdc, 0x0f, 0xe0,
-  0x5c, 0x19, 0x52, 0x04, 0xba, 0x41, 0x54, 0x00, 0x16, 0x0f, 0xdd, 0xd5, 0xf8, 0x7f, 0xbf, 0xd8, 0x1f, 0xe0,
-  0x55, 0x91, 0xd2, 0x64, 0x82, 0x40, 0x2a, 0x00, 0x16, 0x0f, 0xbe, 0xea, 0xfc, 0x3f, 0x1f, 0xc0, 0x3f, 0xe0,
-  0xb0, 0x35, 0x52, 0x04, 0x82, 0x40, 0x14, 0x00, 0x16, 0x0f, 0xfd, 0xd5, 0x7c, 0x1f, 0xbf, 0x80, 0xff, 0xd0,
-  0x93, 0x17, 0x12, 0xc4, 0xba, 0x40, 0x00, 0x00, 0x17, 0x09, 0xff, 0xea, 0xfe, 0x07, 0xfe, 0x03, 0xef, 0xd0,
-  0xc0, 0x05, 0x12, 0x04, 0xba, 0x40, 0x01, 0x40, 0x1f, 0x10, 0xfd, 0xd5, 0x7f, 0x00, 0x78, 0x0f, 0xff, 0xb0,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x1f, 0x00, 0x7e, 0xea, 0xff, 0x80, 0x00, 0x3f, 0xee, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam28 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam28_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM29
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM29
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM29 uint8_t hammerbeam29_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0xef, 0xff, 0xff, 0xf5, 0x55, 0x55, 0xff, 0xdf, 0xff, 0xff, 0x07, 0xff, 0xbe, 0x00, 0x01, 0xfe, 0x70,
-  0xde, 0xef, 0xff, 0xff, 0xfa, 0xaa, 0x8b, 0x9f, 0xef, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xb0,
-  0xa5, 0xef, 0xff, 0xff, 0xf5, 0x55, 0x77, 0x1f, 0xdf, 0x00, 0x00, 0x7f, 0xfe, 0x07, 0xf0, 0x01, 0xff, 0xd0,
-  0xa7, 0xef, 0xff, 0xff, 0xfa, 0xaa, 0xaf, 0xff, 0xe0, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x3c, 0x3e, 0xe0, 0xd0,
-  0x65, 0xef, 0xff, 0xff, 0xf5, 0x55, 0x40, 0x00, 0x00, 0xf0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x06, 0xfb, 0xe0,
-  0x66, 0xaf, 0xff, 0xff, 0xfa, 0xaa, 0x80, 0x00, 0x7f, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x7d, 0xcf, 0xff, 0xff, 0x55, 0x55, 0x40, 0x7f, 0xfe, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
-  0x7f, 0xe0, 0x1f, 0xff, 0xaa, 0xaa, 0x8f, 0xbf, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0,
-  0x74, 0xcf, 0x1f, 0xff, 0x55, 0x55, 0x5f, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xe0,
-  0x2c, 0xa9, 0x1f, 0xff, 0xaa, 0xaa, 0x9f, 0x3f, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0xe0, 0xe0,
-  0x74, 0xc9, 0x1f, 0xff, 0x55, 0x55, 0x3b, 0x3e, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xe0,
-  0x7c, 0xef, 0x1f, 0xfa, 0xaa, 0xaa, 0xbe, 0x38, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0xe0, 0xe0,
-  0x74, 0x8d, 0xcf, 0xf5, 0x55, 0x55, 0x7e, 0x60, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xfc, 0xe0,
-  0x6f, 0x8b, 0x0f, 0xfa, 0xaa, 0xaa, 0xf1, 0x80, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe0, 0xe0,
-  0x75, 0x8d, 0x07, 0xf5, 0x55, 0x54, 0xe6, 0x00, 0x00, 0xfe, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0xff, 0xe0,
-  0x00, 0x0b, 0x07, 0xff, 0xaa, 0xab, 0xc8, 0x00, 0x03, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xe0, 0xe0,
-  0x13, 0xcd, 0x03, 0xff, 0xd5, 0x55, 0xd0, 0x00, 0x0f, 0x84, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0xe0,
-  0x72, 0x4f, 0x03, 0xff, 0xaa, 0xa9, 0xb0, 0x00, 0x3e, 0x18, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xe0,
-  0x52, 0x49, 0xd1, 0xff, 0xd5, 0x01, 0x20, 0x00, 0xf8, 0x63, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xe0,
-  0x32, 0x49, 0x91, 0xff, 0xaa, 0x82, 0x60, 0x01, 0xe1, 0x8f, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xfe, 0xe0, 0xe0,
-  0x5e, 0x79, 0x58, 0xff, 0xd4, 0x02, 0xc0, 0x07, 0x86, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xea, 0xe0,
-  0x3a, 0x69, 0x88, 0xff, 0xa8, 0x82, 0x80, 0x0f, 0x18, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xfe, 0xee, 0xe0,
-  0x57, 0xd9, 0x54, 0x7f, 0xd5, 0x43, 0x80, 0x1c, 0x21, 0xff, 0xff, 0x81, 0xf1, 0xff, 0xc0, 0xfe, 0xff, 0xe0,
-  0x3a, 0x6f, 0x88, 0x7f, 0xaa, 0xa3, 0x00, 0x38, 0x47, 0xff, 0xf8, 0x7f, 0xfb, 0xff, 0xe0, 0x02, 0xe0, 0xe0,
-  0x76, 0x59, 0xd4, 0x3f, 0xd5, 0x43, 0x00, 0x70, 0x8f, 0xff, 0xc7, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfa, 0xe0,
-  0x3a, 0x69, 0x0a, 0x3f, 0xfa, 0xa6, 0x00, 0xe1, 0x1f, 0xff, 0x3e, 0xff, 0xff, 0xf0, 0x1f, 0xfc, 0xe4, 0xe0,
-  0x5e, 0x59, 0x09, 0x1f, 0xf5, 0x46, 0x00, 0xc2, 0x3f, 0x3c, 0xfc, 0x7e, 0x00, 0x01, 0xfb, 0x02, 0xff, 0xe0,
-  0x32, 0x79, 0x0a, 0x9f, 0xfa, 0xa4, 0x01, 0xc2, 0x3f, 0x33, 0xbe, 0xf0, 0x7f, 0x07, 0x1e, 0x00, 0xe0, 0xe0,
-  0x53, 0xc9, 0x0a, 0x4f, 0xf5, 0x40, 0x03, 0x84, 0x7f, 0xef, 0xff, 0xff, 0xfe, 0x3d, 0xc4, 0x70, 0xea, 0xe0,
-  0x33, 0xc9, 0xca, 0xaf, 0xfa, 0x80, 0x03, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xfc, 0x7f, 0x0c, 0xf8, 0xe4, 0xe0,
-  0x73, 0xcf, 0x4a, 0x97, 0xf5, 0x00, 0x07, 0x04, 0xff, 0xbf, 0xfd, 0xff, 0xf0, 0x58, 0x08, 0x68, 0xff, 0xe0,
-  0x73, 0xc9, 0x8a, 0xab, 0xfa, 0x00, 0x06, 0x09, 0xff, 0x7f, 0xfb, 0xff, 0xe0, 0xf0, 0x19, 0x9c, 0xe0, 0xe0,
-  0x7f, 0xc9, 0x4a, 0xaf, 0xf5, 0x00, 0x0e, 0x09, 0xfe, 0xfb, 0xf5, 0xff, 0xc0, 0xc0, 0x79, 0x9c, 0xea, 0xe0,
-  0x7b, 0xc9, 0x8a, 0xaf, 0xfa, 0x00, 0x1c, 0x01, 0xf6, 0xff, 0xef, 0xff, 0x81, 0x87, 0xe9, 0xaa, 0xee, 0xe0,
-  0x76, 0x49, 0xca, 0xaf, 0xf4, 0x41, 0xf8, 0x01, 0xe2, 0xff, 0xef, 0xff, 0x13, 0x0f, 0x89, 0xee, 0xff, 0xe0,
-  0x7a, 0x79, 0x0a, 0xaf, 0xfa, 0xaf, 0xf1, 0x01, 0xf6, 0xff, 0xef, 0xff, 0x23, 0x1e, 0x09, 0xec, 0xe0, 0xe0,
-  0x76, 0x59, 0x0a, 0xaf, 0xd5, 0x50, 0x18, 0xc1, 0xfe, 0xff, 0xf7, 0xee, 0x66, 0x3f, 0x18, 0xd0, 0xfa, 0xe0,
-  0x1a, 0x69, 0x0a, 0xaf, 0xaa, 0xa8, 0x0c, 0x21, 0xff, 0x7f, 0xfb, 0xfc, 0xc6, 0xe1, 0xfc, 0xbe, 0xe0, 0xe0,
-  0x16, 0x5f, 0x0a, 0xa3, 0xd5, 0x50, 0x04, 0x11, 0xff, 0xbf, 0x3d, 0xf8, 0xc7, 0x80, 0x74, 0x32, 0xff, 0xe0,
-  0x1b, 0xef, 0x0a, 0x87, 0xaa, 0xa8, 0x06, 0x10, 0xff, 0xdf, 0x3f, 0xf9, 0x86, 0x04, 0x1e, 0x1e, 0xe0, 0xe0,
-  0x17, 0x5f, 0xca, 0x8f, 0xd5, 0x50, 0x03, 0x08, 0xef, 0xef, 0xfb, 0xf3, 0x8c, 0x3f, 0x0f, 0x0e, 0xfc, 0xe0,
-  0x1e, 0xff, 0x0a, 0x0f, 0xaa, 0xa8, 0x03, 0x84, 0x71, 0xf7, 0xff, 0xf1, 0x98, 0xe7, 0x05, 0x80, 0x60, 0xe0,
-  0x13, 0x4f, 0x0a, 0x1f, 0xd5, 0x50, 0x01, 0xc2, 0x38, 0x7f, 0xff, 0xe3, 0x00, 0x00, 0xe7, 0xe0, 0x7f, 0xe0,
-  0x12, 0xcf, 0x08, 0x3f, 0xaa, 0xb8, 0x00, 0xc1, 0x3e, 0x3f, 0xff, 0xe7, 0x31, 0x80, 0x73, 0xbf, 0xbf, 0xe0,
-  0x73, 0x4f, 0x08, 0x7f, 0xd5, 0x5f, 0x00, 0xe1, 0x1f, 0x1f, 0xdf, 0xe7, 0x33, 0x38, 0x31, 0xf4, 0xcf, 0xe0,
-  0x33, 0xc9, 0x00, 0xbf, 0xfe, 0xaf, 0xc0, 0x70, 0x8f, 0xcf, 0x8b, 0xce, 0x63, 0x6e, 0x1b, 0xec, 0x70, 0xa0,
-  0x5e, 0x49, 0xc1, 0x7f, 0xfd, 0x57, 0xe0, 0x38, 0x47, 0xe7, 0xdf, 0xcc, 0x63, 0x7f, 0x3e, 0x0f, 0xe1, 0xc0,
-  0x02, 0x49, 0x86, 0xff, 0xfe, 0xab, 0xf0, 0x1c, 0x21, 0xf3, 0xff, 0xc8, 0xe3, 0xb3, 0x20, 0x03, 0x87, 0x00,
-  0x62, 0x79, 0x4d, 0xff, 0xfd, 0x55, 0xe8, 0x0f, 0x18, 0xff, 0xfd, 0xc9, 0xe3, 0xeb, 0xc0, 0x00, 0x3e, 0x00,
-  0x22, 0x69, 0x9a, 0xff, 0xfe, 0xab, 0xc4, 0x07, 0x86, 0x3f, 0xff, 0x91, 0xa1, 0xa7, 0x03, 0xc0, 0xf8, 0x00,
-  0x00, 0x59, 0x55, 0xff, 0xfd, 0x55, 0xc4, 0x01, 0xe1, 0x8f, 0xff, 0x81, 0x31, 0xfe, 0x0f, 0xff, 0xe1, 0x00,
-  0x2c, 0x6f, 0x9b, 0xff, 0xfe, 0xaa, 0xc2, 0x00, 0xf8, 0x43, 0xff, 0x83, 0x70, 0xfc, 0x1f, 0xff, 0x86, 0x00,
-  0x20, 0x00, 0x03, 0xfc, 0x7d, 0x55, 0x91, 0x00, 0x3e, 0x00, 0x7f, 0xff, 0xd8, 0x30, 0x7f, 0xfc, 0x38, 0x60,
-  0x28, 0xaa, 0xa8, 0xf8, 0xfe, 0xaa, 0x91, 0x80, 0x0f, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc1, 0xe0,
-  0x2b, 0x00, 0x82, 0x05, 0x7d, 0x55, 0x98, 0xc0, 0x03, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x0e, 0x0f, 0xc0,
-  0x2b, 0xdd, 0xb8, 0xaf, 0xfe, 0xaa, 0x98, 0xf0, 0x00, 0xfe, 0x00, 0x01, 0xff, 0xff, 0x00, 0xf0, 0x7f, 0x00,
-  0x2b, 0xff, 0xff, 0xff, 0x7d, 0x55, 0x78, 0xcc, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0x07, 0xf8, 0x00,
-  0x01, 0x55, 0x4f, 0xff, 0xfe, 0xaa, 0x1c, 0x62, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00,
-  0x7d, 0x55, 0x5f, 0xff, 0x7d, 0x54, 0x0c, 0x31, 0x80, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x00,
-  0x01, 0x55, 0x5f, 0xff, 0xea, 0xaa, 0x06, 0x1c, 0x60, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x71, 0x55, 0x03, 0xff, 0x75, 0x54, 0x03, 0x1f, 0x58, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x60,
-  0x29, 0x55, 0x28, 0xff, 0xea, 0xab, 0xf8, 0x8f, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0,
-  0xb1, 0x55, 0x22, 0x07, 0x75, 0x57, 0xe6, 0x67, 0xcf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xd0,
-  0xa9, 0x55, 0xe8, 0xaf, 0xea, 0xaf, 0xe3, 0x1f, 0x8e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x10,
-  0xd9, 0x55, 0xff, 0xff, 0x75, 0xdf, 0xff, 0xc1, 0xed, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0xe1, 0x57, 0xff, 0xff, 0xea, 0x80, 0x00, 0x00, 0x1f, 0xfb, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam29 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam29_map,
-};
-
-
-#ifndef LV_ATTRIBUTE_IMG_HAMMERBEAM30
-#define LV_ATTRIBUTE_IMG_HAMMERBEAM30
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_HAMMERBEAM30 uint8_t hammerbeam30_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-        0xff, 0xff, 0xff, 0xff, /*Color of index 0*/
-        0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-#else
-        0x00, 0x00, 0x00, 0xff, /*Color of index 0*/
-        0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
-#endif
-
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-  0xe5, 0x7e, 0x07, 0xc1, 0xe0, 0x16, 0x04, 0x15, 0x5f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x05, 0x56, 0x00, 0x70,
-  0xca, 0xbe, 0x0b, 0xc0, 0xe0, 0x2f, 0x0a, 0x0a, 0xaf, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0a, 0xaf, 0x00, 0x30,
-  0x95, 0x7c, 0x15, 0xe0, 0x60, 0x57, 0x05, 0x15, 0x57, 0xff, 0xff, 0xfe, 0x00, 0x40, 0x05, 0x56, 0x00, 0x10,
-  0xaa, 0xbc, 0x0a, 0xf0, 0x60, 0x2b, 0x02, 0x8a, 0xab, 0xff, 0xff, 0xfe, 0x01, 0xe0, 0x0a, 0xaf, 0x1f, 0x10,
-  0x55, 0x7c, 0x15, 0xf8, 0x00, 0x57, 0x05, 0x45, 0x55, 0xff, 0xff, 0xfc, 0x05, 0xf0, 0x15, 0x5f, 0x04, 0x00,
-  0x2a, 0xf8, 0x2a, 0xfc, 0x00, 0xab, 0x02, 0xa2, 0xaa, 0xff, 0xff, 0xfc, 0x0a, 0xfc, 0x0a, 0xaf, 0x1f, 0x00,
-  0x55, 0x78, 0x15, 0x5c, 0x00, 0x57, 0x81, 0x51, 0x55, 0x7f, 0xff, 0xfc, 0x15, 0x7e, 0x05, 0x5f, 0x00, 0x00,
-  0x2a, 0xfc, 0x0a, 0xbc, 0x00, 0xab, 0x82, 0xa8, 0xaa, 0xbf, 0xff, 0xfc, 0x2a, 0xbf, 0x02, 0xaf, 0x1f, 0x00,
-  0x55, 0x7e, 0x05, 0x58, 0x01, 0x57, 0x81, 0x55, 0x55, 0x5f, 0xff, 0xfc, 0x15, 0x5f, 0x05, 0x5f, 0x05, 0x00,
-  0x2a, 0xbf, 0x82, 0xb8, 0x00, 0xab, 0x82, 0xaa, 0xaa, 0xbf, 0xff, 0xfc, 0x2a, 0xaf, 0x02, 0xbf, 0x1f, 0x00,
-  0x55, 0x57, 0xc1, 0x78, 0x01, 0x57, 0x81, 0x55, 0x55, 0x5f, 0xff, 0xf8, 0x55, 0x57, 0x05, 0x5d, 0x00, 0x00,
-  0x2a, 0xab, 0xe0, 0xb8, 0x40, 0xab, 0x80, 0xaa, 0xaa, 0xaf, 0xff, 0xf8, 0x2a, 0xaf, 0x82, 0xbd, 0x1f, 0x00,
-  0x55, 0x55, 0xe1, 0x70, 0x60, 0x57, 0xc1, 0x55, 0x55, 0x57, 0xff, 0xf8, 0x55, 0x57, 0x81, 0x79, 0x03, 0x00,
-  0x2a, 0xab, 0xf0, 0xf0, 0xe0, 0xab, 0xc0, 0xaa, 0xaa, 0xaf, 0xff, 0xf8, 0x2a, 0xab, 0x82, 0xf9, 0x1f, 0x00,
-  0x15, 0x55, 0xf0, 0xe0, 0xf0, 0x55, 0xe0, 0x55, 0x55, 0x57, 0xff, 0xf8, 0x55, 0x57, 0x81, 0xf1, 0x00, 0x00,
-  0x2a, 0xaa, 0xf8, 0x60, 0xf0, 0xab, 0xe0, 0x2a, 0xaa, 0xab, 0xff, 0xf0, 0x2a, 0xab, 0x82, 0xe1, 0x1f, 0x00,
-  0x15, 0x55, 0x78, 0x41, 0xe0, 0x55, 0xf0, 0x55, 0x55, 0x55, 0xff, 0xf0, 0x55, 0x57, 0x81, 0xc1, 0x03, 0x00,
-  0x0a, 0xaa, 0xf8, 0x42, 0xe0, 0xab, 0xf0, 0x2a, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xab, 0x83, 0x81, 0x1f, 0x00,
-  0x15, 0x55, 0x7c, 0x01, 0xc0, 0x55, 0xf0, 0x55, 0x55, 0x55, 0xff, 0xf0, 0x55, 0x55, 0x83, 0x81, 0x00, 0x00,
-  0x0a, 0xaa, 0xbc, 0x03, 0xc0, 0xab, 0xf0, 0x2a, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xab, 0xc3, 0x03, 0x1f, 0x00,
-  0x15, 0x55, 0x7e, 0x05, 0x81, 0x57, 0xe0, 0x55, 0x55, 0x55, 0xff, 0xf0, 0x55, 0x55, 0xc2, 0x05, 0x15, 0x00,
-  0x0a, 0xaa, 0xbe, 0x02, 0x02, 0xab, 0xe0, 0xaa, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xab, 0xc0, 0x0b, 0x11, 0x00,
-  0x05, 0x55, 0x5e, 0x00, 0x01, 0x57, 0xe0, 0x55, 0x55, 0x55, 0xff, 0xf0, 0x55, 0x55, 0xc0, 0x15, 0x00, 0x00,
-  0x02, 0xaa, 0xaf, 0x00, 0x00, 0xaf, 0xe0, 0xaa, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xab, 0xc0, 0x2b, 0x1f, 0x00,
-  0x05, 0x55, 0x5f, 0x00, 0x60, 0x57, 0xc0, 0x55, 0x55, 0x57, 0xff, 0xf0, 0x55, 0x57, 0xc0, 0x55, 0x05, 0x00,
-  0x02, 0xaa, 0xaf, 0x82, 0xf0, 0x2f, 0xc0, 0xaa, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xaf, 0x80, 0xab, 0x1b, 0x00,
-  0x01, 0x55, 0x57, 0x85, 0x78, 0x1f, 0xc0, 0x55, 0x55, 0x57, 0xff, 0xf0, 0x55, 0x5f, 0x81, 0x55, 0x00, 0x00,
-  0x00, 0xaa, 0xaf, 0x8a, 0xbc, 0x0f, 0xc0, 0xaa, 0xaa, 0xab, 0xff, 0xf0, 0xaa, 0xbf, 0x02, 0xab, 0x1f, 0x00,
-  0x00, 0x55, 0x57, 0x85, 0x7e, 0x0f, 0x81, 0x55, 0x55, 0x57, 0xff, 0xf0, 0x55, 0x5f, 0x01, 0x55, 0x15, 0x00,
-  0x00, 0xaa, 0xaf, 0x82, 0xbf, 0x0f, 0x00, 0xaa, 0xaa, 0xab, 0xff, 0xe0, 0xaa, 0xbe, 0x02, 0xab, 0x1b, 0x00,
-  0x00, 0x55, 0x57, 0xc5, 0x5f, 0x04, 0x01, 0x55, 0x55, 0x57, 0xff, 0xe0, 0x55, 0x7e, 0x05, 0x55, 0x00, 0x00,
-  0x00, 0x2a, 0xaf, 0xc2, 0xaf, 0x00, 0x02, 0xaa, 0xaa, 0xaf, 0xff, 0xe0, 0x02, 0xbe, 0x0a, 0xab, 0x1f, 0x00,
-  0x00, 0x55, 0x57, 0xc1, 0x5f, 0x00, 0x05, 0x55, 0x55, 0x5f, 0xff, 0xe0, 0x01, 0x7c, 0x15, 0x55, 0x15, 0x00,
-  0x00, 0x2a, 0xab, 0xc2, 0xaf, 0x00, 0x0a, 0xaa, 0xaa, 0xaf, 0xff, 0xc0, 0x00, 0xbc, 0x0a, 0xab, 0x11, 0x00,
-  0x00, 0x15, 0x57, 0xc1, 0x5f, 0x00, 0x15, 0x55, 0x55, 0x5f, 0xff, 0xc0, 0x01, 0x78, 0x15, 0x55, 0x00, 0x00,
-  0x00, 0x2a, 0xab, 0xc2, 0xae, 0x00, 0x2a, 0xaa, 0xaa, 0xbf, 0xff, 0xc0, 0x00, 0xe0, 0x2a, 0xab, 0x1f, 0x00,
-  0x00, 0x15, 0x57, 0xc1, 0x5e, 0x00, 0x55, 0x55, 0x55, 0x7f, 0xff, 0xc0, 0x60, 0x00, 0x15, 0x55, 0x05, 0x00,
-  0x00, 0x2a, 0xab, 0xe0, 0xae, 0x00, 0xaa, 0xaa, 0xaa, 0xbf, 0xff, 0x80, 0xf0, 0x00, 0x0a, 0xab, 0x1f, 0x00,
-  0x00, 0x15, 0x57, 0xe1, 0x5c, 0x01, 0x55, 0x55, 0x55, 0x7f, 0xff, 0x81, 0xf0, 0x00, 0x05, 0x55, 0x00, 0x00,
-  0x00, 0x0a, 0xab, 0xe0, 0xbc, 0x00, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0x02, 0xf8, 0x03, 0x0a, 0x8b, 0x1f, 0x00,
-  0x00, 0x15, 0x55, 0xe0, 0x58, 0x00, 0x55, 0x55, 0x55, 0x7f, 0xff, 0x05, 0x78, 0x17, 0x85, 0x15, 0x03, 0x00,
-  0x00, 0x0a, 0xab, 0xf0, 0x30, 0x00, 0xaa, 0xaa, 0xaa, 0xff, 0xfe, 0x02, 0xf8, 0x2b, 0xc2, 0x8a, 0x9f, 0x00,
-  0x00, 0x15, 0x55, 0xf0, 0x40, 0x00, 0x55, 0x55, 0x55, 0xff, 0xfe, 0x05, 0x7c, 0x55, 0xc5, 0x15, 0x80, 0x00,
-  0x00, 0x0a, 0xaa, 0xf8, 0x00, 0x20, 0x2a, 0xaa, 0xaa, 0xff, 0xfc, 0x0a, 0xbc, 0x2b, 0xe2, 0x2a, 0xc0, 0x00,
-  0x00, 0x05, 0x55, 0xfc, 0x00, 0xf0, 0x15, 0x55, 0x55, 0xff, 0xfc, 0x05, 0x7c, 0x15, 0xe0, 0x15, 0x70, 0x00,
-  0x00, 0x0a, 0xaa, 0xfc, 0x02, 0xf0, 0x2a, 0xaa, 0xaa, 0xff, 0xf8, 0x0a, 0xbc, 0x2b, 0xe0, 0x2a, 0xaf, 0x40,
-  0x00, 0x05, 0x55, 0x7e, 0x05, 0xf8, 0x15, 0x55, 0x55, 0xff, 0xf8, 0x15, 0x7c, 0x17, 0xc0, 0x55, 0x57, 0xe0,
-  0x00, 0x02, 0xaa, 0xbf, 0x02, 0xfc, 0x02, 0xaa, 0xaa, 0xff, 0xf0, 0x2a, 0xf8, 0x2f, 0xc0, 0x2a, 0xab, 0xe0,
-  0x00, 0x05, 0x55, 0x7f, 0x05, 0x7c, 0x00, 0x55, 0x55, 0x7f, 0xe0, 0x15, 0x78, 0x17, 0x80, 0x55, 0x57, 0xe0,
-  0x00, 0x02, 0xaa, 0xbf, 0x82, 0xf8, 0x00, 0xaa, 0xaa, 0xff, 0xc0, 0x2a, 0xf8, 0x0f, 0x00, 0xaa, 0xab, 0xe0,
-  0x00, 0x01, 0x55, 0x5f, 0x85, 0x78, 0x00, 0x55, 0x55, 0x7f, 0x80, 0x55, 0xf0, 0x0c, 0x01, 0x55, 0x55, 0xe0,
-  0x00, 0x02, 0xaa, 0xaf, 0x82, 0xf0, 0x00, 0x2a, 0xaa, 0xff, 0x00, 0xab, 0xf0, 0x00, 0x02, 0xaa, 0xab, 0xe0,
-  0x00, 0x01, 0x55, 0x5f, 0x81, 0xf0, 0x20, 0x05, 0x55, 0xfe, 0x01, 0x55, 0xe0, 0x00, 0x05, 0x55, 0x55, 0xe0,
-  0x00, 0x00, 0xaa, 0xaf, 0x82, 0xc0, 0x78, 0x02, 0xab, 0xfc, 0x02, 0xab, 0xe0, 0x80, 0x2a, 0xaa, 0xaa, 0xe0,
-  0x00, 0x01, 0x55, 0x57, 0xc1, 0x80, 0x7c, 0x01, 0x57, 0xf8, 0x01, 0x57, 0xc1, 0x50, 0x55, 0x55, 0x55, 0xe0,
-  0x00, 0x00, 0xaa, 0xaf, 0xc0, 0x00, 0xbe, 0x00, 0xab, 0xf0, 0x00, 0xaf, 0xc0, 0xaa, 0xaa, 0xaa, 0xaa, 0xe0,
-  0x00, 0x00, 0x55, 0x57, 0xc0, 0x01, 0x57, 0x80, 0x57, 0xe0, 0x00, 0x5f, 0x81, 0x55, 0x55, 0x55, 0x55, 0x60,
-  0x00, 0x00, 0xaa, 0xaf, 0xc0, 0x02, 0xab, 0x80, 0xaf, 0xc0, 0x00, 0x3f, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xe0,
-  0x00, 0x00, 0x55, 0x57, 0xc0, 0x01, 0x57, 0x01, 0x5f, 0x80, 0x00, 0x1c, 0x00, 0x55, 0x55, 0x55, 0x55, 0x60,
-  0x00, 0x00, 0xaa, 0xaf, 0xc0, 0x00, 0x2f, 0x02, 0xbf, 0x00, 0xc0, 0x08, 0x10, 0x2a, 0xaa, 0xaa, 0xaa, 0xe0,
-  0x00, 0x00, 0x55, 0x57, 0xc0, 0x00, 0x0e, 0x01, 0x5f, 0x01, 0xf8, 0x00, 0x78, 0x55, 0x55, 0x55, 0x55, 0x60,
-  0x00, 0x00, 0x2a, 0xab, 0xc0, 0x80, 0x06, 0x02, 0xbe, 0x02, 0xfc, 0x00, 0xb8, 0x2a, 0xaa, 0xaa, 0xaa, 0xa0,
-  0x80, 0x00, 0x55, 0x57, 0xc0, 0xe0, 0x04, 0x05, 0x7e, 0x05, 0x7e, 0x01, 0x58, 0x15, 0x55, 0x55, 0x55, 0x50,
-  0x80, 0x00, 0x2a, 0xab, 0xe0, 0xf8, 0x00, 0x0a, 0xbe, 0x0a, 0xaf, 0x02, 0xb8, 0x2a, 0xaa, 0xaa, 0xaa, 0x90,
-  0xc0, 0x00, 0x55, 0x57, 0xe0, 0x7e, 0x00, 0x15, 0x7c, 0x15, 0x57, 0x85, 0x50, 0x55, 0x55, 0x55, 0x55, 0x30,
-  0xe0, 0x00, 0x2a, 0xaf, 0xe0, 0x7f, 0x00, 0x2a, 0xfc, 0x0a, 0xaf, 0x82, 0xb0, 0x2a, 0xaa, 0xaa, 0xaa, 0x70,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0,
-};
-
-const lv_image_dsc_t hammerbeam30 = {
-  .header.magic = LV_IMAGE_HEADER_MAGIC,
-  .header.stride = 18,
-  .header.cf = LV_COLOR_FORMAT_I1,
-  .header.w = 140,
-  .header.h = 68,
-  .data_size = 1232,
-  .data = hammerbeam30_map,
-};
@@ -0,0 +1,40 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+#include <zephyr/kernel.h>
+
+#define ART_WIDTH 140
+#define ART_HEIGHT 68
+#define ART_STRIDE LV_DRAW_BUF_STRIDE(ART_WIDTH, LV_COLOR_FORMAT_I1)
+#define ART_FRAME_SIZE (ART_STRIDE * ART_HEIGHT)
+
+// Must match scripts/art_codec.py
+#define ART_LZSS_OFFSET_BITS 11
+#define ART_LZSS_LENGTH_BITS (16 - ART_LZSS_OFFSET_BITS)
+#define ART_LZSS_MIN_MATCH 3
+
+enum art_encoding {
+    ART_ENCODING_RAW,
+    ART_ENCODING_LZSS,
+};
+
+struct art_frame {
+    const uint8_t *data;
+    uint16_t size;
+    uint8_t encoding;
+};
+
+extern const struct art_frame art_frames[];
+extern const size_t art_frame_count;
+
+int art_decode_frame(const struct art_frame *frame, uint8_t *dst);
+
+int art_pack_open(void);
+int art_pack_decode_frame(size_t index, uint8_t *dst);
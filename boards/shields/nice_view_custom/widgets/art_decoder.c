@@ -0,0 +1,69 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "art.h"
+
+static int lzss_decode(const uint8_t *src, size_t size, uint8_t *dst, size_t dst_size) {
+    size_t in = 0;
+    size_t out = 0;
+
+    while (out < dst_size) {
+        if (in >= size) {
+            return -EINVAL;
+        }
+
+        uint8_t flags = src[in++];
+
+        for (uint8_t bit = 0x80; bit != 0 && out < dst_size; bit >>= 1) {
+            if (!(flags & bit)) {
+                if (in >= size) {
+                    return -EINVAL;
+                }
+                dst[out++] = src[in++];
+                continue;
+            }
+
+            if (in + 2 > size) {
+                return -EINVAL;
+            }
+
+            uint16_t ref = (src[in] << 8) | src[in + 1];
+            size_t offset = (ref >> ART_LZSS_LENGTH_BITS) + 1;
+            size_t len = (ref & BIT_MASK(ART_LZSS_LENGTH_BITS)) + ART_LZSS_MIN_MATCH;
+            in += 2;
+
+            if (offset > out || len > dst_size - out) {
+                return -EINVAL;
+            }
+
+            // Byte by byte, references may overlap what they produce
+            for (; len > 0; len--, out++) {
+                dst[out] = dst[out - offset];
+            }
+        }
+    }
+
+    return 0;
+}
+
+int art_decode_frame(const struct art_frame *frame, uint8_t *dst) {
+    switch (frame->encoding) {
+    case ART_ENCODING_RAW:
+        if (frame->size != ART_FRAME_SIZE) {
+            return -EINVAL;
+        }
+        memcpy(dst, frame->data, ART_FRAME_SIZE);
+        return 0;
+    case ART_ENCODING_LZSS:
+        return lzss_decode(frame->data, frame->size, dst, ART_FRAME_SIZE);
+    default:
+        return -ENOTSUP;
+    }
+}
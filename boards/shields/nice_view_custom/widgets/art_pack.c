@@ -0,0 +1,156 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "art.h"
+
+#if !FIXED_PARTITION_EXISTS(art_partition)
+#error "CONFIG_CUSTOM_ANIMATION_ART_PACK needs a fixed flash partition labelled art_partition"
+#endif
+
+// Must match scripts/gen_art.py
+#define ART_PACK_MAGIC "NVAP"
+#define ART_PACK_VERSION 1
+
+struct art_pack_header {
+    char magic[4];
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t frame_count;
+    uint16_t width;
+    uint16_t height;
+    uint32_t data_size;
+    uint32_t crc;
+} __packed;
+
+struct art_pack_entry {
+    uint32_t offset;
+    uint16_t size;
+    uint8_t encoding;
+    uint8_t reserved;
+} __packed;
+
+static const struct flash_area *pack_area;
+static uint16_t pack_frame_count;
+static off_t pack_data_start;
+static uint32_t pack_data_size;
+
+// Encoded frames are never larger than a raw one, so one frame fits here
+static uint8_t read_buf[ART_FRAME_SIZE];
+
+static int check_crc(off_t start, size_t size, uint32_t expected) {
+    uint32_t crc = 0;
+
+    for (size_t done = 0; done < size;) {
+        size_t len = MIN(size - done, sizeof(read_buf));
+        int ret = flash_area_read(pack_area, start + done, read_buf, len);
+        if (ret < 0) {
+            return ret;
+        }
+
+        crc = crc32_ieee_update(crc, read_buf, len);
+        done += len;
+    }
+
+    return crc == expected ? 0 : -EBADMSG;
+}
+
+/*
+ * Check the art pack in art_partition and return how many frames it has. Any
+ * problem with it is returned as an error, so the caller can fall back to the
+ * built-in frames.
+ */
+int art_pack_open(void) {
+    struct art_pack_header header;
+
+    int ret = flash_area_open(FIXED_PARTITION_ID(art_partition), &pack_area);
+    if (ret < 0) {
+        return ret;
+    }
+
+    ret = flash_area_read(pack_area, 0, &header, sizeof(header));
+    if (ret < 0) {
+        goto fail;
+    }
+
+    if (memcmp(header.magic, ART_PACK_MAGIC, sizeof(header.magic)) != 0) {
+        ret = -ENOENT;
+        goto fail;
+    }
+
+    uint16_t count = sys_le16_to_cpu(header.frame_count);
+    uint32_t data_size = sys_le32_to_cpu(header.data_size);
+    size_t table_size = count * sizeof(struct art_pack_entry);
+
+    // Each size is checked against the space left, as the sum of untrusted
+    // sizes could wrap
+    size_t space = pack_area->fa_size;
+    if (header.version != ART_PACK_VERSION || sys_le16_to_cpu(header.width) != ART_WIDTH ||
+        sys_le16_to_cpu(header.height) != ART_HEIGHT || count == 0 || space < sizeof(header) ||
+        table_size > space - sizeof(header) || data_size > space - sizeof(header) - table_size) {
+        LOG_WRN("Art pack does not fit this display or partition");
+        ret = -EINVAL;
+        goto fail;
+    }
+
+    ret = check_crc(sizeof(header), table_size + data_size, sys_le32_to_cpu(header.crc));
+    if (ret < 0) {
+        LOG_WRN("Art pack is corrupt (%d)", ret);
+        goto fail;
+    }
+
+    pack_frame_count = count;
+    pack_data_start = sizeof(header) + table_size;
+    pack_data_size = data_size;
+    return count;
+
+fail:
+    flash_area_close(pack_area);
+    pack_area = NULL;
+    return ret;
+}
+
+// Stream one encoded frame from flash and expand it into dst
+int art_pack_decode_frame(size_t index, uint8_t *dst) {
+    struct art_pack_entry entry;
+
+    if (pack_area == NULL || index >= pack_frame_count) {
+        return -ENOENT;
+    }
+
+    int ret = flash_area_read(pack_area, sizeof(struct art_pack_header) + index * sizeof(entry),
+                              &entry, sizeof(entry));
+    if (ret < 0) {
+        return ret;
+    }
+
+    struct art_frame frame = {
+        .data = read_buf,
+        .size = sys_le16_to_cpu(entry.size),
+        .encoding = entry.encoding,
+    };
+    uint32_t offset = sys_le32_to_cpu(entry.offset);
+
+    if (frame.size > sizeof(read_buf) || offset > pack_data_size ||
+        frame.size > pack_data_size - offset) {
+        return -EINVAL;
+    }
+
+    ret = flash_area_read(pack_area, pack_data_start + offset, read_buf, frame.size);
+    if (ret < 0) {
+        return ret;
+    }
+
+    return art_decode_frame(&frame, dst);
+}
@@ -0,0 +1,171 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <lvgl_mem.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "benchmark.h"
+#include "render_stats.h"
+
+enum bench_event {
+    BENCH_WPM,
+    BENCH_PROFILE,
+    BENCH_BATTERY,
+    BENCH_CHARGING,
+    BENCH_LAYER,
+};
+
+struct bench_step {
+    uint8_t event;
+    uint8_t value;
+};
+
+struct bench_trace {
+    const char *name;
+    const struct bench_step *steps;
+    size_t len;
+};
+
+#define WPM(v) {BENCH_WPM, v}
+#define PROFILE(v) {BENCH_PROFILE, v}
+#define BATTERY(v) {BENCH_BATTERY, v}
+#define CHARGING(v) {BENCH_CHARGING, v}
+#define LAYER(v) {BENCH_LAYER, v}
+
+// Recorded WPM reports from a typing burst that trails off to idle
+static const struct bench_step typing_steps[] = {
+    WPM(0),  WPM(8),  WPM(19), WPM(31), WPM(42), WPM(50), WPM(57), WPM(63),
+    WPM(66), WPM(70), WPM(71), WPM(74), WPM(72), WPM(75), WPM(78), WPM(77),
+    WPM(80), WPM(76), WPM(69), WPM(61), WPM(48), WPM(34), WPM(20), WPM(9),
+    WPM(0),  WPM(0),  WPM(0),  WPM(0),  WPM(0),  WPM(0),  WPM(0),  WPM(0),
+};
+
+static const struct bench_step profile_steps[] = {
+    PROFILE(1), PROFILE(2), PROFILE(3), PROFILE(4), PROFILE(0),
+    PROFILE(0), PROFILE(2), PROFILE(0),
+};
+
+static const struct bench_step battery_steps[] = {
+    BATTERY(100), BATTERY(99), BATTERY(99), BATTERY(98), BATTERY(97),
+    BATTERY(96),  CHARGING(1), BATTERY(97), BATTERY(98), CHARGING(0),
+};
+
+static const struct bench_step layer_steps[] = {
+    LAYER(1), LAYER(0), LAYER(2), LAYER(0), LAYER(1), LAYER(3), LAYER(1), LAYER(0),
+};
+
+static const struct bench_trace traces[] = {
+    {"typing", typing_steps, ARRAY_SIZE(typing_steps)},
+    {"profile", profile_steps, ARRAY_SIZE(profile_steps)},
+    {"battery", battery_steps, ARRAY_SIZE(battery_steps)},
+    {"layer", layer_steps, ARRAY_SIZE(layer_steps)},
+};
+
+static struct zmk_widget_status *bench_widget;
+
+// Stand in for the ZMK event listeners: update the state the same way they
+// would and report which sections went stale
+static uint8_t apply_step(struct status_state *state, const struct bench_step *step) {
+    switch (step->event) {
+    case BENCH_WPM:
+        sparkline_push(&state->wpm, step->value);
+        return SECTION_TOP;
+    case BENCH_PROFILE:
+        state->active_profile_index = step->value;
+        return SECTION_TOP | SECTION_MIDDLE;
+    case BENCH_BATTERY:
+        state->battery = step->value;
+        return SECTION_TOP;
+    case BENCH_CHARGING:
+        state->charging = step->value;
+        return SECTION_TOP;
+    case BENCH_LAYER:
+        state->layer_index = step->value;
+        return SECTION_BOTTOM;
+    default:
+        return 0;
+    }
+}
+
+// The port's lv_mem_monitor() leaves the free size unset, so read the sys_heap
+// behind the LVGL pool directly
+static uint32_t lvgl_heap_used(void) {
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.allocated_bytes;
+}
+
+static uint32_t lvgl_heap_max_used(void) {
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+    return stats.max_allocated_bytes;
+}
+
+static void report_trace(const struct bench_trace *trace, uint32_t elapsed, int32_t heap_delta) {
+    LOG_INF("bench %s: %d rounds of %zu events in %u us", trace->name,
+            CONFIG_NICE_VIEW_WIDGET_BENCHMARK_ROUNDS, trace->len, k_cyc_to_us_floor32(elapsed));
+
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        const struct render_stat *stat = &render_stats.stat[i];
+        if (stat->count == 0) {
+            continue;
+        }
+
+        LOG_INF("  %-6s %5u draws, cycles min %u mean %u max %u", render_stat_name(i), stat->count,
+                stat->min, (uint32_t)(stat->total / stat->count), stat->max);
+    }
+
+    LOG_INF("  flushed %u lines in %u writes (~%u SPI bytes, ~%u us on the bus), LVGL heap %+d "
+            "bytes",
+            render_stats.flushed_lines, render_stats.flushes, render_stats_flushed_bytes(),
+            render_stats_bus_time_us(), heap_delta);
+}
+
+/*
+ * Replay each trace against the live widget. Every event is drawn and flushed
+ * before the next one, so the counts are per event rather than coalesced.
+ */
+static void benchmark_work_cb(struct k_work *work) {
+    struct status_state saved = bench_widget->state;
+
+    for (size_t t = 0; t < ARRAY_SIZE(traces); t++) {
+        const struct bench_trace *trace = &traces[t];
+
+        render_stats_reset();
+        uint32_t heap_before = lvgl_heap_used();
+        uint32_t start = k_cycle_get_32();
+
+        for (int round = 0; round < CONFIG_NICE_VIEW_WIDGET_BENCHMARK_ROUNDS; round++) {
+            for (size_t i = 0; i < trace->len; i++) {
+                uint8_t sections = apply_step(&bench_widget->state, &trace->steps[i]);
+                zmk_widget_status_redraw(bench_widget, sections);
+                lv_refr_now(NULL);
+            }
+        }
+
+        report_trace(trace, k_cycle_get_32() - start, (int32_t)(lvgl_heap_used() - heap_before));
+    }
+
+    LOG_INF("bench LVGL heap high water mark %u bytes", lvgl_heap_max_used());
+
+    bench_widget->state = saved;
+    zmk_widget_status_redraw(bench_widget, SECTION_TOP | SECTION_MIDDLE | SECTION_BOTTOM);
+}
+
+static K_WORK_DELAYABLE_DEFINE(benchmark_work, benchmark_work_cb);
+
+void benchmark_start(struct zmk_widget_status *widget) {
+    bench_widget = widget;
+    render_stats_init();
+    k_work_schedule_for_queue(zmk_display_work_q(), &benchmark_work,
+                              K_MSEC(CONFIG_NICE_VIEW_WIDGET_BENCHMARK_DELAY));
+}
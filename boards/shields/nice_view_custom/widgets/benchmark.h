@@ -0,0 +1,12 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "status.h"
+
+void benchmark_start(struct zmk_widget_status *widget);
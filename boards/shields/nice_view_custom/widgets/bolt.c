@@ -9,31 +9,26 @@
 #endif
 
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_BOLT uint8_t bolt_map[] = {
-#if CONFIG_NICE_VIEW_WIDGET_INVERTED
-    0x00, 0x00, 0x00, 0x00, /*Color of index 0*/
-    0x00, 0x00, 0x00, 0xff, /*Color of index 1*/
-    0xff, 0xff, 0xff, 0xff, /*Color of index 2*/
-    0x00, 0x00, 0x00, 0x00, /*Color of index 3*/
-#else
+    /* Drawn in the normal colours; inversion is applied by the canvas palettes */
     0x00, 0x00, 0x00, 0x00, /*Color of index 0*/
     0xff, 0xff, 0xff, 0xff, /*Color of index 1*/
     0x00, 0x00, 0x00, 0xff, /*Color of index 2*/
     0x00, 0x00, 0x00, 0x00, /*Color of index 3*/
-#endif
 
-    0x00, 0x14, 0x00, 0x00, 0x64, 0x00, 0x00, 0x64, 0x00, 0x01, 0xa4, 0x00, 0x01, 0xa4,
-    0x00, 0x06, 0xa4, 0x00, 0x06, 0xa4, 0x00, 0x1a, 0xa5, 0x54, 0x1a, 0xaa, 0xa4, 0x6a,
-    0xaa, 0x90, 0x55, 0x6a, 0x90, 0x00, 0x6a, 0x40, 0x00, 0x6a, 0x40, 0x00, 0x69, 0x00,
-    0x00, 0x69, 0x00, 0x00, 0x64, 0x00, 0x00, 0x64, 0x00, 0x00, 0x50, 0x00,
+    /* Stored rotated 90 degrees clockwise, in display orientation */
+    0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x01, 0xa9, 0x40,
+    0x00, 0x00, 0x01, 0xaa, 0x94, 0x00, 0x55, 0x55, 0xaa, 0xa9, 0x40, 0x6a, 0xaa, 0xaa,
+    0xaa, 0x90, 0x16, 0xaa, 0xa5, 0x55, 0x50, 0x01, 0x6a, 0xa4, 0x00, 0x00, 0x00, 0x16,
+    0xa4, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
 };
 
 const lv_image_dsc_t bolt = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_I2,
     .header.flags = 0,
-    .header.w = 11,
-    .header.h = 18,
-    .header.stride = 3,
-    .data_size = 70,
+    .header.w = 18,
+    .header.h = 11,
+    .header.stride = 5,
+    .data_size = 71,
     .data = bolt_map,
 };
@@ -0,0 +1,237 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/display.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "compositor.h"
+#include "render_stats.h"
+#include "util.h"
+
+#define FB_WIDTH 160
+#define FB_HEIGHT CANVAS_SIZE
+#define FB_PITCH (FB_WIDTH / 8)
+#define MAX_SLOTS 4
+
+/*
+ * Sections still render into their canvases, but the canvases are hidden and
+ * their pixels are copied into one 1 bpp frame in the panel's own format,
+ * which goes to the display driver without LVGL composing a screen.
+ */
+struct slot {
+    lv_obj_t *canvas;
+    int32_t x;
+};
+
+static const struct device *display = DEVICE_DT_GET(DT_CHOSEN(zephyr_display));
+static uint8_t framebuffer[FB_PITCH * FB_HEIGHT];
+static struct slot slots[MAX_SLOTS];
+static size_t slot_count;
+
+static bool ready;
+static bool msb_first;
+// Bit value the panel shows as black
+static uint8_t dark_bit;
+static int dirty_y1 = FB_HEIGHT;
+static int dirty_y2 = -1;
+static bool lvgl_flushed;
+
+static void mark_rows(int y1, int y2) {
+    dirty_y1 = MIN(dirty_y1, y1);
+    dirty_y2 = MAX(dirty_y2, y2);
+}
+
+static void flush_start_cb(lv_event_t *e) { lvgl_flushed = true; }
+
+// Anything LVGL itself refreshed (the blank screen at start, say) is painted over
+static void refr_ready_cb(lv_event_t *e) {
+    if (lvgl_flushed) {
+        lvgl_flushed = false;
+        mark_rows(0, FB_HEIGHT - 1);
+        compositor_flush();
+    }
+}
+
+int compositor_init(void) {
+    if (!device_is_ready(display)) {
+        return -ENODEV;
+    }
+
+    struct display_capabilities caps;
+    display_get_capabilities(display, &caps);
+    if (caps.x_resolution != FB_WIDTH || caps.y_resolution != FB_HEIGHT ||
+        (caps.screen_info & SCREEN_INFO_MONO_VTILED)) {
+        LOG_ERR("Display layout not supported by the compositor");
+        return -ENOTSUP;
+    }
+
+    switch (caps.current_pixel_format) {
+    case PIXEL_FORMAT_MONO01:
+        dark_bit = 0;
+        break;
+    case PIXEL_FORMAT_MONO10:
+        dark_bit = 1;
+        break;
+    default:
+        LOG_ERR("Display pixel format %d not supported by the compositor",
+                caps.current_pixel_format);
+        return -ENOTSUP;
+    }
+
+    msb_first = caps.screen_info & SCREEN_INFO_MONO_MSB_FIRST;
+    // Start from the screen background, which is dark when inverted
+    memset(framebuffer, (display_inverted() ? dark_bit : !dark_bit) ? 0xFF : 0x00,
+           sizeof(framebuffer));
+
+    lv_display_t *disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(disp, refr_ready_cb, LV_EVENT_REFR_READY, NULL);
+
+    ready = true;
+    return 0;
+}
+
+static uint8_t reverse_bits(uint8_t b) {
+    b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+    b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+    return (b & 0xAA) >> 1 | (b & 0x55) << 1;
+}
+
+// Canvas bytes past either end of the row read as empty
+static uint8_t src_byte(const uint8_t *src, int32_t i) {
+    return i >= 0 && i < CANVAS_STRIDE ? src[i] : 0;
+}
+
+/*
+ * Copy canvas rows y1-y2 into the frame a byte at a time. Each frame byte
+ * takes 8 canvas pixels from two neighbouring canvas bytes, shifted by the
+ * slot's pixel offset, with the colour flipped by one XOR and the bit order
+ * reversed for LSB-first panels.
+ */
+static void blit_slot(const struct slot *slot, int y1, int y2) {
+    const uint8_t *pixels = lv_draw_buf_goto_xy(lv_canvas_get_draw_buf(slot->canvas), 0, 0);
+    // Canvas bit that maps to a set frame bit
+    uint8_t flip = (canvas_foreground_bit() ^ dark_bit ^ display_inverted()) ? 0xFF : 0x00;
+
+    // Columns that fall outside the frame are skipped
+    int32_t c1 = MAX(0, -slot->x);
+    int32_t c2 = MIN(CANVAS_SIZE, FB_WIDTH - slot->x);
+    int32_t b1 = (slot->x + c1) / 8;
+    int32_t b2 = (slot->x + c2 - 1) / 8;
+
+    for (int y = y1; y <= y2; y++) {
+        const uint8_t *src = pixels + y * CANVAS_STRIDE;
+        uint8_t *row = framebuffer + y * FB_PITCH;
+        bool changed = false;
+
+        for (int32_t b = b1; b <= b2; b++) {
+            // First canvas column of this frame byte, at least -7
+            int32_t c0 = b * 8 - slot->x;
+            int32_t i = (c0 + 8) / 8 - 1;
+            int shift = (c0 + 8) % 8;
+            uint16_t pair = (src_byte(src, i) << 8) | src_byte(src, i + 1);
+            uint8_t bits = (uint8_t)(pair >> (8 - shift)) ^ flip;
+
+            uint8_t mask = 0xFF;
+            if (c0 < c1) {
+                mask &= 0xFF >> (c1 - c0);
+            }
+            if (c0 + 8 > c2) {
+                mask &= 0xFF << (c0 + 8 - c2);
+            }
+
+            if (!msb_first) {
+                bits = reverse_bits(bits);
+                mask = reverse_bits(mask);
+            }
+
+            uint8_t value = (row[b] & ~mask) | (bits & mask);
+            if (value != row[b]) {
+                row[b] = value;
+                changed = true;
+            }
+        }
+
+        if (changed) {
+            mark_rows(y, y);
+        }
+    }
+}
+
+/*
+ * The canvas is taken off the LVGL screen and shown from the frame instead.
+ * Later blits only copy rows that a draw changed, so everything already on
+ * the canvas, such as its static background, is copied in here and the
+ * whole frame goes out with the next flush.
+ */
+void compositor_add(lv_obj_t *canvas, int32_t x) {
+    __ASSERT(slot_count < ARRAY_SIZE(slots), "Too many compositor slots");
+
+    struct slot *slot = &slots[slot_count++];
+    *slot = (struct slot){.canvas = canvas, .x = x};
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+
+    blit_slot(slot, 0, FB_HEIGHT - 1);
+    mark_rows(0, FB_HEIGHT - 1);
+}
+
+// Rows y1-y2 of the canvas changed; canvases without a slot are ignored
+void compositor_blit(lv_obj_t *canvas, int y1, int y2) {
+    if (!ready) {
+        return;
+    }
+
+    for (size_t i = 0; i < slot_count; i++) {
+        if (slots[i].canvas == canvas) {
+            blit_slot(&slots[i], y1, y2);
+            return;
+        }
+    }
+}
+
+// The LS0xx takes whole lines, so the changed rows go out as one band
+void compositor_flush(void) {
+    if (!ready || dirty_y2 < dirty_y1) {
+        return;
+    }
+
+    int rows = dirty_y2 - dirty_y1 + 1;
+    struct display_buffer_descriptor desc = {
+        .buf_size = rows * FB_PITCH,
+        .width = FB_WIDTH,
+        .height = rows,
+        .pitch = FB_WIDTH,
+    };
+
+    int ret;
+    RENDER_STAT_TIME(RENDER_STAT_FLUSH, ret = display_write(display, 0, dirty_y1, &desc,
+                                                            framebuffer + dirty_y1 * FB_PITCH));
+    if (ret < 0) {
+        LOG_ERR("Failed to write the status frame (%d)", ret);
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDER_STATS)
+    render_stats.flushes++;
+    render_stats.flushed_lines += rows;
+#endif
+
+    dirty_y1 = FB_HEIGHT;
+    dirty_y2 = -1;
+}
+
+// Copy every slot again, e.g. after the colours were inverted
+void compositor_refresh(void) {
+    for (size_t i = 0; i < slot_count; i++) {
+        compositor_blit(slots[i].canvas, 0, FB_HEIGHT - 1);
+    }
+    compositor_flush();
+}
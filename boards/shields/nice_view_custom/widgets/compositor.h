@@ -0,0 +1,16 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+int compositor_init(void);
+void compositor_add(lv_obj_t *canvas, int32_t x);
+void compositor_blit(lv_obj_t *canvas, int y1, int y2);
+void compositor_flush(void);
+void compositor_refresh(void);
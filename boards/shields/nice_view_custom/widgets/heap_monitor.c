@@ -0,0 +1,66 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <lvgl_mem.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include "heap_monitor.h"
+
+static size_t reported_max_used;
+static bool reported_low;
+
+/*
+ * The stats come from the Zephyr heap behind the LVGL pool, since the port's
+ * lv_mem_monitor() does not fill in the free size. A drop under the
+ * configured headroom is logged once, not on every skipped draw.
+ */
+static int check_free(const struct sys_memory_stats *stats, const char *when, const char *where) {
+    if (stats->free_bytes >= CONFIG_NICE_VIEW_WIDGET_HEAP_MIN_FREE) {
+        reported_low = false;
+        return 0;
+    }
+
+    if (!reported_low) {
+        reported_low = true;
+        LOG_ERR("LVGL heap down to %zu free bytes %s %s, %d required, skipping draws",
+                stats->free_bytes, when, where, CONFIG_NICE_VIEW_WIDGET_HEAP_MIN_FREE);
+    }
+    return -ENOMEM;
+}
+
+/*
+ * Called after init and after each kind of draw. Logs whenever the LVGL pool
+ * high water mark grows, naming the draw that raised it, so a session that
+ * exercises every screen shows the size LV_Z_MEM_POOL_SIZE actually needs.
+ */
+void heap_monitor_check(const char *where) {
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+
+    if (stats.max_allocated_bytes > reported_max_used) {
+        reported_max_used = stats.max_allocated_bytes;
+        LOG_INF("LVGL heap high water %zu of %zu bytes after %s", stats.max_allocated_bytes,
+                stats.free_bytes + stats.allocated_bytes, where);
+    }
+
+    check_free(&stats, "after", where);
+}
+
+/*
+ * Called before a draw. Returns -ENOMEM while the free space is under the
+ * configured headroom, so the caller skips the draw and retries it later
+ * instead of failing an allocation somewhere inside LVGL.
+ */
+int heap_monitor_headroom(const char *where) {
+    struct sys_memory_stats stats;
+    lvgl_heap_stats(&stats);
+
+    return check_free(&stats, "before", where);
+}
@@ -0,0 +1,23 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// How long a draw skipped for lack of LVGL heap waits before it is retried
+#define HEAP_MONITOR_RETRY_MS 1000
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HEAP_MONITOR)
+
+void heap_monitor_check(const char *where);
+int heap_monitor_headroom(const char *where);
+
+#else
+
+static inline void heap_monitor_check(const char *where) {}
+static inline int heap_monitor_headroom(const char *where) { return 0; }
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_HEAP_MONITOR) */
@@ -6,13 +6,14 @@
  */
 
 #include <zephyr/kernel.h>
-#include <zephyr/random/random.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #include <zmk/battery.h>
 #include <zmk/display.h>
+#include <zmk/activity.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/battery_state_changed.h>
@@ -22,71 +23,9 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/ble.h>
 
 #include "peripheral_status.h"
-
-LV_IMAGE_DECLARE(hammerbeam1);
-LV_IMAGE_DECLARE(hammerbeam2);
-LV_IMAGE_DECLARE(hammerbeam3);
-LV_IMAGE_DECLARE(hammerbeam4);
-LV_IMAGE_DECLARE(hammerbeam5);
-LV_IMAGE_DECLARE(hammerbeam6);
-LV_IMAGE_DECLARE(hammerbeam7);
-LV_IMAGE_DECLARE(hammerbeam8);
-LV_IMAGE_DECLARE(hammerbeam9);
-LV_IMAGE_DECLARE(hammerbeam10);
-LV_IMAGE_DECLARE(hammerbeam11);
-LV_IMAGE_DECLARE(hammerbeam12);
-LV_IMAGE_DECLARE(hammerbeam13);
-LV_IMAGE_DECLARE(hammerbeam14);
-LV_IMAGE_DECLARE(hammerbeam15);
-LV_IMAGE_DECLARE(hammerbeam16);
-LV_IMAGE_DECLARE(hammerbeam17);
-LV_IMAGE_DECLARE(hammerbeam18);
-LV_IMAGE_DECLARE(hammerbeam19);
-LV_IMAGE_DECLARE(hammerbeam20);
-LV_IMAGE_DECLARE(hammerbeam21);
-LV_IMAGE_DECLARE(hammerbeam22);
-LV_IMAGE_DECLARE(hammerbeam23);
-LV_IMAGE_DECLARE(hammerbeam24);
-LV_IMAGE_DECLARE(hammerbeam25);
-LV_IMAGE_DECLARE(hammerbeam26);
-LV_IMAGE_DECLARE(hammerbeam27);
-LV_IMAGE_DECLARE(hammerbeam28);
-LV_IMAGE_DECLARE(hammerbeam29);
-LV_IMAGE_DECLARE(hammerbeam30);
-
-const lv_image_dsc_t *anim_imgs[] = {
-    &hammerbeam1,
-    &hammerbeam2,
-    &hammerbeam3,
-    &hammerbeam4,
-    &hammerbeam5,
-    &hammerbeam6,
-    &hammerbeam7,
-    &hammerbeam8,
-    &hammerbeam9,
-    &hammerbeam10,
-    &hammerbeam11,
-    &hammerbeam12,
-    &hammerbeam13,
-    &hammerbeam14,
-    &hammerbeam15,
-    &hammerbeam16,
-    &hammerbeam17,
-    &hammerbeam18,
-    &hammerbeam19,
-    &hammerbeam20,
-    &hammerbeam21,
-    &hammerbeam22,
-    &hammerbeam23,
-    &hammerbeam24,
-    &hammerbeam25,
-    &hammerbeam26,
-    &hammerbeam27,
-    &hammerbeam28,
-    &hammerbeam29,
-    &hammerbeam30,
-};
-
+#include "heap_monitor.h"
+#include "render_stats.h"
+#include "slideshow.h"
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
@@ -94,32 +33,104 @@ struct peripheral_status_state {
     bool connected;
 };
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+// Child 0 is the slideshow
+static void draw_top_background(struct zmk_widget_status *widget) {
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 1);
+    clear_canvas(canvas);
+
     lv_layer_t layer;
     lv_canvas_init_layer(canvas, &layer);
+    draw_battery_outline(&layer);
+    lv_canvas_finish_layer(canvas, &layer);
 
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
+    save_canvas(canvas, widget->top_bg);
+    init_battery_sprites(canvas, widget->top_bg);
+}
+
+// Built once at init; draws only point them at new text
+static lv_draw_label_dsc_t output_label_dsc;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+static lv_draw_label_dsc_t snapshot_label_dsc;
+#endif
+
+static void init_draw_descriptors(void) {
+    init_label_dsc(&output_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16,
+                   LV_TEXT_ALIGN_RIGHT);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    init_label_dsc(&snapshot_label_dsc, LVGL_FOREGROUND, &lv_font_unscii_8,
+                   LV_TEXT_ALIGN_CENTER);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+// Mirrors the central's layer, WPM and battery below our own battery
+static void draw_snapshot(lv_obj_t *canvas, const struct split_snapshot *snapshot) {
+    lv_area_t layer_area = {0, 24, 67, 42};
+    draw_layer_label(canvas, snapshot->layer_index, NULL, &layer_area);
+
+    char wpm_text[8] = {};
+    snprintf(wpm_text, sizeof(wpm_text), "%d WPM", snapshot->wpm_bucket * SPLIT_SNAPSHOT_WPM_STEP);
+    snapshot_label_dsc.text = wpm_text;
+    lv_area_t wpm_area = {0, 46, 67, 54};
+    draw_rotated_label_uncached(canvas, &snapshot_label_dsc, &wpm_area);
+
+    char battery_text[9] = {};
+    snprintf(battery_text, sizeof(battery_text), "BAT %d%%",
+             snapshot->battery_bucket * SPLIT_SNAPSHOT_BATTERY_STEP);
+    snapshot_label_dsc.text = battery_text;
+    lv_area_t battery_area = {0, 57, 67, 65};
+    draw_rotated_label(canvas, &snapshot_label_dsc, &battery_area);
+}
+#endif
 
-    // Fill background
-    // lv_area_t bg_area = {0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1};
-    // lv_draw_rect(&layer, &rect_black_dsc, &bg_area);
+static void draw_top(struct zmk_widget_status *widget, const struct status_state *state) {
+    lv_obj_t *canvas = lv_obj_get_child(widget->obj, 1);
+    restore_canvas(canvas, widget->top_bg);
 
     // Draw battery
-    draw_battery(&layer, state);
+    draw_battery(canvas, state);
 
     // Draw output status
-    label_dsc.text = state->connected ? LV_SYMBOL_WIFI : LV_SYMBOL_CLOSE;
+    output_label_dsc.text = state->connected ? LV_SYMBOL_WIFI : LV_SYMBOL_CLOSE;
     lv_area_t text_area = {0, 0, CANVAS_SIZE - 1, 20};
-    lv_draw_label(&layer, &label_dsc, &text_area);
+    draw_rotated_label(canvas, &output_label_dsc, &text_area);
 
-    lv_canvas_finish_layer(canvas, &layer);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    if (state->snapshot_valid) {
+        draw_snapshot(canvas, &state->snapshot);
+    }
+#endif
+
+    invalidate_canvas_changes(canvas);
+}
+
+// While idle, state changes are only noted and drawn once activity resumes
+static void redraw_top(struct zmk_widget_status *widget) {
+    if (widget->suspended) {
+        widget->pending_redraw = true;
+        return;
+    }
+
+    // Short on LVGL heap, try again a little later
+    if (heap_monitor_headroom("top") != 0) {
+        widget->pending_redraw = true;
+        k_work_schedule_for_queue(zmk_display_work_q(), &widget->retry_work,
+                                  K_MSEC(HEAP_MONITOR_RETRY_MS));
+        return;
+    }
+
+    widget->pending_redraw = false;
+    RENDER_STAT_TIME(RENDER_STAT_TOP, draw_top(widget, &widget->state));
+    heap_monitor_check("top");
+}
 
-    // Rotate canvas
-    rotate_canvas(canvas, cbuf);
+static void retry_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_status *widget = CONTAINER_OF(dwork, struct zmk_widget_status, retry_work);
+
+    if (widget->pending_redraw) {
+        redraw_top(widget);
+    }
 }
 
 static void set_battery_status(struct zmk_widget_status *widget,
@@ -129,8 +140,9 @@ static void set_battery_status(struct zmk_widget_status *widget,
 #endif /* IS_ENABLED(CONFIG_USB_DEVICE_STACK) */
 
     widget->state.battery = state.level;
+    slideshow_set_battery(widget->state.battery, widget->state.charging);
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    redraw_top(widget);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -162,8 +174,14 @@ static struct peripheral_status_state get_state(const zmk_event_t *_eh) {
 static void set_connection_status(struct zmk_widget_status *widget,
                                   struct peripheral_status_state state) {
     widget->state.connected = state.connected;
-
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    // Drop the mirrored state rather than show it stale
+    if (!state.connected) {
+        widget->state.snapshot_valid = false;
+    }
+#endif
+
+    redraw_top(widget);
 }
 
 static void output_status_update_cb(struct peripheral_status_state state) {
@@ -175,27 +193,103 @@ ZMK_DISPLAY_WIDGET_LISTENER(widget_peripheral_status, struct peripheral_status_s
                             output_status_update_cb, get_state)
 ZMK_SUBSCRIPTION(widget_peripheral_status, zmk_split_peripheral_status_changed);
 
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+struct snapshot_status_state {
+    bool valid;
+    struct split_snapshot snapshot;
+};
+
+static void set_snapshot_status(struct zmk_widget_status *widget,
+                                const struct snapshot_status_state *state) {
+    if (!state->valid) {
+        return;
+    }
+
+    widget->state.snapshot_valid = true;
+    widget->state.snapshot = state->snapshot;
+
+    redraw_top(widget);
+}
+
+static void snapshot_status_update_cb(struct snapshot_status_state state) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_snapshot_status(widget, &state); }
+}
+
+static struct snapshot_status_state snapshot_status_get_state(const zmk_event_t *eh) {
+    const struct nice_view_snapshot_changed *ev = as_nice_view_snapshot_changed(eh);
+
+    return (struct snapshot_status_state){
+        .valid = ev != NULL,
+        .snapshot = ev != NULL ? ev->snapshot : (struct split_snapshot){},
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_snapshot_status, struct snapshot_status_state,
+                            snapshot_status_update_cb, snapshot_status_get_state)
+ZMK_SUBSCRIPTION(widget_snapshot_status, nice_view_snapshot_changed);
+#endif
+
+static void set_activity_status(struct zmk_widget_status *widget,
+                                struct activity_status_state state) {
+    if (!IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SUSPEND_ON_IDLE) ||
+        widget->suspended != state.active) {
+        return;
+    }
+
+    widget->suspended = !state.active;
+    if (widget->suspended) {
+        slideshow_suspend();
+        return;
+    }
+
+    slideshow_resume();
+    if (widget->pending_redraw) {
+        redraw_top(widget);
+    }
+}
+
+static void activity_status_update_cb(struct activity_status_state state) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_activity_status(widget, state); }
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    return (struct activity_status_state){
+        .active = zmk_activity_get_state() == ZMK_ACTIVITY_ACTIVE,
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
+
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, 160, 68);
+    init_draw_descriptors();
     
-    lv_obj_t * art = lv_animimg_create(widget->obj);
-    lv_obj_center(art);
-    lv_animimg_set_src(art, (const void **) anim_imgs, 30);
-    lv_animimg_set_duration(art, CONFIG_CUSTOM_ANIMATION_SPEED);
-    lv_animimg_set_repeat_count(art, LV_ANIM_REPEAT_INFINITE);
-    lv_animimg_start(art);
+    lv_obj_t *art = slideshow_create(widget->obj);
     lv_obj_align(art, LV_ALIGN_TOP_LEFT, 0, 0);
 
     lv_obj_t *top = lv_canvas_create(widget->obj);
     lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_NATIVE);
-    lv_canvas_set_palette(top, 0, LVGL_BACKGROUND_32);
-    lv_canvas_set_palette(top, 1, LVGL_FOREGROUND_32);
+    init_canvas(top, widget->cbuf);
+    init_label_canvas(widget->obj);
+    draw_top_background(widget);
+    k_work_init_delayable(&widget->retry_work, retry_work_cb);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILING)
+    render_stats_init();
+#endif
 
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_peripheral_status_init();
+    widget_activity_status_init();
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    widget_snapshot_status_init();
+#endif
+    heap_monitor_check("init");
 
     return 0;
 }
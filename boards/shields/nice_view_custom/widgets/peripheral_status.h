@@ -14,8 +14,12 @@
 struct zmk_widget_status {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[CANVAS_SIZE * CANVAS_SIZE];
+    uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_SIZE)] __aligned(LV_DRAW_BUF_ALIGN);
+    uint8_t top_bg[CANVAS_PIXELS_SIZE];
     struct status_state state;
+    bool suspended;
+    bool pending_redraw;
+    struct k_work_delayable retry_work;
 };
 
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent);
@@ -0,0 +1,175 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/shell/shell.h>
+#include <lvgl.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "render_stats.h"
+
+// An LS0xx write is a command byte, then per line an address byte, the pixel
+// data and a dummy byte, and a final dummy byte
+#define LS0XX_WRITE_OVERHEAD 2
+#define LS0XX_LINE_OVERHEAD 2
+
+// SPI clock of the panel; the LS011B7DH03 on the nice!view is rated for 1 MHz
+#if DT_HAS_CHOSEN(zephyr_display)
+#define DISPLAY_SPI_FREQUENCY DT_PROP_OR(DT_CHOSEN(zephyr_display), spi_max_frequency, 0)
+#else
+#define DISPLAY_SPI_FREQUENCY 0
+#endif
+
+struct render_stats render_stats;
+
+static bool initialized;
+static timing_t flush_start;
+
+static const char *const render_stat_names[RENDER_STAT_COUNT] = {
+    [RENDER_STAT_REDRAW] = "redraw",
+    [RENDER_STAT_TOP] = "top",
+    [RENDER_STAT_MIDDLE] = "middle",
+    [RENDER_STAT_BOTTOM] = "bottom",
+    [RENDER_STAT_LABEL] = "label",
+    [RENDER_STAT_FLUSH] = "flush",
+};
+
+static void flush_start_cb(lv_event_t *e) {
+    const lv_area_t *area = lv_event_get_param(e);
+
+    render_stats.flushes++;
+    render_stats.flushed_lines += lv_area_get_height(area);
+    flush_start = timing_counter_get();
+}
+
+static void flush_finish_cb(lv_event_t *e) { render_stat_end(RENDER_STAT_FLUSH, flush_start); }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILING) && CONFIG_NICE_VIEW_WIDGET_PROFILING_INTERVAL > 0
+#define PERIODIC_LOG 1
+#endif
+
+#ifdef PERIODIC_LOG
+static void log_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(log_work, log_work_cb);
+
+// Runs on the display work queue, like everything that updates the counters
+static void log_work_cb(struct k_work *work) {
+    render_stats_log();
+    k_work_schedule_for_queue(zmk_display_work_q(), &log_work,
+                              K_SECONDS(CONFIG_NICE_VIEW_WIDGET_PROFILING_INTERVAL));
+}
+#endif
+
+void render_stats_init(void) {
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+
+    timing_init();
+    timing_start();
+    render_stats_reset();
+
+    lv_display_t *display = lv_display_get_default();
+    lv_display_add_event_cb(display, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(display, flush_finish_cb, LV_EVENT_FLUSH_FINISH, NULL);
+
+#ifdef PERIODIC_LOG
+    k_work_schedule_for_queue(zmk_display_work_q(), &log_work,
+                              K_SECONDS(CONFIG_NICE_VIEW_WIDGET_PROFILING_INTERVAL));
+#endif
+}
+
+void render_stats_reset(void) {
+    memset(&render_stats, 0, sizeof(render_stats));
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        render_stats.stat[i].min = UINT32_MAX;
+    }
+}
+
+void render_stat_end(enum render_stat_id id, timing_t start) {
+    timing_t end = timing_counter_get();
+    uint32_t cycles = timing_cycles_get(&start, &end);
+    struct render_stat *stat = &render_stats.stat[id];
+
+    stat->count++;
+    stat->total += cycles;
+    stat->min = MIN(stat->min, cycles);
+    stat->max = MAX(stat->max, cycles);
+}
+
+const char *render_stat_name(enum render_stat_id id) { return render_stat_names[id]; }
+
+uint32_t render_stats_flushed_bytes(void) {
+    int32_t line_bytes = lv_display_get_horizontal_resolution(NULL) / 8 + LS0XX_LINE_OVERHEAD;
+
+    return render_stats.flushes * LS0XX_WRITE_OVERHEAD + render_stats.flushed_lines * line_bytes;
+}
+
+// Time the flushed bytes spend on the bus at the configured clock, 0 if unknown
+uint32_t render_stats_bus_time_us(void) {
+    if (DISPLAY_SPI_FREQUENCY == 0) {
+        return 0;
+    }
+
+    return (uint64_t)render_stats_flushed_bytes() * 8 * USEC_PER_SEC / DISPLAY_SPI_FREQUENCY;
+}
+
+static uint32_t cycles_to_us(uint64_t cycles) { return timing_cycles_to_ns(cycles) / 1000; }
+
+void render_stats_log(void) {
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        const struct render_stat *stat = &render_stats.stat[i];
+        if (stat->count == 0) {
+            continue;
+        }
+
+        LOG_DBG("render %-6s %5u runs, us min %u mean %u max %u", render_stat_names[i],
+                stat->count, cycles_to_us(stat->min), cycles_to_us(stat->total / stat->count),
+                cycles_to_us(stat->max));
+    }
+}
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILING) && IS_ENABLED(CONFIG_SHELL)
+static int cmd_stats_show(const struct shell *sh, size_t argc, char **argv) {
+    shell_print(sh, "%-6s %6s %8s %8s %8s", "path", "runs", "min us", "mean us", "max us");
+    for (int i = 0; i < RENDER_STAT_COUNT; i++) {
+        const struct render_stat *stat = &render_stats.stat[i];
+        if (stat->count == 0) {
+            shell_print(sh, "%-6s %6u", render_stat_names[i], 0);
+            continue;
+        }
+
+        shell_print(sh, "%-6s %6u %8u %8u %8u", render_stat_names[i], stat->count,
+                    cycles_to_us(stat->min), cycles_to_us(stat->total / stat->count),
+                    cycles_to_us(stat->max));
+    }
+    shell_print(sh, "flushed %u lines in %u writes (~%u SPI bytes, ~%u us on the bus)",
+                render_stats.flushed_lines, render_stats.flushes, render_stats_flushed_bytes(),
+                render_stats_bus_time_us());
+
+    return 0;
+}
+
+static int cmd_stats_reset(const struct shell *sh, size_t argc, char **argv) {
+    render_stats_reset();
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_nice_view_stats,
+                               SHELL_CMD(show, NULL, "Show render timings", cmd_stats_show),
+                               SHELL_CMD(reset, NULL, "Clear render timings", cmd_stats_reset),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(nice_view_stats, &sub_nice_view_stats, "nice!view widget render timings",
+                   NULL);
+#endif
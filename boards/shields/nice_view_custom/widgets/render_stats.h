@@ -0,0 +1,60 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+enum render_stat_id {
+    RENDER_STAT_REDRAW,
+    RENDER_STAT_TOP,
+    RENDER_STAT_MIDDLE,
+    RENDER_STAT_BOTTOM,
+    RENDER_STAT_LABEL,
+    RENDER_STAT_FLUSH,
+    RENDER_STAT_COUNT,
+};
+
+// Cycle counts of one render path, from the timing API (DWT on Cortex-M)
+struct render_stat {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+};
+
+struct render_stats {
+    struct render_stat stat[RENDER_STAT_COUNT];
+    uint32_t flushes;
+    uint32_t flushed_lines;
+};
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDER_STATS)
+
+extern struct render_stats render_stats;
+
+void render_stats_init(void);
+void render_stats_reset(void);
+void render_stat_end(enum render_stat_id id, timing_t start);
+const char *render_stat_name(enum render_stat_id id);
+uint32_t render_stats_flushed_bytes(void);
+uint32_t render_stats_bus_time_us(void);
+void render_stats_log(void);
+
+#define RENDER_STAT_TIME(id, expr)                                                                \
+    do {                                                                                          \
+        timing_t render_stat_start = timing_counter_get();                                        \
+        expr;                                                                                     \
+        render_stat_end(id, render_stat_start);                                                   \
+    } while (0)
+
+#else
+
+#define RENDER_STAT_TIME(id, expr) expr
+
+#endif /* IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_RENDER_STATS) */
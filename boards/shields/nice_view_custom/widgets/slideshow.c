@@ -0,0 +1,389 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/random/random.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/display.h>
+
+#include "art.h"
+#include "heap_monitor.h"
+#include "slideshow.h"
+#include "util.h"
+
+// How long to wait for a prefetch that has not finished at swap time
+#define PREFETCH_RETRY_MS 50
+
+// Ordered from fastest to slowest
+enum cadence {
+    CADENCE_NORMAL,
+    CADENCE_SLOW,
+    CADENCE_FROZEN,
+};
+
+enum prefetch_state {
+    PREFETCH_BUSY,
+    PREFETCH_READY,
+    PREFETCH_FAILED,
+};
+
+/*
+ * The image shows art_buf while the next frame is decoded into next_buf at
+ * low priority. A frame change then copies over just the rows that differ
+ * and invalidates only those, so borders and other parts that consecutive
+ * frames share are not sent to the panel again.
+ */
+static uint8_t art_buf[CANVAS_PALETTE_SIZE + ART_FRAME_SIZE] __aligned(LV_DRAW_BUF_ALIGN);
+static uint8_t next_buf[ART_FRAME_SIZE];
+
+static const lv_image_dsc_t art_img = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.stride = ART_STRIDE,
+    .header.cf = LV_COLOR_FORMAT_I1,
+    .header.w = ART_WIDTH,
+    .header.h = ART_HEIGHT,
+    .data_size = sizeof(art_buf),
+    .data = art_buf,
+};
+
+static lv_obj_t *art;
+static size_t art_index;
+static size_t frame_count;
+static bool use_pack;
+static enum cadence cadence;
+static bool suspended;
+
+static size_t prefetch_index;
+static atomic_t prefetch_state;
+
+#ifdef CONFIG_CUSTOM_ANIMATION_ORDER_MAX_FRAMES
+#define ORDER_MAX_FRAMES CONFIG_CUSTOM_ANIMATION_ORDER_MAX_FRAMES
+#else
+#define ORDER_MAX_FRAMES 0
+#endif
+
+// Position of the prefetched frame within the current cycle
+static size_t position;
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_SHUFFLE)
+static uint8_t order[ORDER_MAX_FRAMES];
+static bool shuffled;
+#endif
+#if ORDER_MAX_FRAMES > 0
+static uint8_t dwell_weights[ORDER_MAX_FRAMES];
+#endif
+
+static K_THREAD_STACK_DEFINE(prefetch_stack, CONFIG_CUSTOM_ANIMATION_PREFETCH_STACK_SIZE);
+static struct k_work_q prefetch_q;
+
+static void slideshow_work_cb(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(slideshow_work, slideshow_work_cb);
+
+static void prefetch_work_cb(struct k_work *work);
+static K_WORK_DEFINE(prefetch_work, prefetch_work_cb);
+
+static int decode_frame(size_t index, uint8_t *dst) {
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_ART_PACK)
+    if (use_pack) {
+        return art_pack_decode_frame(index, dst);
+    }
+#endif
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_BUILTIN_ART)
+    return art_decode_frame(&art_frames[index], dst);
+#else
+    return -ENOENT;
+#endif
+}
+
+/*
+ * Prefer a valid art pack in flash and fall back to the frames built into
+ * the firmware. Returns the number of frames available.
+ */
+static size_t open_frames(void) {
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_ART_PACK)
+    int count = art_pack_open();
+    if (count > 0) {
+        LOG_INF("Showing %d frames from the art pack", count);
+        use_pack = true;
+        return count;
+    }
+    LOG_INF("No usable art pack (%d)", count);
+#endif
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_BUILTIN_ART)
+    return art_frame_count;
+#else
+    return 0;
+#endif
+}
+
+// Runs on the low priority prefetch queue; only touches next_buf
+static void prefetch_work_cb(struct k_work *work) {
+    int ret = decode_frame(prefetch_index, next_buf);
+    if (ret < 0) {
+        LOG_ERR("Failed to decode art frame %zu (%d)", prefetch_index, ret);
+        atomic_set(&prefetch_state, PREFETCH_FAILED);
+        return;
+    }
+
+    atomic_set(&prefetch_state, PREFETCH_READY);
+}
+
+static void start_prefetch(size_t index) {
+    prefetch_index = index;
+    atomic_set(&prefetch_state, PREFETCH_BUSY);
+    k_work_submit_to_queue(&prefetch_q, &prefetch_work);
+}
+
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_SHUFFLE)
+/*
+ * Fisher-Yates over the frame indices, once per cycle. A cycle never starts
+ * with the frame that ended the previous one.
+ */
+static void shuffle_order(void) {
+    for (size_t i = 0; i < frame_count; i++) {
+        order[i] = i;
+    }
+    for (size_t i = frame_count - 1; i > 0; i--) {
+        size_t j = sys_rand32_get() % (i + 1);
+        uint8_t tmp = order[i];
+        order[i] = order[j];
+        order[j] = tmp;
+    }
+    if (order[0] == art_index) {
+        order[0] = order[1];
+        order[1] = art_index;
+    }
+}
+#endif
+
+static size_t frame_at(size_t pos) {
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_SHUFFLE)
+    if (shuffled) {
+        return order[pos];
+    }
+#endif
+    return pos;
+}
+
+static size_t next_frame(void) {
+    position = (position + 1) % frame_count;
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_SHUFFLE)
+    if (position == 0 && shuffled) {
+        shuffle_order();
+    }
+#endif
+    return frame_at(position);
+}
+
+// Comma separated multipliers in frame order; missing or invalid ones are 1
+static void parse_dwell_weights(void) {
+#if ORDER_MAX_FRAMES > 0
+    const char *weights = CONFIG_CUSTOM_ANIMATION_DWELL_WEIGHTS;
+
+    for (size_t i = 0; i < ARRAY_SIZE(dwell_weights); i++) {
+        char *end;
+        unsigned long weight = strtoul(weights, &end, 10);
+        dwell_weights[i] = (end != weights && weight > 0) ? MIN(weight, UINT8_MAX) : 1;
+
+        weights = strchr(end, ',');
+        if (weights == NULL) {
+            for (i++; i < ARRAY_SIZE(dwell_weights); i++) {
+                dwell_weights[i] = 1;
+            }
+            break;
+        }
+        weights++;
+    }
+#endif
+}
+
+static k_timeout_t frame_interval(void) {
+    int32_t interval = CONFIG_CUSTOM_ANIMATION_SPEED / frame_count;
+
+#if ORDER_MAX_FRAMES > 0
+    if (art_index < ARRAY_SIZE(dwell_weights)) {
+        interval *= dwell_weights[art_index];
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_BATTERY_CADENCE)
+    if (cadence == CADENCE_SLOW) {
+        interval *= CONFIG_CUSTOM_ANIMATION_BATTERY_SLOW_MULTIPLIER;
+    }
+#endif
+
+    return K_MSEC(interval);
+}
+
+static void schedule_next_frame(k_timeout_t delay) {
+    k_work_schedule_for_queue(zmk_display_work_q(), &slideshow_work, delay);
+}
+
+static void invalidate_rows(int y1, int y2) {
+    lv_area_t area;
+    lv_obj_get_coords(art, &area);
+    area.y2 = area.y1 + y2;
+    area.y1 += y1;
+    lv_obj_invalidate_area(art, &area);
+}
+
+// Copy the prefetched frame over the shown one, one band of changed rows at a time
+static void show_next_frame(void) {
+    uint8_t *shown = art_buf + CANVAS_PALETTE_SIZE;
+    int band_start = -1;
+
+    for (int y = 0; y <= ART_HEIGHT; y++) {
+        size_t offset = y * ART_STRIDE;
+        bool changed =
+            y < ART_HEIGHT && memcmp(shown + offset, next_buf + offset, ART_STRIDE) != 0;
+
+        if (changed && band_start < 0) {
+            band_start = y;
+        } else if (!changed && band_start >= 0) {
+            memcpy(shown + band_start * ART_STRIDE, next_buf + band_start * ART_STRIDE,
+                   (y - band_start) * ART_STRIDE);
+            invalidate_rows(band_start, y - 1);
+            band_start = -1;
+        }
+    }
+
+    lv_image_cache_drop(&art_img);
+}
+
+// Runs on the display work queue, which also owns LVGL, once per frame
+// interval; nothing wakes up for the slideshow in between
+static void slideshow_work_cb(struct k_work *work) {
+    switch (atomic_get(&prefetch_state)) {
+    case PREFETCH_BUSY:
+        schedule_next_frame(K_MSEC(PREFETCH_RETRY_MS));
+        return;
+    case PREFETCH_FAILED:
+        // Keep showing the current frame and move on to the one after
+        start_prefetch(next_frame());
+        schedule_next_frame(frame_interval());
+        return;
+    default:
+        break;
+    }
+
+    // Short on LVGL heap, keep the current frame
+    if (heap_monitor_headroom("slideshow") == 0) {
+        art_index = prefetch_index;
+        show_next_frame();
+        heap_monitor_check("slideshow");
+    }
+
+    start_prefetch(next_frame());
+    schedule_next_frame(frame_interval());
+}
+
+lv_obj_t *slideshow_create(lv_obj_t *parent) {
+    art = lv_image_create(parent);
+
+    // Set art bits are the light pixels
+    register_palette(art, (lv_color32_t *)art_buf, 1);
+
+    frame_count = open_frames();
+    if (frame_count == 0) {
+        LOG_ERR("No slideshow art available");
+        return art;
+    }
+
+    parse_dwell_weights();
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_SHUFFLE)
+    if (frame_count <= ORDER_MAX_FRAMES) {
+        shuffled = frame_count > 1;
+        if (shuffled) {
+            shuffle_order();
+        }
+    } else {
+        LOG_WRN("Showing %zu frames in order, shuffle is limited to %d", frame_count,
+                ORDER_MAX_FRAMES);
+    }
+#endif
+
+    position = 0;
+    art_index = frame_at(position);
+    int ret = decode_frame(art_index, art_buf + CANVAS_PALETTE_SIZE);
+    if (ret < 0) {
+        LOG_ERR("Failed to decode art frame %zu (%d)", art_index, ret);
+    }
+    lv_image_set_src(art, &art_img);
+
+    if (frame_count > 1) {
+        k_work_queue_start(&prefetch_q, prefetch_stack, K_THREAD_STACK_SIZEOF(prefetch_stack),
+                           K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+        k_thread_name_set(&prefetch_q.thread, "nice_view_art");
+
+        start_prefetch(next_frame());
+        schedule_next_frame(frame_interval());
+    }
+
+    return art;
+}
+
+// The panel keeps showing the current frame while the scheduler is stopped
+void slideshow_suspend(void) {
+    suspended = true;
+    k_work_cancel_delayable(&slideshow_work);
+}
+
+// Catch up with one frame change right away, then carry on as scheduled
+void slideshow_resume(void) {
+    suspended = false;
+    if (frame_count > 1 && cadence != CADENCE_FROZEN) {
+        schedule_next_frame(K_NO_WAIT);
+    }
+}
+
+#if IS_ENABLED(CONFIG_CUSTOM_ANIMATION_BATTERY_CADENCE)
+/*
+ * Each cadence is entered when the charge drops below its level and only
+ * left once the charge reaches the level of the next faster one, so noisy
+ * readings around a threshold do not keep switching the speed.
+ */
+static enum cadence battery_cadence(uint8_t level) {
+    if (level < CONFIG_CUSTOM_ANIMATION_BATTERY_FROZEN_LEVEL) {
+        return CADENCE_FROZEN;
+    }
+    if (level < CONFIG_CUSTOM_ANIMATION_BATTERY_SLOW_LEVEL) {
+        return MAX(cadence, CADENCE_SLOW);
+    }
+    if (level < CONFIG_CUSTOM_ANIMATION_BATTERY_NORMAL_LEVEL) {
+        return MIN(cadence, CADENCE_SLOW);
+    }
+    return CADENCE_NORMAL;
+}
+
+void slideshow_set_battery(uint8_t level, bool charging) {
+    // A level of zero means no reading has come in yet
+    enum cadence next = charging ? CADENCE_NORMAL : level == 0 ? cadence : battery_cadence(level);
+    if (next == cadence) {
+        return;
+    }
+
+    LOG_DBG("Slideshow cadence %d -> %d at %d%%", cadence, next, level);
+    enum cadence previous = cadence;
+    cadence = next;
+
+    // A change between running speeds takes effect with the next frame
+    if (frame_count <= 1 || suspended) {
+        return;
+    }
+    if (next == CADENCE_FROZEN) {
+        k_work_cancel_delayable(&slideshow_work);
+    } else if (previous == CADENCE_FROZEN) {
+        schedule_next_frame(frame_interval());
+    }
+}
+#else
+void slideshow_set_battery(uint8_t level, bool charging) {}
+#endif
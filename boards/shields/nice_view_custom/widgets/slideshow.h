@@ -0,0 +1,15 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+lv_obj_t *slideshow_create(lv_obj_t *parent);
+void slideshow_suspend(void);
+void slideshow_resume(void);
+void slideshow_set_battery(uint8_t level, bool charging);
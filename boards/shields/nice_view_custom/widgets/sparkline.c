@@ -0,0 +1,67 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "sparkline.h"
+
+void sparkline_push(struct sparkline *line, uint8_t value) {
+    uint8_t evicted = line->samples[line->head];
+
+    line->samples[line->head] = value;
+    line->head = (line->head + 1) % SPARKLINE_LEN;
+
+    if (value >= line->max) {
+        line->max = value;
+    } else if (evicted == line->max) {
+        line->max = 0;
+        for (int i = 0; i < SPARKLINE_LEN; i++) {
+            line->max = line->samples[i] > line->max ? line->samples[i] : line->max;
+        }
+    }
+
+    if (value <= line->min) {
+        line->min = value;
+    } else if (evicted == line->min) {
+        line->min = UINT8_MAX;
+        for (int i = 0; i < SPARKLINE_LEN; i++) {
+            line->min = line->samples[i] < line->min ? line->samples[i] : line->min;
+        }
+    }
+}
+
+// The i-th sample, oldest first
+uint8_t sparkline_get(const struct sparkline *line, int i) {
+    return line->samples[(line->head + i) % SPARKLINE_LEN];
+}
+
+uint8_t sparkline_latest(const struct sparkline *line) {
+    return sparkline_get(line, SPARKLINE_LEN - 1);
+}
+
+// Whether every sample already equals value, so pushing it changes nothing
+bool sparkline_settled(const struct sparkline *line, uint8_t value) {
+    return line->min == value && line->max == value;
+}
+
+/*
+ * Map the samples onto y coordinates between bottom and bottom - height. The
+ * scale is taken once as a rounded-up 16.16 reciprocal, which is exact for
+ * 8-bit samples, so the per-point work is a multiply and a shift.
+ */
+void sparkline_scale(const struct sparkline *line, int32_t bottom, int32_t height,
+                     uint8_t y[SPARKLINE_LEN]) {
+    uint32_t range = line->max - line->min;
+    if (range == 0) {
+        range = 1;
+    }
+
+    uint32_t scale = (((uint32_t)height << 16) + range - 1) / range;
+
+    for (int i = 0; i < SPARKLINE_LEN; i++) {
+        uint32_t offset = sparkline_get(line, i) - line->min;
+        y[i] = bottom - ((offset * scale) >> 16);
+    }
+}
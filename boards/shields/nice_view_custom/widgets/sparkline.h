@@ -0,0 +1,28 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPARKLINE_LEN 10
+
+// Ring buffer of samples that keeps its own min and max up to date
+struct sparkline {
+    uint8_t samples[SPARKLINE_LEN];
+    uint8_t head; // Oldest sample
+    uint8_t min;
+    uint8_t max;
+};
+
+void sparkline_push(struct sparkline *line, uint8_t value);
+uint8_t sparkline_get(const struct sparkline *line, int i);
+uint8_t sparkline_latest(const struct sparkline *line);
+bool sparkline_settled(const struct sparkline *line, uint8_t value);
+void sparkline_scale(const struct sparkline *line, int32_t bottom, int32_t height,
+                     uint8_t y[SPARKLINE_LEN]);
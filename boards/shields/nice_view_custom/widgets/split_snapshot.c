@@ -0,0 +1,189 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/event_manager.h>
+
+#include "split_snapshot.h"
+
+/*
+ * The peripheral hosts a write-only characteristic next to the ZMK split
+ * service. The central finds it once the split link is encrypted and writes
+ * a few bytes without response whenever the digested state changes.
+ */
+static struct bt_uuid_128 snapshot_service_uuid = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x8c1f6a10, 0x4b3e, 0x4f0c, 0x9a57, 0x6e6963657600));
+static struct bt_uuid_128 snapshot_char_uuid = BT_UUID_INIT_128(
+    BT_UUID_128_ENCODE(0x8c1f6a10, 0x4b3e, 0x4f0c, 0x9a57, 0x6e6963657601));
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+
+// Shared with the Bluetooth callbacks and the display work queue
+static struct k_spinlock lock;
+static struct bt_conn *peripheral_conn;
+static uint16_t snapshot_handle;
+static bool resend;
+static struct split_snapshot latest;
+static bool has_latest;
+
+// Only used by send_work, which runs on the system work queue
+static struct split_snapshot sent;
+static bool sent_valid;
+
+static struct bt_gatt_discover_params discover_params;
+
+static void send_work_cb(struct k_work *work) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    uint16_t handle = snapshot_handle;
+    struct bt_conn *conn = handle != 0 ? bt_conn_ref(peripheral_conn) : NULL;
+    struct split_snapshot snapshot = latest;
+    bool valid = has_latest;
+    if (resend) {
+        // A freshly connected peripheral has not seen anything yet
+        sent_valid = false;
+        resend = false;
+    }
+    k_spin_unlock(&lock, key);
+
+    if (conn == NULL) {
+        return;
+    }
+
+    if (valid && (!sent_valid || memcmp(&sent, &snapshot, sizeof(snapshot)) != 0)) {
+        int err = bt_gatt_write_without_response(conn, handle, &snapshot, sizeof(snapshot), false);
+        if (err < 0) {
+            LOG_WRN("Failed to send the status snapshot (%d)", err);
+        } else {
+            sent = snapshot;
+        }
+        sent_valid = err == 0;
+    }
+
+    bt_conn_unref(conn);
+}
+
+static K_WORK_DEFINE(send_work, send_work_cb);
+
+/*
+ * Called from the display work queue. The write can wait for Bluetooth TX
+ * buffers, so it is left to the system work queue rather than holding up
+ * redraws.
+ */
+void split_snapshot_update(const struct split_snapshot *snapshot) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    latest = *snapshot;
+    has_latest = true;
+    k_spin_unlock(&lock, key);
+
+    k_work_submit(&send_work);
+}
+
+static uint8_t discover_cb(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+                           struct bt_gatt_discover_params *params) {
+    if (attr == NULL) {
+        LOG_INF("Split peripheral does not take status snapshots");
+        return BT_GATT_ITER_STOP;
+    }
+
+    const struct bt_gatt_chrc *chrc = attr->user_data;
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    if (conn == peripheral_conn) {
+        snapshot_handle = chrc->value_handle;
+        resend = true;
+    }
+    k_spin_unlock(&lock, key);
+
+    k_work_submit(&send_work);
+    return BT_GATT_ITER_STOP;
+}
+
+static void snapshot_security_changed(struct bt_conn *conn, bt_security_t level,
+                                      enum bt_security_err err) {
+    struct bt_conn_info info;
+    if (err != BT_SECURITY_ERR_SUCCESS || bt_conn_get_info(conn, &info) < 0 ||
+        info.role != BT_CONN_ROLE_CENTRAL) {
+        return;
+    }
+
+    // Only the first split peripheral to connect is mirrored
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool taken = peripheral_conn != NULL;
+    if (!taken) {
+        peripheral_conn = bt_conn_ref(conn);
+    }
+    k_spin_unlock(&lock, key);
+
+    if (taken) {
+        return;
+    }
+
+    discover_params = (struct bt_gatt_discover_params){
+        .uuid = &snapshot_char_uuid.uuid,
+        .func = discover_cb,
+        .start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE,
+        .end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE,
+        .type = BT_GATT_DISCOVER_CHARACTERISTIC,
+    };
+
+    int ret = bt_gatt_discover(conn, &discover_params);
+    if (ret < 0) {
+        LOG_WRN("Failed to look for the status snapshot characteristic (%d)", ret);
+    }
+}
+
+static void snapshot_disconnected(struct bt_conn *conn, uint8_t reason) {
+    k_spinlock_key_t key = k_spin_lock(&lock);
+    bool ours = conn == peripheral_conn;
+    if (ours) {
+        peripheral_conn = NULL;
+        snapshot_handle = 0;
+    }
+    k_spin_unlock(&lock, key);
+
+    if (ours) {
+        bt_conn_unref(conn);
+    }
+}
+
+BT_CONN_CB_DEFINE(snapshot_conn_callbacks) = {
+    .disconnected = snapshot_disconnected,
+    .security_changed = snapshot_security_changed,
+};
+
+#else
+
+ZMK_EVENT_IMPL(nice_view_snapshot_changed);
+
+static ssize_t write_snapshot(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+                              const void *buf, uint16_t len, uint16_t offset, uint8_t flags) {
+    if (offset != 0 || len != sizeof(struct split_snapshot)) {
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_ATTRIBUTE_LEN);
+    }
+
+    struct nice_view_snapshot_changed ev;
+    memcpy(&ev.snapshot, buf, sizeof(ev.snapshot));
+    raise_nice_view_snapshot_changed(ev);
+
+    return len;
+}
+
+BT_GATT_SERVICE_DEFINE(snapshot_svc, BT_GATT_PRIMARY_SERVICE(&snapshot_service_uuid),
+                       BT_GATT_CHARACTERISTIC(&snapshot_char_uuid.uuid,
+                                              BT_GATT_CHRC_WRITE_WITHOUT_RESP,
+                                              BT_GATT_PERM_WRITE_ENCRYPT, NULL, write_snapshot,
+                                              NULL));
+
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) */
@@ -0,0 +1,32 @@
+/*
+ *
+ * Copyright (c) 2023 The ZMK Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zmk/event_manager.h>
+
+#define SPLIT_SNAPSHOT_BATTERY_STEP 5
+#define SPLIT_SNAPSHOT_WPM_STEP 10
+
+// Central state as the peripheral shows it, already reduced to what it draws
+struct split_snapshot {
+    uint8_t battery_bucket;
+    uint8_t layer_index;
+    uint8_t wpm_bucket;
+} __packed;
+
+// Raised on the peripheral for every snapshot the central sends
+struct nice_view_snapshot_changed {
+    struct split_snapshot snapshot;
+};
+
+ZMK_EVENT_DECLARE(nice_view_snapshot_changed);
+
+// Central only, from the display work queue. Sent when it differs from the
+// last snapshot the peripheral received.
+void split_snapshot_update(const struct split_snapshot *snapshot);
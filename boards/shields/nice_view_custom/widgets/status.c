@@ -13,6 +13,8 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/battery.h>
 #include <zmk/display.h>
 #include "status.h"
+#include <zmk/activity.h>
+#include <zmk/events/activity_state_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/battery_state_changed.h>
@@ -26,6 +28,11 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/keymap.h>
 #include <zmk/wpm.h>
 
+#include "benchmark.h"
+#include "compositor.h"
+#include "heap_monitor.h"
+#include "render_stats.h"
+
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
 
 struct output_status_state {
@@ -37,199 +44,380 @@ struct output_status_state {
 
 struct layer_status_state {
     uint8_t index;
-    const char *label;
 };
 
 struct wpm_status_state {
     uint8_t wpm;
 };
 
-static void draw_top(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 0);
+enum output_symbol {
+    OUTPUT_SYMBOL_NONE,
+    OUTPUT_SYMBOL_USB,
+    OUTPUT_SYMBOL_CONNECTED,
+    OUTPUT_SYMBOL_DISCONNECTED,
+    OUTPUT_SYMBOL_UNBONDED,
+};
+
+static const char *const output_symbols[] = {
+    [OUTPUT_SYMBOL_NONE] = "",
+    [OUTPUT_SYMBOL_USB] = LV_SYMBOL_USB,
+    [OUTPUT_SYMBOL_CONNECTED] = LV_SYMBOL_WIFI,
+    [OUTPUT_SYMBOL_DISCONNECTED] = LV_SYMBOL_CLOSE,
+    [OUTPUT_SYMBOL_UNBONDED] = LV_SYMBOL_SETTINGS,
+};
+
+static enum output_symbol get_output_symbol(const struct status_state *state) {
+    switch (state->selected_endpoint.transport) {
+    case ZMK_TRANSPORT_USB:
+        return OUTPUT_SYMBOL_USB;
+    case ZMK_TRANSPORT_BLE:
+        if (state->active_profile_bonded) {
+            return state->active_profile_connected ? OUTPUT_SYMBOL_CONNECTED
+                                                   : OUTPUT_SYMBOL_DISCONNECTED;
+        }
+        return OUTPUT_SYMBOL_UNBONDED;
+    default:
+        return OUTPUT_SYMBOL_NONE;
+    }
+}
+
+static const int circle_offsets[5][2] = {
+    {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
+};
+
+/*
+ * Render the parts of the top and middle sections that never change and keep
+ * them as backgrounds, so redraws start from a copy instead of rasterising
+ * the frames and profile circles again. The middle section also keeps a copy
+ * with every circle filled to take the selected one from.
+ */
+static void draw_top_background(struct zmk_widget_status *widget, lv_obj_t *canvas) {
+    clear_canvas(canvas);
+
     lv_layer_t layer;
     lv_canvas_init_layer(canvas, &layer);
 
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16, LV_TEXT_ALIGN_RIGHT);
-    lv_draw_label_dsc_t label_dsc_wpm;
-    init_label_dsc(&label_dsc_wpm, LVGL_FOREGROUND, &lv_font_unscii_8, LV_TEXT_ALIGN_RIGHT);
     lv_draw_rect_dsc_t rect_black_dsc;
     init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
     lv_draw_rect_dsc_t rect_white_dsc;
     init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_draw_line_dsc_t line_dsc;
-    init_line_dsc(&line_dsc, LVGL_FOREGROUND, 1);
 
-    // Fill background
-    // lv_area_t bg_area = {0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1};
-    // lv_draw_rect(&layer, &rect_black_dsc, &bg_area);
+    draw_battery_outline(&layer);
+    draw_rotated_rect(&layer, &rect_white_dsc, (lv_area_t){0, 21, 67, 62});
+    draw_rotated_rect(&layer, &rect_black_dsc, (lv_area_t){1, 22, 66, 61});
 
-    // Draw battery
-    draw_battery(&layer, state);
+    lv_canvas_finish_layer(canvas, &layer);
+    save_canvas(canvas, widget->top_bg);
+    init_battery_sprites(canvas, widget->top_bg);
+}
 
-    // Draw output status
-    char output_text[10] = {};
+static void draw_middle_background(struct zmk_widget_status *widget, lv_obj_t *canvas) {
+    clear_canvas(canvas);
 
-    switch (state->selected_endpoint.transport) {
-    case ZMK_TRANSPORT_USB:
-        strcat(output_text, LV_SYMBOL_USB);
-        break;
-    case ZMK_TRANSPORT_BLE:
-        if (state->active_profile_bonded) {
-            if (state->active_profile_connected) {
-                strcat(output_text, LV_SYMBOL_WIFI);
-            } else {
-                strcat(output_text, LV_SYMBOL_CLOSE);
-            }
-        } else {
-            strcat(output_text, LV_SYMBOL_SETTINGS);
-        }
-        break;
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t arc_dsc;
+    init_arc_dsc(&arc_dsc, LVGL_FOREGROUND, 2);
+    arc_dsc.radius = 13;
+    arc_dsc.start_angle = 0;
+    arc_dsc.end_angle = 360;
+
+    for (int i = 0; i < 5; i++) {
+        arc_dsc.center = rotate_point((lv_point_t){circle_offsets[i][0], circle_offsets[i][1]});
+        lv_draw_arc(&layer, &arc_dsc);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+    save_canvas(canvas, widget->middle_bg);
+
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_arc_dsc_t arc_dsc_filled;
+    init_arc_dsc(&arc_dsc_filled, LVGL_FOREGROUND, 9);
+    arc_dsc_filled.radius = 9;
+    arc_dsc_filled.start_angle = 0;
+    arc_dsc_filled.end_angle = 360;
+
+    for (int i = 0; i < 5; i++) {
+        arc_dsc_filled.center =
+            rotate_point((lv_point_t){circle_offsets[i][0], circle_offsets[i][1]});
+        lv_draw_arc(&layer, &arc_dsc_filled);
     }
 
-    label_dsc.text = output_text;
-    lv_area_t text_area = {0, 0, CANVAS_SIZE - 1, 20}; 
-    lv_draw_label(&layer, &label_dsc, &text_area);
+    lv_canvas_finish_layer(canvas, &layer);
+    save_canvas(canvas, widget->middle_selected_bg);
+}
+
+/*
+ * Label descriptors for the redraws, built once at init. Draws only point
+ * them at new text; everything runs on the display work queue.
+ */
+static lv_draw_label_dsc_t output_label_dsc;
+static lv_draw_label_dsc_t wpm_label_dsc;
+static lv_draw_label_dsc_t profile_label_dsc;
+static lv_draw_label_dsc_t selected_profile_label_dsc;
+
+static void init_draw_descriptors(void) {
+    init_label_dsc(&output_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_16,
+                   LV_TEXT_ALIGN_RIGHT);
+    init_label_dsc(&wpm_label_dsc, LVGL_FOREGROUND, &lv_font_unscii_8, LV_TEXT_ALIGN_RIGHT);
+    init_label_dsc(&profile_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_18,
+                   LV_TEXT_ALIGN_CENTER);
+    init_label_dsc(&selected_profile_label_dsc, LVGL_BACKGROUND, &lv_font_montserrat_18,
+                   LV_TEXT_ALIGN_CENTER);
+}
+
+static void draw_top(struct zmk_widget_status *widget, lv_obj_t *canvas,
+                     const struct status_state *state) {
+    restore_canvas(canvas, widget->top_bg);
+
+    // Draw battery
+    draw_battery(canvas, state);
 
     // Draw WPM
-    lv_area_t wpm_rect = {0, 21, 67, 62};
-    lv_draw_rect(&layer, &rect_white_dsc, &wpm_rect);
-    
-    lv_area_t wpm_inner_rect = {1, 22, 66, 61};
-    lv_draw_rect(&layer, &rect_black_dsc, &wpm_inner_rect);
+    uint8_t wpm_points[SPARKLINE_LEN];
+    sparkline_scale(&state->wpm, 60, 36, wpm_points);
+
+    lv_point_t points[SPARKLINE_LEN];
+    for (int i = 0; i < SPARKLINE_LEN; i++) {
+        points[i].x = 2 + i * 7;
+        points[i].y = wpm_points[i];
+    }
+
+    draw_rotated_polyline(canvas, points, SPARKLINE_LEN);
+
+    // Draw output status
+    output_label_dsc.text = output_symbols[get_output_symbol(state)];
+    lv_area_t text_area = {0, 0, CANVAS_SIZE - 1, 20};
+    draw_rotated_label(canvas, &output_label_dsc, &text_area);
 
     char wpm_text[6] = {};
-    snprintf(wpm_text, sizeof(wpm_text), "%d", state->wpm[9]);
-    label_dsc_wpm.text = wpm_text;
+    snprintf(wpm_text, sizeof(wpm_text), "%d", sparkline_latest(&state->wpm));
+    wpm_label_dsc.text = wpm_text;
     lv_area_t wpm_text_area = {42, 52, 66, 60};
-    lv_draw_label(&layer, &label_dsc_wpm, &wpm_text_area);
+    draw_rotated_label_uncached(canvas, &wpm_label_dsc, &wpm_text_area);
 
-    int max = 0;
-    int min = 256;
+    invalidate_canvas_changes(canvas);
+}
 
-    for (int i = 0; i < 10; i++) {
-        if (state->wpm[i] > max) {
-            max = state->wpm[i];
-        }
-        if (state->wpm[i] < min) {
-            min = state->wpm[i];
-        }
+static void draw_middle(struct zmk_widget_status *widget, lv_obj_t *canvas,
+                        const struct status_state *state) {
+    restore_canvas(canvas, widget->middle_bg);
+
+    // Fill the selected circle
+    int selected = state->active_profile_index;
+    if (selected >= 0 && selected < 5) {
+        lv_area_t disc = rotate_area(
+            (lv_area_t){circle_offsets[selected][0] - 9, circle_offsets[selected][1] - 9,
+                        circle_offsets[selected][0] + 9, circle_offsets[selected][1] + 9});
+        copy_canvas_area(canvas, widget->middle_selected_bg, &disc);
     }
 
-    int range = max - min;
-    if (range == 0) {
-        range = 1;
+    // Draw profile numbers
+    for (int i = 0; i < 5; i++) {
+        char label[2];
+        snprintf(label, sizeof(label), "%d", i + 1);
+
+        lv_draw_label_dsc_t *dsc =
+            i == selected ? &selected_profile_label_dsc : &profile_label_dsc;
+        dsc->text = label;
+        lv_area_t label_area = {circle_offsets[i][0] - 8, circle_offsets[i][1] - 10,
+                                circle_offsets[i][0] + 8, circle_offsets[i][1] + 10};
+        draw_rotated_label(canvas, dsc, &label_area);
     }
 
-    lv_point_t points[10];
-    for (int i = 0; i < 10; i++) {
-        points[i].x = 2 + i * 7;
-        points[i].y = 60 - (state->wpm[i] - min) * 36 / range;
+    invalidate_canvas_changes(canvas);
+}
+
+static const lv_area_t layer_text_area = {0, 5, 67, 30};
+
+// Every keymap layer's name, rendered once at init
+static struct label_bitmap layer_bitmaps[ZMK_KEYMAP_LAYERS_LEN];
+
+static void init_layer_bitmaps(void) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(layer_bitmaps); i++) {
+        render_layer_bitmap(i, zmk_keymap_layer_name(i), &layer_text_area, &layer_bitmaps[i]);
     }
-    
-    for (int i = 0; i < 9; i++) {
-        line_dsc.p1 = points[i];
-        line_dsc.p2 = points[i+1];
-        lv_draw_line(&layer, &line_dsc);
+}
+
+static void draw_bottom(struct zmk_widget_status *widget, lv_obj_t *canvas,
+                        const struct status_state *state) {
+    clear_canvas(canvas);
+
+    // Draw layer
+    if (state->layer_index < ARRAY_SIZE(layer_bitmaps)) {
+        blit_label_bitmap(canvas, &layer_bitmaps[state->layer_index], &layer_text_area);
+    } else {
+        draw_layer_label(canvas, state->layer_index, NULL, &layer_text_area);
     }
-    
-    lv_canvas_finish_layer(canvas, &layer);
 
-    // Rotate canvas
-    rotate_canvas(canvas, cbuf);
+    invalidate_canvas_changes(canvas);
 }
 
-static void draw_middle(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 1);
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
+/*
+ * Record the inputs a section is about to be drawn from. Returns false when
+ * they match what is already on screen, so the draw can be skipped.
+ */
+static bool update_fingerprint(struct zmk_widget_status *widget, uint8_t section, void *stored,
+                               const void *current, size_t size) {
+    if ((widget->drawn & section) && memcmp(stored, current, size) == 0) {
+        return false;
+    }
 
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
-    lv_draw_arc_dsc_t arc_dsc;
-    init_arc_dsc(&arc_dsc, LVGL_FOREGROUND, 2);
-    lv_draw_arc_dsc_t arc_dsc_filled;
-    init_arc_dsc(&arc_dsc_filled, LVGL_FOREGROUND, 9);
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
-    lv_draw_label_dsc_t label_dsc_black;
-    init_label_dsc(&label_dsc_black, LVGL_BACKGROUND, &lv_font_montserrat_18, LV_TEXT_ALIGN_CENTER);
-
-    // Fill background
-    // lv_area_t bg_area = {0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1};
-    // lv_draw_rect(&layer, &rect_black_dsc, &bg_area);
-
-    // Draw circles
-    int circle_offsets[5][2] = {
-        {13, 13}, {55, 13}, {34, 34}, {13, 55}, {55, 55},
+    memcpy(stored, current, size);
+    widget->drawn |= section;
+    return true;
+}
+
+static bool update_top_fingerprint(struct zmk_widget_status *widget) {
+    const struct status_state *state = &widget->state;
+    struct top_fingerprint fp = {
+        .battery_fill = (state->battery + 2) / 4,
+        .charging = state->charging,
+        .output_symbol = get_output_symbol(state),
+        .wpm = sparkline_latest(&state->wpm),
     };
+    sparkline_scale(&state->wpm, 60, 36, fp.wpm_points);
 
-    for (int i = 0; i < 5; i++) {
-        bool selected = i == state->active_profile_index;
+    return update_fingerprint(widget, SECTION_TOP, &widget->top_fp, &fp, sizeof(fp));
+}
 
-        arc_dsc.center.x = circle_offsets[i][0];
-        arc_dsc.center.y = circle_offsets[i][1];
-        arc_dsc.radius = 13;
-        arc_dsc.start_angle = 0;
-        arc_dsc.end_angle = 360;
-        lv_draw_arc(&layer, &arc_dsc);
+static bool update_middle_fingerprint(struct zmk_widget_status *widget) {
+    struct middle_fingerprint fp = {
+        .active_profile_index = widget->state.active_profile_index,
+    };
+
+    return update_fingerprint(widget, SECTION_MIDDLE, &widget->middle_fp, &fp, sizeof(fp));
+}
+
+static bool update_bottom_fingerprint(struct zmk_widget_status *widget) {
+    struct bottom_fingerprint fp = {
+        .layer_index = widget->state.layer_index,
+    };
+
+    return update_fingerprint(widget, SECTION_BOTTOM, &widget->bottom_fp, &fp, sizeof(fp));
+}
+
+/*
+ * The screen is a row of CANVAS_SIZE square sections, one canvas each, in
+ * SECTION_* bit order. Init builds the canvases from this table and redraws
+ * walk it, so the coalescing and skipping logic is shared by all sections.
+ */
+struct section {
+    const char *name;
+    uint8_t mask;
+    // Left edge within the 160 pixel wide widget
+    int32_t x;
+    size_t cbuf_offset;
+    enum render_stat_id stat;
+    // Optional, run once at init
+    void (*draw_background)(struct zmk_widget_status *widget, lv_obj_t *canvas);
+    bool (*update_fingerprint)(struct zmk_widget_status *widget);
+    void (*draw)(struct zmk_widget_status *widget, lv_obj_t *canvas,
+                 const struct status_state *state);
+};
+
+static const struct section sections[SECTION_COUNT] = {
+    {
+        .name = "top",
+        .mask = SECTION_TOP,
+        .x = 160 - CANVAS_SIZE,
+        .cbuf_offset = offsetof(struct zmk_widget_status, cbuf),
+        .stat = RENDER_STAT_TOP,
+        .draw_background = draw_top_background,
+        .update_fingerprint = update_top_fingerprint,
+        .draw = draw_top,
+    },
+    {
+        .name = "middle",
+        .mask = SECTION_MIDDLE,
+        .x = 24,
+        .cbuf_offset = offsetof(struct zmk_widget_status, cbuf2),
+        .stat = RENDER_STAT_MIDDLE,
+        .draw_background = draw_middle_background,
+        .update_fingerprint = update_middle_fingerprint,
+        .draw = draw_middle,
+    },
+    {
+        .name = "bottom",
+        .mask = SECTION_BOTTOM,
+        .x = -44,
+        .cbuf_offset = offsetof(struct zmk_widget_status, cbuf3),
+        .stat = RENDER_STAT_BOTTOM,
+        .update_fingerprint = update_bottom_fingerprint,
+        .draw = draw_bottom,
+    },
+};
 
-        if (selected) {
-            arc_dsc_filled.center.x = circle_offsets[i][0];
-            arc_dsc_filled.center.y = circle_offsets[i][1];
-            arc_dsc_filled.radius = 9;
-            arc_dsc_filled.start_angle = 0;
-            arc_dsc_filled.end_angle = 360;
-            lv_draw_arc(&layer, &arc_dsc_filled);
+static void redraw_sections(struct zmk_widget_status *widget, uint8_t dirty) {
+    for (int i = 0; i < SECTION_COUNT; i++) {
+        const struct section *section = &sections[i];
+        if (!(dirty & section->mask)) {
+            continue;
         }
 
-        char label[2];
-        snprintf(label, sizeof(label), "%d", i + 1);
-        
-        lv_draw_label_dsc_t *dsc = selected ? &label_dsc_black : &label_dsc;
-        dsc->text = label;
-        lv_area_t label_area = {circle_offsets[i][0] - 8, circle_offsets[i][1] - 10, circle_offsets[i][0] + 8, circle_offsets[i][1] + 10};
-        lv_draw_label(&layer, dsc, &label_area);
+        // Short on LVGL heap, the section stays dirty and is retried below
+        if (heap_monitor_headroom(section->name) != 0) {
+            widget->dirty |= section->mask;
+            continue;
+        }
+
+        if (section->update_fingerprint(widget)) {
+            RENDER_STAT_TIME(section->stat,
+                             section->draw(widget, widget->canvases[i], &widget->state));
+            heap_monitor_check(section->name);
+        }
     }
 
-    lv_canvas_finish_layer(canvas, &layer);
+    if (widget->dirty && !widget->suspended) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &widget->redraw_work,
+                                  K_MSEC(HEAP_MONITOR_RETRY_MS));
+    }
 
-    // Rotate canvas
-    rotate_canvas(canvas, cbuf);
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_DIRECT_FRAMEBUFFER)
+    compositor_flush();
+#endif
 }
 
-static void draw_bottom(lv_obj_t *widget, lv_color_t cbuf[], const struct status_state *state) {
-    lv_obj_t *canvas = lv_obj_get_child(widget, 2);
-    lv_layer_t layer;
-    lv_canvas_init_layer(canvas, &layer);
-
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_label_dsc_t label_dsc;
-    init_label_dsc(&label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_14, LV_TEXT_ALIGN_CENTER);
+static void redraw_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_status *widget = CONTAINER_OF(dwork, struct zmk_widget_status, redraw_work);
+    uint8_t dirty = widget->dirty;
+    widget->dirty = 0;
+
+    RENDER_STAT_TIME(RENDER_STAT_REDRAW, redraw_sections(widget, dirty));
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    // Piggybacks on the redraw coalescing, and the buckets keep it quiet
+    split_snapshot_update(&(struct split_snapshot){
+        .battery_bucket = widget->state.battery / SPLIT_SNAPSHOT_BATTERY_STEP,
+        .layer_index = widget->state.layer_index,
+        .wpm_bucket = sparkline_latest(&widget->state.wpm) / SPLIT_SNAPSHOT_WPM_STEP,
+    });
+#endif
+}
 
-    // Fill background
-    // lv_area_t bg_area = {0, 0, CANVAS_SIZE - 1, CANVAS_SIZE - 1};
-    // lv_draw_rect(&layer, &rect_black_dsc, &bg_area);
+// Draw the given sections right away, along with anything already pending
+void zmk_widget_status_redraw(struct zmk_widget_status *widget, uint8_t sections) {
+    k_work_cancel_delayable(&widget->redraw_work);
+    widget->dirty |= sections;
+    redraw_work_cb(&widget->redraw_work.work);
+}
 
-    // Draw layer
-    char text[32] = {};
-    if (state->layer_label == NULL) {
-        sprintf(text, "LAYER %i", state->layer_index);
-        label_dsc.text = text;
-    } else {
-        label_dsc.text = state->layer_label;
+/*
+ * Listeners only record which sections went stale. The first one to do so
+ * schedules the redraw and later ones within the delay fold into it, so a
+ * burst of events (e.g. reconnecting to a host) draws each section once.
+ */
+static void mark_dirty(struct zmk_widget_status *widget, uint8_t sections) {
+    widget->dirty |= sections;
+    if (widget->suspended) {
+        return;
     }
-    
-    lv_area_t text_area = {0, 5, 67, 30};
-    lv_draw_label(&layer, &label_dsc, &text_area);
-
-    lv_canvas_finish_layer(canvas, &layer);
 
-    // Rotate canvas
-    rotate_canvas(canvas, cbuf);
+    k_work_schedule_for_queue(zmk_display_work_q(), &widget->redraw_work,
+                              K_MSEC(CONFIG_NICE_VIEW_WIDGET_REDRAW_DELAY));
 }
 
 static void set_battery_status(struct zmk_widget_status *widget,
@@ -240,7 +428,7 @@ static void set_battery_status(struct zmk_widget_status *widget,
 
     widget->state.battery = state.level;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+    mark_dirty(widget, SECTION_TOP);
 }
 
 static void battery_status_update_cb(struct battery_status_state state) {
@@ -274,8 +462,7 @@ static void set_output_status(struct zmk_widget_status *widget,
     widget->state.active_profile_connected = state->active_profile_connected;
     widget->state.active_profile_bonded = state->active_profile_bonded;
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
-    draw_middle(widget->obj, widget->cbuf2, &widget->state);
+    mark_dirty(widget, SECTION_TOP | SECTION_MIDDLE);
 }
 
 static void output_status_update_cb(struct output_status_state state) {
@@ -303,11 +490,25 @@ ZMK_SUBSCRIPTION(widget_output_status, zmk_usb_conn_state_changed);
 ZMK_SUBSCRIPTION(widget_output_status, zmk_ble_active_profile_changed);
 #endif
 
+/*
+ * Layer changes only reach the screen once the layer has been held for the
+ * debounce time, so momentary layers tapped in passing never cause a redraw.
+ * Each change restarts the wait.
+ */
 static void set_layer_status(struct zmk_widget_status *widget, struct layer_status_state state) {
-    widget->state.layer_index = state.index;
-    widget->state.layer_label = state.label;
+    widget->pending_layer = state.index;
+
+    k_work_reschedule_for_queue(zmk_display_work_q(), &widget->layer_settle_work,
+                                K_MSEC(CONFIG_NICE_VIEW_WIDGET_LAYER_DEBOUNCE));
+}
+
+static void layer_settle_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_status *widget =
+        CONTAINER_OF(dwork, struct zmk_widget_status, layer_settle_work);
 
-    draw_bottom(widget->obj, widget->cbuf3, &widget->state);
+    widget->state.layer_index = widget->pending_layer;
+    mark_dirty(widget, SECTION_BOTTOM);
 }
 
 static void layer_status_update_cb(struct layer_status_state state) {
@@ -316,8 +517,7 @@ static void layer_status_update_cb(struct layer_status_state state) {
 }
 
 static struct layer_status_state layer_status_get_state(const zmk_event_t *eh) {
-    uint8_t index = zmk_keymap_highest_layer_active();
-    return (struct layer_status_state){.index = index, .label = zmk_keymap_layer_name(index)};
+    return (struct layer_status_state){.index = zmk_keymap_highest_layer_active()};
 }
 
 ZMK_DISPLAY_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, layer_status_update_cb,
@@ -325,13 +525,37 @@ ZMK_DISPLAY_WIDGET_LISTENER(widget_layer_status, struct layer_status_state, laye
 
 ZMK_SUBSCRIPTION(widget_layer_status, zmk_layer_state_changed);
 
-static void set_wpm_status(struct zmk_widget_status *widget, struct wpm_status_state state) {
-    for (int i = 0; i < 9; i++) {
-        widget->state.wpm[i] = widget->state.wpm[i + 1];
+static void schedule_wpm_sample(struct zmk_widget_status *widget) {
+    if (widget->suspended) {
+        return;
+    }
+
+    k_work_schedule_for_queue(zmk_display_work_q(), &widget->wpm_sample_work,
+                              K_MSEC(CONFIG_NICE_VIEW_WIDGET_WPM_SAMPLE_INTERVAL));
+}
+
+/*
+ * The sparkline history advances at a fixed cadence from the latest reported
+ * WPM, however many reports arrived in between, so typing bursts cost at most
+ * one top redraw per interval. Sampling stops once the history has settled on
+ * the latest value and restarts with the next report.
+ */
+static void wpm_sample_work_cb(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct zmk_widget_status *widget =
+        CONTAINER_OF(dwork, struct zmk_widget_status, wpm_sample_work);
+
+    sparkline_push(&widget->state.wpm, widget->latest_wpm);
+    mark_dirty(widget, SECTION_TOP);
+
+    if (!sparkline_settled(&widget->state.wpm, widget->latest_wpm)) {
+        schedule_wpm_sample(widget);
     }
-    widget->state.wpm[9] = state.wpm;
+}
 
-    draw_top(widget->obj, widget->cbuf, &widget->state);
+static void set_wpm_status(struct zmk_widget_status *widget, struct wpm_status_state state) {
+    widget->latest_wpm = state.wpm;
+    schedule_wpm_sample(widget);
 }
 
 static void wpm_status_update_cb(struct wpm_status_state state) {
@@ -347,30 +571,92 @@ ZMK_DISPLAY_WIDGET_LISTENER(widget_wpm_status, struct wpm_status_state, wpm_stat
                             wpm_status_get_state)
 ZMK_SUBSCRIPTION(widget_wpm_status, zmk_wpm_state_changed);
 
+/*
+ * While the keyboard is idle the memory LCD keeps showing the last rendering
+ * by itself, so nothing is drawn: changes only accumulate as dirty sections
+ * and are drawn in one catch-up redraw on the next activity.
+ */
+static void set_activity_status(struct zmk_widget_status *widget,
+                                struct activity_status_state state) {
+    if (!IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SUSPEND_ON_IDLE) ||
+        widget->suspended != state.active) {
+        return;
+    }
+
+    widget->suspended = !state.active;
+    if (widget->suspended) {
+        k_work_cancel_delayable(&widget->redraw_work);
+        k_work_cancel_delayable(&widget->wpm_sample_work);
+        return;
+    }
+
+    if (widget->dirty) {
+        k_work_schedule_for_queue(zmk_display_work_q(), &widget->redraw_work, K_NO_WAIT);
+    }
+    if (!sparkline_settled(&widget->state.wpm, widget->latest_wpm)) {
+        schedule_wpm_sample(widget);
+    }
+}
+
+static void activity_status_update_cb(struct activity_status_state state) {
+    struct zmk_widget_status *widget;
+    SYS_SLIST_FOR_EACH_CONTAINER(&widgets, widget, node) { set_activity_status(widget, state); }
+}
+
+static struct activity_status_state activity_status_get_state(const zmk_event_t *eh) {
+    return (struct activity_status_state){
+        .active = zmk_activity_get_state() == ZMK_ACTIVITY_ACTIVE,
+    };
+}
+
+ZMK_DISPLAY_WIDGET_LISTENER(widget_activity_status, struct activity_status_state,
+                            activity_status_update_cb, activity_status_get_state)
+ZMK_SUBSCRIPTION(widget_activity_status, zmk_activity_state_changed);
+
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent) {
     widget->obj = lv_obj_create(parent);
     lv_obj_set_size(widget->obj, 160, 68);
-    lv_obj_t *top = lv_canvas_create(widget->obj);
-    lv_obj_align(top, LV_ALIGN_TOP_RIGHT, 0, 0);
-    lv_canvas_set_buffer(top, widget->cbuf, CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_NATIVE);
-    lv_canvas_set_palette(top, 0, LVGL_BACKGROUND_32);
-    lv_canvas_set_palette(top, 1, LVGL_FOREGROUND_32);
-    lv_obj_t *middle = lv_canvas_create(widget->obj);
-    lv_obj_align(middle, LV_ALIGN_TOP_LEFT, 24, 0);
-    lv_canvas_set_buffer(middle, widget->cbuf2, CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_NATIVE);
-    lv_canvas_set_palette(middle, 0, LVGL_BACKGROUND_32);
-    lv_canvas_set_palette(middle, 1, LVGL_FOREGROUND_32);
-    lv_obj_t *bottom = lv_canvas_create(widget->obj);
-    lv_obj_align(bottom, LV_ALIGN_TOP_LEFT, -44, 0);
-    lv_canvas_set_buffer(bottom, widget->cbuf3, CANVAS_SIZE, CANVAS_SIZE, LV_COLOR_FORMAT_NATIVE);
-    lv_canvas_set_palette(bottom, 0, LVGL_BACKGROUND_32);
-    lv_canvas_set_palette(bottom, 1, LVGL_FOREGROUND_32);
+    init_draw_descriptors();
+    for (int i = 0; i < SECTION_COUNT; i++) {
+        lv_obj_t *canvas = lv_canvas_create(widget->obj);
+        lv_obj_set_pos(canvas, sections[i].x, 0);
+        init_canvas(canvas, (uint8_t *)widget + sections[i].cbuf_offset);
+        widget->canvases[i] = canvas;
+    }
+    init_label_canvas(widget->obj);
+    for (int i = 0; i < SECTION_COUNT; i++) {
+        if (sections[i].draw_background != NULL) {
+            sections[i].draw_background(widget, widget->canvases[i]);
+        }
+    }
+    init_layer_bitmaps();
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_DIRECT_FRAMEBUFFER)
+    // Without a usable display the canvases just stay on the LVGL screen
+    if (compositor_init() == 0) {
+        for (int i = 0; i < SECTION_COUNT; i++) {
+            compositor_add(widget->canvases[i], sections[i].x);
+        }
+    }
+#endif
+    k_work_init_delayable(&widget->redraw_work, redraw_work_cb);
+    k_work_init_delayable(&widget->layer_settle_work, layer_settle_work_cb);
+    k_work_init_delayable(&widget->wpm_sample_work, wpm_sample_work_cb);
 
     sys_slist_append(&widgets, &widget->node);
     widget_battery_status_init();
     widget_output_status_init();
     widget_layer_status_init();
     widget_wpm_status_init();
+    widget_activity_status_init();
+    heap_monitor_check("init");
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_PROFILING)
+    render_stats_init();
+#endif
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_BENCHMARK)
+    benchmark_start(widget);
+#endif
 
     return 0;
 }
@@ -11,14 +11,53 @@
 #include <zephyr/kernel.h>
 #include "util.h"
 
+#define SECTION_TOP BIT(0)
+#define SECTION_MIDDLE BIT(1)
+#define SECTION_BOTTOM BIT(2)
+#define SECTION_COUNT 3
+
+// The inputs each section was last drawn from; a redraw whose fingerprint
+// matches would produce the same pixels and is skipped
+struct top_fingerprint {
+    uint8_t battery_fill;
+    bool charging;
+    uint8_t output_symbol;
+    uint8_t wpm;
+    uint8_t wpm_points[SPARKLINE_LEN];
+};
+
+struct middle_fingerprint {
+    int active_profile_index;
+};
+
+struct bottom_fingerprint {
+    uint8_t layer_index;
+};
+
 struct zmk_widget_status {
     sys_snode_t node;
     lv_obj_t *obj;
-    lv_color_t cbuf[CANVAS_SIZE * CANVAS_SIZE];
-    lv_color_t cbuf2[CANVAS_SIZE * CANVAS_SIZE];
-    lv_color_t cbuf3[CANVAS_SIZE * CANVAS_SIZE];
+    lv_obj_t *canvases[SECTION_COUNT];
+    uint8_t cbuf[CANVAS_BUF_SIZE(CANVAS_SIZE)] __aligned(LV_DRAW_BUF_ALIGN);
+    uint8_t cbuf2[CANVAS_BUF_SIZE(CANVAS_SIZE)] __aligned(LV_DRAW_BUF_ALIGN);
+    uint8_t cbuf3[CANVAS_BUF_SIZE(CANVAS_SIZE)] __aligned(LV_DRAW_BUF_ALIGN);
+    uint8_t top_bg[CANVAS_PIXELS_SIZE];
+    uint8_t middle_bg[CANVAS_PIXELS_SIZE];
+    uint8_t middle_selected_bg[CANVAS_PIXELS_SIZE];
     struct status_state state;
+    uint8_t dirty;
+    bool suspended;
+    uint8_t drawn;
+    struct top_fingerprint top_fp;
+    struct middle_fingerprint middle_fp;
+    struct bottom_fingerprint bottom_fp;
+    struct k_work_delayable redraw_work;
+    uint8_t pending_layer;
+    struct k_work_delayable layer_settle_work;
+    uint8_t latest_wpm;
+    struct k_work_delayable wpm_sample_work;
 };
 
 int zmk_widget_status_init(struct zmk_widget_status *widget, lv_obj_t *parent);
 lv_obj_t *zmk_widget_status_obj(struct zmk_widget_status *widget);
+void zmk_widget_status_redraw(struct zmk_widget_status *widget, uint8_t sections);
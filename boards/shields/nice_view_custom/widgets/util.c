@@ -5,78 +5,621 @@
  *
  */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include <zmk/display.h>
+
 #include "util.h"
+#include "render_stats.h"
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_DIRECT_FRAMEBUFFER)
+#include "compositor.h"
+#endif
 
 LV_IMAGE_DECLARE(bolt);
 
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]) {
-    uint32_t stride = lv_draw_buf_width_to_stride(CANVAS_SIZE, LV_COLOR_FORMAT_I1);
-    
-    // Copy source to temporary so we can overwrite source (which is `cbuf`)
-    static uint8_t src_tmp[CANVAS_SIZE * CANVAS_SIZE]; // Max size just to be safe
-    memcpy(src_tmp, cbuf, stride * CANVAS_SIZE);
-    
-    // Clear destination (cbuf)
-    memset(cbuf, 0, stride * CANVAS_SIZE);
-    
-    for (int y = 0; y < CANVAS_SIZE; y++) {
-        for (int x = 0; x < CANVAS_SIZE; x++) {
-            // Get pixel (x,y) from src_tmp
-            int src_byte = y * stride + (x / 8);
-            int src_bit = 7 - (x % 8);
-            uint8_t val = (src_tmp[src_byte] >> src_bit) & 0x1;
-            
-            if (val) {
-                // Rotate 90 degrees clockwise: (x, y) -> (height - 1 - y, x)
-                int new_x = CANVAS_SIZE - 1 - y;
-                int new_y = x;
-                
-                // Set pixel (new_x, new_y) in cbuf
-                int dst_byte = new_y * stride + (new_x / 8);
-                int dst_bit = 7 - (new_x % 8);
-                
-                ((uint8_t *)cbuf)[dst_byte] |= (1 << dst_bit);
+// Labels are rasterised upright by LVGL into this scratch canvas and then
+// turned into display orientation, so only their own pixels get rotated
+static lv_obj_t *label_canvas;
+static uint8_t label_cbuf[CANVAS_BUF_SIZE(LABEL_CANVAS_HEIGHT)] __aligned(LV_DRAW_BUF_ALIGN);
+
+// What the canvas being redrawn showed before clear_canvas(), so that only the
+// panel lines that actually changed get flushed afterwards
+static uint8_t previous_pixels[CANVAS_PIXELS_SIZE];
+
+// Which bit LVGL writes for LVGL_FOREGROUND, found on the first canvas
+static int8_t foreground_bit = -1;
+
+// Images whose palettes follow the runtime colour inversion
+struct palette_user {
+    lv_obj_t *obj;
+    lv_color32_t *palette;
+    uint8_t light_index;
+};
+
+#define MAX_PALETTE_USERS 4
+
+static struct palette_user palette_users[MAX_PALETTE_USERS];
+static size_t palette_user_count;
+static bool inverted = IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED);
+
+#define LABEL_CACHE_TEXT_LEN 24
+
+// A rendered label in display orientation, keyed by what it was drawn from
+struct label_cache_entry {
+    const lv_font_t *font;
+    lv_color_t color;
+    lv_text_align_t align;
+    uint8_t w;
+    uint8_t h;
+    bool bit;
+    uint32_t last_used;
+    char text[LABEL_CACHE_TEXT_LEN];
+    uint8_t mask[CANVAS_SIZE * LABEL_MASK_STRIDE];
+};
+
+static struct label_cache_entry label_cache[CONFIG_NICE_VIEW_WIDGET_LABEL_CACHE_SIZE];
+static uint32_t label_cache_clock;
+
+/*
+ * Transpose an 8x8 block of 1-bpp pixels, one row per byte with the leftmost
+ * pixel in the MSB. The rows are packed into two words and swapped in 1-, 2-
+ * and 4-bit steps (Hacker's Delight, 7-3), so bit 7 - c of row r ends up as
+ * bit 7 - r of row c.
+ */
+static inline void transpose_8x8(uint8_t block[8]) {
+    uint32_t x = ((uint32_t)block[0] << 24) | ((uint32_t)block[1] << 16) |
+                 ((uint32_t)block[2] << 8) | block[3];
+    uint32_t y = ((uint32_t)block[4] << 24) | ((uint32_t)block[5] << 16) |
+                 ((uint32_t)block[6] << 8) | block[7];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    block[0] = x >> 24;
+    block[1] = x >> 16;
+    block[2] = x >> 8;
+    block[3] = x;
+    block[4] = y >> 24;
+    block[5] = y >> 16;
+    block[6] = y >> 8;
+    block[7] = y;
+}
+
+void rotate_bits(const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+                 int32_t w, int32_t h) {
+    // Pixel (x, y) moves to (h - 1 - y, x). Counting source rows from the
+    // bottom keeps every destination byte aligned; rows above the top of the
+    // source read as zero, which also clears the destination padding bits.
+    for (int32_t by = 0; by * 8 < h; by++) {
+        for (int32_t bx = 0; bx * 8 < w; bx++) {
+            uint8_t block[8];
+
+            for (int r = 0; r < 8; r++) {
+                int32_t y = h - 1 - by * 8 - r;
+                block[r] = y >= 0 ? src[y * src_stride + bx] : 0;
+            }
+
+            transpose_8x8(block);
+
+            for (int c = 0; c < 8 && bx * 8 + c < w; c++) {
+                dst[(bx * 8 + c) * dst_stride + by] = block[c];
+            }
+        }
+    }
+}
+
+/*
+ * Merge a glyph mask in display orientation into a canvas with its top-left
+ * corner at (x, y). Mask bytes usually straddle two canvas bytes, so each one
+ * is split at the pixel offset of x.
+ */
+static void blit_mask(uint8_t *dst, const uint8_t *mask, uint32_t mask_stride, int32_t rows,
+                      int32_t x, int32_t y, bool value) {
+    int shift = x % 8;
+
+    for (int32_t i = 0; i < rows; i++) {
+        uint8_t *row = dst + (y + i) * CANVAS_STRIDE + x / 8;
+
+        for (uint32_t k = 0; k < mask_stride; k++) {
+            uint8_t bits = mask[i * mask_stride + k];
+            uint8_t hi = bits >> shift;
+            uint8_t lo = shift ? bits << (8 - shift) : 0;
+
+            if (value) {
+                row[k] |= hi;
+            } else {
+                row[k] &= ~hi;
+            }
+
+            if (lo) {
+                if (value) {
+                    row[k + 1] |= lo;
+                } else {
+                    row[k + 1] &= ~lo;
+                }
+            }
+        }
+    }
+}
+
+static uint8_t *canvas_pixels(lv_obj_t *canvas) {
+    return lv_draw_buf_goto_xy(lv_canvas_get_draw_buf(canvas), 0, 0);
+}
+
+static uint8_t background_fill(void) { return foreground_bit ? 0x00 : 0xFF; }
+
+static void write_palette(const struct palette_user *user) {
+    lv_color32_t light = lv_color32_make(255, 255, 255, 255);
+    lv_color32_t dark = lv_color32_make(0, 0, 0, 255);
+
+    user->palette[user->light_index] = inverted ? dark : light;
+    user->palette[!user->light_index] = inverted ? light : dark;
+}
+
+/*
+ * Hand the two-entry palette of an I1 image to the inversion handling.
+ * light_index is the colour index that shows white when not inverted.
+ */
+void register_palette(lv_obj_t *obj, lv_color32_t *palette, uint8_t light_index) {
+    __ASSERT(palette_user_count < ARRAY_SIZE(palette_users), "Too many palette users");
+
+    struct palette_user *user = &palette_users[palette_user_count++];
+    user->obj = obj;
+    user->palette = palette;
+    user->light_index = light_index;
+    write_palette(user);
+}
+
+bool display_inverted(void) { return inverted; }
+
+// Swap every registered palette in place; no pixel data is touched
+void set_display_inverted(bool value) {
+    inverted = value;
+
+    for (size_t i = 0; i < palette_user_count; i++) {
+        write_palette(&palette_users[i]);
+        lv_image_cache_drop(lv_image_get_src(palette_users[i].obj));
+        lv_obj_invalidate(palette_users[i].obj);
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_DIRECT_FRAMEBUFFER)
+    // Canvases shown by the compositor have no palette on screen
+    compositor_refresh();
+#endif
+}
+
+/*
+ * Descriptors used on every redraw. They are built with the foreground bit
+ * probe, so before anything is drawn, and only their text changes later.
+ */
+static lv_draw_rect_dsc_t foreground_rect_dsc;
+static lv_draw_rect_dsc_t background_rect_dsc;
+static lv_draw_label_dsc_t layer_label_dsc;
+
+// Layer names are only drawn where Kconfig builds in their font
+#define DRAWS_LAYER_LABELS                                                                        \
+    (!IS_ENABLED(CONFIG_ZMK_SPLIT) || IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) ||                \
+     IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT))
+
+static void init_draw_descriptors(void) {
+    init_rect_dsc(&foreground_rect_dsc, LVGL_FOREGROUND);
+    init_rect_dsc(&background_rect_dsc, LVGL_BACKGROUND);
+#if DRAWS_LAYER_LABELS
+    init_label_dsc(&layer_label_dsc, LVGL_FOREGROUND, &lv_font_montserrat_14,
+                   LV_TEXT_ALIGN_CENTER);
+#endif
+}
+
+/*
+ * Find out which bit LVGL writes for the foreground colour, so cleared
+ * canvases, direct pixel writes and palettes all agree with what it renders.
+ */
+static void probe_foreground_bit(lv_obj_t *canvas) {
+    lv_area_t pixel = {0, 0, 0, 0};
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect(&layer, &foreground_rect_dsc, &pixel);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    foreground_bit = canvas_pixels(canvas)[0] >> 7;
+}
+
+uint8_t canvas_foreground_bit(void) { return foreground_bit; }
+
+void init_canvas(lv_obj_t *canvas, uint8_t cbuf[]) {
+    lv_canvas_set_buffer(canvas, cbuf, CANVAS_SIZE, CANVAS_SIZE, CANVAS_COLOR_FORMAT);
+    if (foreground_bit < 0) {
+        init_draw_descriptors();
+        probe_foreground_bit(canvas);
+    }
+
+    register_palette(canvas, (lv_color32_t *)cbuf, !foreground_bit);
+    memset(canvas_pixels(canvas), background_fill(), CANVAS_PIXELS_SIZE);
+}
+
+void init_label_canvas(lv_obj_t *parent) {
+    if (label_canvas != NULL) {
+        return;
+    }
+
+    label_canvas = lv_canvas_create(parent);
+    lv_obj_add_flag(label_canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(label_canvas, label_cbuf, CANVAS_SIZE, LABEL_CANVAS_HEIGHT,
+                         CANVAS_COLOR_FORMAT);
+}
+
+void clear_canvas(lv_obj_t *canvas) {
+    uint8_t *pixels = canvas_pixels(canvas);
+    memcpy(previous_pixels, pixels, CANVAS_PIXELS_SIZE);
+    memset(pixels, background_fill(), CANVAS_PIXELS_SIZE);
+}
+
+void save_canvas(lv_obj_t *canvas, uint8_t background[]) {
+    memcpy(background, canvas_pixels(canvas), CANVAS_PIXELS_SIZE);
+}
+
+// Like clear_canvas(), but start from a background saved at init
+void restore_canvas(lv_obj_t *canvas, const uint8_t background[]) {
+    uint8_t *pixels = canvas_pixels(canvas);
+    memcpy(previous_pixels, pixels, CANVAS_PIXELS_SIZE);
+    memcpy(pixels, background, CANVAS_PIXELS_SIZE);
+}
+
+// Copy a rectangle, in display orientation, from a saved background
+void copy_canvas_area(lv_obj_t *canvas, const uint8_t background[], const lv_area_t *area) {
+    uint8_t *pixels = canvas_pixels(canvas);
+
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t bx = area->x1 / 8; bx <= area->x2 / 8; bx++) {
+            int32_t first = MAX(area->x1 - bx * 8, 0);
+            int32_t last = MIN(area->x2 - bx * 8, 7);
+            uint8_t mask = (0xFF >> first) & (0xFF << (7 - last));
+            uint32_t i = y * CANVAS_STRIDE + bx;
+            pixels[i] = (pixels[i] & ~mask) | (background[i] & mask);
+        }
+    }
+}
+
+/*
+ * Invalidate the band of canvas rows that differ from what clear_canvas()
+ * saved. Canvas rows are panel lines, and the LS0xx is line addressed, so
+ * the flush only sends the lines that changed instead of all 68.
+ */
+void invalidate_canvas_changes(lv_obj_t *canvas) {
+    const uint8_t *pixels = canvas_pixels(canvas);
+    int32_t first = -1;
+    int32_t last = -1;
+
+    for (int32_t y = 0; y < CANVAS_SIZE; y++) {
+        if (memcmp(pixels + y * CANVAS_STRIDE, previous_pixels + y * CANVAS_STRIDE,
+                   CANVAS_STRIDE) != 0) {
+            if (first < 0) {
+                first = y;
+            }
+            last = y;
+        }
+    }
+
+    if (first < 0) {
+        return;
+    }
+
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_DIRECT_FRAMEBUFFER)
+    // Sections shown by the compositor only copy the changed band to the frame
+    compositor_blit(canvas, first, last);
+#endif
+
+    lv_area_t area;
+    lv_obj_get_coords(canvas, &area);
+    area.y2 = area.y1 + last;
+    area.y1 += first;
+    lv_obj_invalidate_area(canvas, &area);
+}
+
+lv_area_t rotate_area(lv_area_t area) {
+    return (lv_area_t){CANVAS_SIZE - 1 - area.y2, area.x1, CANVAS_SIZE - 1 - area.y1, area.x2};
+}
+
+lv_point_t rotate_point(lv_point_t point) {
+    return (lv_point_t){CANVAS_SIZE - 1 - point.y, point.x};
+}
+
+void draw_rotated_rect(lv_layer_t *layer, const lv_draw_rect_dsc_t *rect_dsc, lv_area_t area) {
+    lv_area_t rotated = rotate_area(area);
+    lv_draw_rect(layer, rect_dsc, &rotated);
+}
+
+/*
+ * Draw a 1 px polyline straight into the canvas pixels with Bresenham, in
+ * display orientation, without going through the generic line renderer per
+ * segment. This only approximates lv_draw_line: LVGL anti-aliases 1 px lines
+ * and thresholds them to 1 bpp, and its end points can differ by a pixel.
+ */
+void draw_rotated_polyline(lv_obj_t *canvas, const lv_point_t *points, int count) {
+    uint8_t *pixels = canvas_pixels(canvas);
+
+    for (int i = 0; i + 1 < count; i++) {
+        lv_point_t p = rotate_point(points[i]);
+        lv_point_t end = rotate_point(points[i + 1]);
+        int32_t dx = abs(end.x - p.x);
+        int32_t dy = -abs(end.y - p.y);
+        int32_t sx = p.x < end.x ? 1 : -1;
+        int32_t sy = p.y < end.y ? 1 : -1;
+        int32_t err = dx + dy;
+
+        while (true) {
+            uint8_t *byte = &pixels[p.y * CANVAS_STRIDE + p.x / 8];
+            uint8_t bit = 0x80 >> (p.x % 8);
+            *byte = foreground_bit ? *byte | bit : *byte & ~bit;
+            if (p.x == end.x && p.y == end.y) {
+                break;
+            }
+
+            int32_t e2 = 2 * err;
+            if (e2 >= dy) {
+                err += dy;
+                p.x += sx;
             }
+            if (e2 <= dx) {
+                err += dx;
+                p.y += sy;
+            }
+        }
+    }
+}
+
+/*
+ * Rasterise a label upright in the scratch canvas and turn it into a glyph
+ * mask in display orientation. Returns the bit LVGL used for the text colour.
+ */
+static bool render_label_mask(const lv_draw_label_dsc_t *label_dsc, int32_t w, int32_t h,
+                              uint8_t *mask) {
+    // Render the text upright in the scratch canvas, on top of the other
+    // status colour so its pixels can be told apart from the background.
+    // The row below the text area never receives any text.
+    const lv_draw_rect_dsc_t *rect_dsc = lv_color_eq(label_dsc->color, LVGL_FOREGROUND)
+                                             ? &background_rect_dsc
+                                             : &foreground_rect_dsc;
+    lv_draw_label_dsc_t dsc = *label_dsc;
+    lv_area_t bg_area = {0, 0, CANVAS_SIZE - 1, LABEL_CANVAS_HEIGHT - 1};
+    lv_area_t text_area = {0, 0, w - 1, h - 1};
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(label_canvas, &layer);
+    lv_draw_rect(&layer, rect_dsc, &bg_area);
+    lv_draw_label(&layer, &dsc, &text_area);
+    lv_canvas_finish_layer(label_canvas, &layer);
+
+    uint8_t *src = canvas_pixels(label_canvas);
+    bool bg_bit = src[h * CANVAS_STRIDE] & 0x80;
+    if (bg_bit) {
+        for (int32_t i = 0; i < h * CANVAS_STRIDE; i++) {
+            src[i] = ~src[i];
+        }
+    }
+
+    rotate_bits(src, CANVAS_STRIDE, mask, (h + 7) / 8, w, h);
+
+    return !bg_bit;
+}
+
+static bool label_cache_matches(const struct label_cache_entry *entry,
+                                const lv_draw_label_dsc_t *label_dsc, int32_t w, int32_t h) {
+    return entry->font == label_dsc->font && lv_color_eq(entry->color, label_dsc->color) &&
+           entry->align == label_dsc->align && entry->w == w && entry->h == h &&
+           strcmp(entry->text, label_dsc->text) == 0;
+}
+
+/*
+ * Find the cached mask for a label, or claim the least recently used slot and
+ * render into it. Returns NULL for text too long to be used as a key.
+ */
+static struct label_cache_entry *label_cache_get(const lv_draw_label_dsc_t *label_dsc, int32_t w,
+                                                 int32_t h) {
+    if (ARRAY_SIZE(label_cache) == 0 || strlen(label_dsc->text) >= LABEL_CACHE_TEXT_LEN) {
+        return NULL;
+    }
+
+    struct label_cache_entry *victim = &label_cache[0];
+    for (size_t i = 0; i < ARRAY_SIZE(label_cache); i++) {
+        struct label_cache_entry *entry = &label_cache[i];
+        if (entry->font != NULL && label_cache_matches(entry, label_dsc, w, h)) {
+            entry->last_used = ++label_cache_clock;
+            return entry;
+        }
+        if (victim->font != NULL &&
+            (entry->font == NULL || entry->last_used < victim->last_used)) {
+            victim = entry;
         }
     }
-    
-    lv_obj_invalidate(canvas);
+
+    victim->font = label_dsc->font;
+    victim->color = label_dsc->color;
+    victim->align = label_dsc->align;
+    victim->w = w;
+    victim->h = h;
+    strcpy(victim->text, label_dsc->text);
+    RENDER_STAT_TIME(RENDER_STAT_LABEL,
+                     victim->bit = render_label_mask(label_dsc, w, h, victim->mask));
+    victim->last_used = ++label_cache_clock;
+    return victim;
 }
 
-void draw_battery(lv_layer_t *layer, const struct status_state *state) {
-    lv_draw_rect_dsc_t rect_black_dsc;
-    init_rect_dsc(&rect_black_dsc, LVGL_BACKGROUND);
-    lv_draw_rect_dsc_t rect_white_dsc;
-    init_rect_dsc(&rect_white_dsc, LVGL_FOREGROUND);
+// Masks of uncached labels; all drawing happens on the display work queue
+static uint8_t uncached_mask[CANVAS_SIZE * LABEL_MASK_STRIDE];
+
+static void draw_label(lv_obj_t *canvas, const lv_draw_label_dsc_t *label_dsc,
+                       const lv_area_t *area, bool cached) {
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
 
-    lv_area_t rect;
+    __ASSERT_NO_MSG(area->x1 >= 0 && area->x2 < CANVAS_SIZE);
+    __ASSERT_NO_MSG(area->y1 >= 0 && area->y2 < CANVAS_SIZE);
+    __ASSERT_NO_MSG(h < LABEL_CANVAS_HEIGHT);
 
-    rect = (lv_area_t){0, 2, 29, 13};
-    lv_draw_rect(layer, &rect_white_dsc, &rect);
+    const uint8_t *mask;
+    bool bit;
+    struct label_cache_entry *entry = cached ? label_cache_get(label_dsc, w, h) : NULL;
+    if (entry != NULL) {
+        mask = entry->mask;
+        bit = entry->bit;
+    } else {
+        RENDER_STAT_TIME(RENDER_STAT_LABEL,
+                         bit = render_label_mask(label_dsc, w, h, uncached_mask));
+        mask = uncached_mask;
+    }
 
-    rect = (lv_area_t){1, 3, 27, 12};
-    lv_draw_rect(layer, &rect_black_dsc, &rect);
+    // Paint the glyph mask with the bit LVGL used for the text colour
+    blit_mask(canvas_pixels(canvas), mask, (h + 7) / 8, w, CANVAS_SIZE - 1 - area->y2, area->x1,
+              bit);
+}
 
-    rect = (lv_area_t){2, 4, 2 + (state->battery + 2) / 4, 11};
-    lv_draw_rect(layer, &rect_white_dsc, &rect);
+// Labels from a small set (profile digits, symbols, layer names) mostly reuse
+// a cached mask instead of rasterising the font again
+void draw_rotated_label(lv_obj_t *canvas, const lv_draw_label_dsc_t *label_dsc,
+                        const lv_area_t *area) {
+    draw_label(canvas, label_dsc, area, true);
+}
 
-    rect = (lv_area_t){30, 5, 32, 10};
-    lv_draw_rect(layer, &rect_white_dsc, &rect);
+/*
+ * For text that keeps changing, like the WPM count. It would rarely be drawn
+ * twice from the cache and would evict the labels that are.
+ */
+void draw_rotated_label_uncached(lv_obj_t *canvas, const lv_draw_label_dsc_t *label_dsc,
+                                 const lv_area_t *area) {
+    draw_label(canvas, label_dsc, area, false);
+}
 
-    rect = (lv_area_t){31, 6, 31, 9};
-    lv_draw_rect(layer, &rect_black_dsc, &rect);
+#define LAYER_TEXT_LEN 12
 
-    if (state->charging) {
+// Layers without a name in the keymap are shown by number
+static void set_layer_label_text(uint8_t index, const char *label, char text[LAYER_TEXT_LEN]) {
+    if (label == NULL) {
+        snprintf(text, LAYER_TEXT_LEN, "LAYER %i", index);
+        layer_label_dsc.text = text;
+    } else {
+        layer_label_dsc.text = label;
+    }
+}
+
+void draw_layer_label(lv_obj_t *canvas, uint8_t index, const char *label,
+                      const lv_area_t *area) {
+    char text[LAYER_TEXT_LEN] = {};
+    set_layer_label_text(index, label, text);
+
+    draw_rotated_label(canvas, &layer_label_dsc, area);
+}
+
+void render_layer_bitmap(uint8_t index, const char *label, const lv_area_t *area,
+                         struct label_bitmap *bitmap) {
+    __ASSERT_NO_MSG(lv_area_get_height(area) < LABEL_CANVAS_HEIGHT);
+
+    char text[LAYER_TEXT_LEN] = {};
+    set_layer_label_text(index, label, text);
+
+    bitmap->bit = render_label_mask(&layer_label_dsc, lv_area_get_width(area),
+                                    lv_area_get_height(area), bitmap->mask);
+}
+
+// The area must have the size the bitmap was rendered for
+void blit_label_bitmap(lv_obj_t *canvas, const struct label_bitmap *bitmap,
+                       const lv_area_t *area) {
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    blit_mask(canvas_pixels(canvas), bitmap->mask, (h + 7) / 8, w, CANVAS_SIZE - 1 - area->y2,
+              area->x1, bitmap->bit);
+}
+
+// The battery body and tip never change, so sections bake them into their background
+void draw_battery_outline(lv_layer_t *layer) {
+    draw_rotated_rect(layer, &foreground_rect_dsc, (lv_area_t){0, 2, 29, 13});
+    draw_rotated_rect(layer, &background_rect_dsc, (lv_area_t){1, 3, 27, 12});
+    draw_rotated_rect(layer, &foreground_rect_dsc, (lv_area_t){30, 5, 32, 10});
+    draw_rotated_rect(layer, &background_rect_dsc, (lv_area_t){31, 6, 31, 9});
+}
+
+/*
+ * Canvas rows 0-32 hold the battery along the logical x axis and the bytes
+ * from 6 on cover it and the bolt across. The fill only ever grows by whole
+ * rows, so any charge level is made of rows from a full and an empty sprite.
+ */
+#define BATTERY_ROWS 33
+#define BATTERY_FIRST_BYTE 6
+#define BATTERY_BYTES (CANVAS_STRIDE - BATTERY_FIRST_BYTE)
+#define BATTERY_FILL_ROW 2
+#define BATTERY_MAX_FILL 25
+
+// Indexed by charging, then full
+static uint8_t battery_sprites[2][2][BATTERY_ROWS][BATTERY_BYTES];
+
+static int battery_fill(uint8_t level) { return MIN((level + 2) / 4, BATTERY_MAX_FILL); }
+
+static void render_battery(lv_layer_t *layer, int fill, bool charging) {
+    draw_rotated_rect(layer, &foreground_rect_dsc,
+                      (lv_area_t){BATTERY_FILL_ROW, 4, BATTERY_FILL_ROW + fill, 11});
+
+    if (charging) {
         lv_draw_image_dsc_t img_dsc;
         lv_draw_image_dsc_init(&img_dsc);
         img_dsc.src = &bolt;
-        
-        lv_area_t img_area = {9, -1, 9 + bolt.header.w - 1, -1 + bolt.header.h - 1};
+
+        // `bolt` is stored pre-rotated, so its width runs along the logical y axis
+        lv_area_t img_area =
+            rotate_area((lv_area_t){9, -1, 9 + bolt.header.h - 1, -1 + bolt.header.w - 1});
         lv_draw_image(layer, &img_dsc, &img_area);
     }
 }
 
+// Render the four sprites with LVGL once, on top of the section background
+void init_battery_sprites(lv_obj_t *canvas, const uint8_t background[]) {
+    for (int charging = 0; charging < 2; charging++) {
+        for (int full = 0; full < 2; full++) {
+            restore_canvas(canvas, background);
+
+            lv_layer_t layer;
+            lv_canvas_init_layer(canvas, &layer);
+            render_battery(&layer, full ? BATTERY_MAX_FILL : 0, charging);
+            lv_canvas_finish_layer(canvas, &layer);
+
+            const uint8_t *pixels = canvas_pixels(canvas);
+            for (int row = 0; row < BATTERY_ROWS; row++) {
+                memcpy(battery_sprites[charging][full][row],
+                       pixels + row * CANVAS_STRIDE + BATTERY_FIRST_BYTE, BATTERY_BYTES);
+            }
+        }
+    }
+
+    restore_canvas(canvas, background);
+}
+
+// Rows up to the end of the fill come from the full sprite, the rest from the empty one
+void draw_battery(lv_obj_t *canvas, const struct status_state *state) {
+    int last_filled = BATTERY_FILL_ROW + battery_fill(state->battery);
+    uint8_t *pixels = canvas_pixels(canvas);
+
+    for (int row = 0; row < BATTERY_ROWS; row++) {
+        memcpy(pixels + row * CANVAS_STRIDE + BATTERY_FIRST_BYTE,
+               battery_sprites[state->charging][row <= last_filled][row], BATTERY_BYTES);
+    }
+}
+
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
                     lv_text_align_t align) {
     lv_draw_label_dsc_init(label_dsc);
@@ -90,14 +633,41 @@ void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color) {
     rect_dsc->bg_color = bg_color;
 }
 
-void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width) {
-    lv_draw_line_dsc_init(line_dsc);
-    line_dsc->color = color;
-    line_dsc->width = width;
-}
-
 void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width) {
     lv_draw_arc_dsc_init(arc_dsc);
     arc_dsc->color = color;
     arc_dsc->width = width;
 }
+
+#if IS_ENABLED(CONFIG_SHELL)
+static atomic_t requested_inverted;
+
+// LVGL belongs to the display work queue, so the shell only queues the change
+static void invert_work_cb(struct k_work *work) {
+    set_display_inverted(atomic_get(&requested_inverted));
+}
+
+static K_WORK_DEFINE(invert_work, invert_work_cb);
+
+static int cmd_invert(const struct shell *sh, size_t argc, char **argv) {
+    bool value = !inverted;
+
+    if (argc > 1) {
+        if (strcmp(argv[1], "on") == 0) {
+            value = true;
+        } else if (strcmp(argv[1], "off") == 0) {
+            value = false;
+        } else {
+            shell_error(sh, "Expected on or off");
+            return -EINVAL;
+        }
+    }
+
+    atomic_set(&requested_inverted, value);
+    k_work_submit_to_queue(zmk_display_work_q(), &invert_work);
+    return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(nice_view_invert, NULL, "Invert the nice!view colours [on|off]",
+                       cmd_invert, 1, 1);
+#endif
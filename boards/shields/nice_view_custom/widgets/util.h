@@ -8,17 +8,27 @@
 #include <lvgl.h>
 #include <zmk/endpoints.h>
 
-#define CANVAS_SIZE 68
+#include "sparkline.h"
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+#include "split_snapshot.h"
+#endif
 
-#define LVGL_BACKGROUND                                                                            \
-    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_black() : lv_color_white()
-#define LVGL_FOREGROUND                                                                            \
-    IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? lv_color_white() : lv_color_black()
+#define CANVAS_SIZE 68
+#define CANVAS_COLOR_FORMAT LV_COLOR_FORMAT_I1
+#define CANVAS_STRIDE LV_DRAW_BUF_STRIDE(CANVAS_SIZE, CANVAS_COLOR_FORMAT)
+#define CANVAS_PALETTE_SIZE                                                                       \
+    (LV_COLOR_INDEXED_PALETTE_SIZE(CANVAS_COLOR_FORMAT) * sizeof(lv_color32_t))
+// I1 draw buffers hold the palette followed by the pixel rows
+#define CANVAS_BUF_SIZE(height) (CANVAS_PALETTE_SIZE + CANVAS_STRIDE * (height))
+// Pixel rows of a canvas without the palette, as kept for static backgrounds
+#define CANVAS_PIXELS_SIZE (CANVAS_STRIDE * CANVAS_SIZE)
+// Labels are at most this tall, so their masks are this many bytes per column
+#define LABEL_CANVAS_HEIGHT 32
+#define LABEL_MASK_STRIDE ((LABEL_CANVAS_HEIGHT + 7) / 8)
 
-#define LVGL_BACKGROUND_32                                                                         \
-    (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? ((lv_color32_t){.red=0, .green=0, .blue=0, .alpha=0}) : ((lv_color32_t){.red=255, .green=255, .blue=255, .alpha=0}))
-#define LVGL_FOREGROUND_32                                                                         \
-    (IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_INVERTED) ? ((lv_color32_t){.red=255, .green=255, .blue=255, .alpha=255}) : ((lv_color32_t){.red=0, .green=0, .blue=0, .alpha=255}))
+// Drawing always uses the normal colours; inversion only swaps palettes
+#define LVGL_BACKGROUND lv_color_white()
+#define LVGL_FOREGROUND lv_color_black()
 
 struct status_state {
     uint8_t battery;
@@ -29,13 +39,26 @@ struct status_state {
     bool active_profile_connected;
     bool active_profile_bonded;
     uint8_t layer_index;
-    const char *layer_label;
-    uint8_t wpm[10];
+    struct sparkline wpm;
 #else
     bool connected;
+#if IS_ENABLED(CONFIG_NICE_VIEW_WIDGET_SPLIT_SNAPSHOT)
+    bool snapshot_valid;
+    struct split_snapshot snapshot;
+#endif
 #endif
 };
 
+// A label rendered ahead of time, ready to be blitted into a fixed area
+struct label_bitmap {
+    bool bit;
+    uint8_t mask[CANVAS_SIZE * LABEL_MASK_STRIDE];
+};
+
+struct activity_status_state {
+    bool active;
+};
+
 struct battery_status_state {
     uint8_t level;
 #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
@@ -43,10 +66,37 @@ struct battery_status_state {
 #endif
 };
 
-void rotate_canvas(lv_obj_t *canvas, lv_color_t cbuf[]);
-void draw_battery(lv_layer_t *layer, const struct status_state *state);
+void rotate_bits(const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+                 int32_t w, int32_t h);
+void register_palette(lv_obj_t *obj, lv_color32_t *palette, uint8_t light_index);
+bool display_inverted(void);
+void set_display_inverted(bool inverted);
+uint8_t canvas_foreground_bit(void);
+void init_canvas(lv_obj_t *canvas, uint8_t cbuf[]);
+void init_label_canvas(lv_obj_t *parent);
+void clear_canvas(lv_obj_t *canvas);
+void save_canvas(lv_obj_t *canvas, uint8_t background[]);
+void restore_canvas(lv_obj_t *canvas, const uint8_t background[]);
+void copy_canvas_area(lv_obj_t *canvas, const uint8_t background[], const lv_area_t *area);
+void invalidate_canvas_changes(lv_obj_t *canvas);
+lv_area_t rotate_area(lv_area_t area);
+lv_point_t rotate_point(lv_point_t point);
+void draw_rotated_rect(lv_layer_t *layer, const lv_draw_rect_dsc_t *rect_dsc, lv_area_t area);
+void draw_rotated_polyline(lv_obj_t *canvas, const lv_point_t *points, int count);
+void draw_rotated_label(lv_obj_t *canvas, const lv_draw_label_dsc_t *label_dsc,
+                        const lv_area_t *area);
+void draw_rotated_label_uncached(lv_obj_t *canvas, const lv_draw_label_dsc_t *label_dsc,
+                                 const lv_area_t *area);
+void draw_layer_label(lv_obj_t *canvas, uint8_t index, const char *label,
+                      const lv_area_t *area);
+void render_layer_bitmap(uint8_t index, const char *label, const lv_area_t *area,
+                         struct label_bitmap *bitmap);
+void blit_label_bitmap(lv_obj_t *canvas, const struct label_bitmap *bitmap,
+                       const lv_area_t *area);
+void draw_battery_outline(lv_layer_t *layer);
+void init_battery_sprites(lv_obj_t *canvas, const uint8_t background[]);
+void draw_battery(lv_obj_t *canvas, const struct status_state *state);
 void init_label_dsc(lv_draw_label_dsc_t *label_dsc, lv_color_t color, const lv_font_t *font,
                     lv_text_align_t align);
 void init_rect_dsc(lv_draw_rect_dsc_t *rect_dsc, lv_color_t bg_color);
-void init_line_dsc(lv_draw_line_dsc_t *line_dsc, lv_color_t color, uint8_t width);
 void init_arc_dsc(lv_draw_arc_dsc_t *arc_dsc, lv_color_t color, uint8_t width);
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Frame codec for the nice!view slideshow art.
+
+Frames are 1-bpp rows, MSB first, padded to whole bytes. They are stored
+either raw or LZSS-compressed; the decoder lives in widgets/art_decoder.c
+and both sides must agree on the constants below.
+
+LZSS stream: a flag byte announces the next eight items, MSB first. A clear
+bit is one literal byte, a set bit a two-byte big-endian back-reference with
+the distance minus one in the upper OFFSET_BITS and the length minus
+MIN_MATCH in the lower LENGTH_BITS.
+"""
+
+ENCODING_RAW = 0
+ENCODING_LZSS = 1
+
+OFFSET_BITS = 11
+LENGTH_BITS = 16 - OFFSET_BITS
+MIN_MATCH = 3
+MAX_OFFSET = 1 << OFFSET_BITS
+MAX_MATCH = (1 << LENGTH_BITS) - 1 + MIN_MATCH
+
+
+def lzss_encode(data):
+    items = []
+    i = 0
+    while i < len(data):
+        best_len = 0
+        best_off = 0
+        for j in range(max(0, i - MAX_OFFSET), i):
+            n = 0
+            while n < MAX_MATCH and i + n < len(data) and data[j + n] == data[i + n]:
+                n += 1
+            if n > best_len:
+                best_len, best_off = n, i - j
+        if best_len >= MIN_MATCH:
+            items.append((best_off, best_len))
+            i += best_len
+        else:
+            items.append(data[i])
+            i += 1
+
+    out = bytearray()
+    for start in range(0, len(items), 8):
+        group = items[start:start + 8]
+        flags = 0
+        for bit, item in enumerate(group):
+            if isinstance(item, tuple):
+                flags |= 0x80 >> bit
+        out.append(flags)
+        for item in group:
+            if isinstance(item, tuple):
+                ref = ((item[0] - 1) << LENGTH_BITS) | (item[1] - MIN_MATCH)
+                out += bytes((ref >> 8, ref & 0xFF))
+            else:
+                out.append(item)
+    return bytes(out)
+
+
+def lzss_decode(data, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        flags = data[i]
+        i += 1
+        for bit in range(8):
+            if len(out) >= size:
+                break
+            if flags & (0x80 >> bit):
+                ref = (data[i] << 8) | data[i + 1]
+                i += 2
+                offset = (ref >> LENGTH_BITS) + 1
+                for _ in range((ref & ((1 << LENGTH_BITS) - 1)) + MIN_MATCH):
+                    out.append(out[-offset])
+            else:
+                out.append(data[i])
+                i += 1
+    return bytes(out)
+
+
+def encode_frame(pixels):
+    """Return (encoding, payload), picking whichever is smaller."""
+    packed = lzss_encode(pixels)
+    assert lzss_decode(packed, len(pixels)) == pixels
+    if len(packed) < len(pixels):
+        return ENCODING_LZSS, packed
+    return ENCODING_RAW, bytes(pixels)
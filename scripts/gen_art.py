@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+#
+"""Pack a directory of slideshow images into widgets/art.c or an art pack.
+
+Every PNG is thresholded to 1 bpp (light pixels set), checked against the
+140x68 frame size and encoded raw or LZSS, whichever is smaller. Identical
+frames share one payload. All payloads go into a single blob behind the
+art_frames[] table, and a per-frame flash report is printed and written at
+the top of the generated file.
+
+With --pack, the same blob and table are also written as a binary art pack
+for the art_partition flash partition (see widgets/art_pack.c):
+
+    header  "NVAP", u8 version, u8 reserved, u16 frame count, u16 width,
+            u16 height, u32 data size, u32 CRC-32 of everything after the
+            header
+    table   per frame: u32 data offset, u16 size, u8 encoding, u8 reserved
+    data    the frame payloads
+
+All fields are little endian.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import art_codec  # noqa: E402
+
+WIDTH = 140
+HEIGHT = 68
+STRIDE = (WIDTH + 7) // 8
+
+PACK_MAGIC = b"NVAP"
+PACK_VERSION = 1
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def read_png(path):
+    """Return (width, height, pixels) with pixels as rows of 0/1 values."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = len(PNG_SIGNATURE)
+    idat = bytearray()
+    palette = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, length, 3)]
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError(f"{path}: interlaced PNGs are not supported")
+    if color not in CHANNELS or (depth == 16 and color == 3):
+        raise ValueError(f"{path}: unsupported color type {color}")
+
+    raw = zlib.decompress(bytes(idat))
+    channels = CHANNELS[color]
+    bpp = max(1, channels * depth // 8)
+    row_bytes = (width * channels * depth + 7) // 8
+
+    rows = []
+    prev = bytearray(row_bytes)
+    pos = 0
+    for _ in range(height):
+        kind = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + row_bytes])
+        pos += 1 + row_bytes
+        for i in range(row_bytes):
+            left = line[i - bpp] if i >= bpp else 0
+            up = prev[i]
+            up_left = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xFF
+            elif kind == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                pred = left if pa <= pb and pa <= pc else up if pb <= pc else up_left
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def samples(line):
+        if depth >= 8:
+            step = depth // 8
+            return [line[i] for i in range(0, len(line), step)]
+        per_byte = 8 // depth
+        mask = (1 << depth) - 1
+        return [(line[i // per_byte] >> (8 - depth * (i % per_byte + 1))) & mask
+                for i in range(width * channels)]
+
+    scale = 255 // ((1 << min(depth, 8)) - 1)
+    pixels = []
+    for line in rows:
+        values = samples(line)
+        out = []
+        for x in range(width):
+            px = values[x * channels:(x + 1) * channels]
+            if color == 3:
+                r, g, b = palette[px[0]]
+                alpha = 255
+            elif color in (0, 4):
+                r = g = b = px[0] * scale
+                alpha = px[1] * scale if color == 4 else 255
+            else:
+                r, g, b = px[:3]
+                alpha = px[3] if color == 6 else 255
+            luma = (r * 299 + g * 587 + b * 114) // 1000
+            out.append(1 if alpha >= 128 and luma >= 128 else 0)
+        pixels.append(out)
+    return width, height, pixels
+
+
+def pack_rows(pixels):
+    data = bytearray()
+    for row in pixels:
+        for x in range(0, WIDTH, 8):
+            byte = 0
+            for bit, value in enumerate(row[x:x + 8]):
+                byte |= value << (7 - bit)
+            data.append(byte)
+    return bytes(data)
+
+
+def write_c(path, header, blob, frames, report):
+    encodings = {
+        art_codec.ENCODING_RAW: "ART_ENCODING_RAW",
+        art_codec.ENCODING_LZSS: "ART_ENCODING_LZSS",
+    }
+
+    out = ["/*", " * Generated by scripts/gen_art.py, do not edit.", " *"]
+    out += [f" * {line}" for line in report]
+    out += [" */", "", f'#include "{header}"', ""]
+    out.append("static const LV_ATTRIBUTE_LARGE_CONST uint8_t art_blob[] = {")
+    for i in range(0, len(blob), 18):
+        out.append("  " + " ".join(f"0x{b:02x}," for b in blob[i:i + 18]))
+    out += ["};", "", "const struct art_frame art_frames[] = {"]
+    for name, offset, size, encoding in frames:
+        out.append(f"    {{art_blob + {offset}, {size}, {encodings[encoding]}}}, /* {name} */")
+    out += ["};", "", "const size_t art_frame_count = ARRAY_SIZE(art_frames);", ""]
+
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+
+def write_pack(path, blob, frames):
+    body = b"".join(struct.pack("<IHBB", offset, size, encoding, 0)
+                    for _, offset, size, encoding in frames) + bytes(blob)
+    header = PACK_MAGIC + struct.pack("<BBHHHII", PACK_VERSION, 0, len(frames), WIDTH, HEIGHT,
+                                      len(blob), zlib.crc32(body))
+
+    os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+    with open(path, "wb") as f:
+        f.write(header + body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--output", help="generated C source")
+    parser.add_argument("--pack", help="binary art pack for the art_partition flash partition")
+    parser.add_argument("--header", default="art.h", help="include path of art.h")
+    parser.add_argument("frames", nargs="+", help="PNG frames, shown in sorted order")
+    args = parser.parse_args()
+    if not args.output and not args.pack:
+        parser.error("at least one of --output and --pack is required")
+
+    blob = bytearray()
+    payloads = {}
+    frames = []
+    report = []
+    for path in sorted(args.frames, key=os.path.basename):
+        width, height, pixels = read_png(path)
+        if (width, height) != (WIDTH, HEIGHT):
+            sys.exit(f"{path}: frames must be {WIDTH}x{HEIGHT}, got {width}x{height}")
+
+        name = os.path.basename(path)
+        encoding, payload = art_codec.encode_frame(pack_rows(pixels))
+        if payload in payloads:
+            offset = payloads[payload]
+            report.append(f"{name}: duplicate, 0 bytes")
+        else:
+            offset = payloads[payload] = len(blob)
+            blob += payload
+            kind = "lzss" if encoding == art_codec.ENCODING_LZSS else "raw"
+            report.append(f"{name}: {kind}, {len(payload)} bytes")
+        frames.append((name, offset, len(payload), encoding))
+
+    table_size = len(frames) * 8
+    report.append(f"total: {len(frames)} frames, {len(blob)} bytes of pixel data "
+                  f"+ {table_size} bytes of frame table "
+                  f"({len(frames) * STRIDE * HEIGHT} bytes uncompressed)")
+    for line in report:
+        print(f"nice_view art: {line}")
+
+    if args.output:
+        write_c(args.output, args.header, blob, frames, report)
+    if args.pack:
+        write_pack(args.pack, blob, frames)
+
+
+if __name__ == "__main__":
+    main()